@@ -9,25 +9,26 @@
 #include "src/printer/PrintHelpers.h"
 #include "src/printer/PrinterControl.h"
 #include "src/printer/MeshtasticBLELogger.h"
+#include "src/printer/MessageDigest.h"
+#include "src/printer/DeviceStats.h"
+#include "src/mesh/MeshIngest.h"
+#include "src/mesh/NodeDb.h"
+#include "src/mesh/MeshLink.h"
+#include "src/mesh/ConfigSync.h"
+#include "src/mesh/PortRegistry.h"
+#include "src/mesh/StoreForward.h"
+#include "src/mesh/TelemetryLog.h"
 
 #define ENABLE_CONTEST_QR_MODULE
 #ifdef ENABLE_CONTEST_QR_MODULE
 #include "src/printer/ContestQrModule.h"
 #endif
 
-#include <map>
 #include <string>
 
-std::map<uint32_t, std::string> nodeNames;
-std::map<std::string, int> channelIndices;
 
 const char *localDeviceName = "Bontastic Printer";
 
-const char *targetService = "6ba1b218-15a8-461f-9fa8-5dcae273eafd";
-const char *uuidFromRadio = "2c55e69e-4993-11ed-b878-0242ac120002";
-const char *uuidToRadio = "f75c76d2-129e-4dad-a1dd-7866124401e7";
-const char *uuidFromNum = "ed9da18c-a800-4f66-a670-aa7547e34453";
-
 const char *deviceInfoServiceUuid = "180a";
 const char *manufacturerUuid = "2a29";
 const char *modelNumberUuid = "2a24";
@@ -36,218 +37,151 @@ const char *hardwareRevUuid = "2a27";
 const char *firmwareRevUuid = "2a26";
 const char *softwareRevUuid = "2a28";
 
-static uint32_t wantConfigId;
-static NimBLERemoteCharacteristic *fromRadio;
-static NimBLERemoteCharacteristic *toRadio;
-static NimBLERemoteCharacteristic *fromNum;
-static volatile bool fromRadioPending;
-static const int maxNotifyQueue = 8;
-static volatile int notifyQueueCount;
-static volatile bool configComplete = false;
-
-volatile bool meshtasticConnected;
-
-bool readFromRadioPacket(std::string &packet)
-{
-  packet = fromRadio->readValue();
-  return !packet.empty();
-}
+// Node number of each linked radio, for spotting DMs to any of them.
+static uint32_t myNodeNums[meshMaxRadios];
 
-void decodeFromRadioPacket(const std::string &packet)
+static bool isOwnNode(uint32_t num)
 {
-  meshtastic_FromRadio msg = meshtastic_FromRadio_init_zero;
-  pb_istream_t stream = pb_istream_from_buffer(reinterpret_cast<const uint8_t *>(packet.data()), packet.size());
-  if (!pb_decode(&stream, meshtastic_FromRadio_fields, &msg))
+  for (uint32_t own : myNodeNums)
   {
-    bleLog("FromRadio decode failed");
-    return;
-  }
-
-  if (msg.which_payload_variant == meshtastic_FromRadio_packet_tag)
-  {
-    const meshtastic_Data &d = msg.packet.decoded;
-    bleLogf("FromRadio port=%u len=%u", (unsigned)d.portnum, (unsigned)d.payload.size);
-
-    switch (d.portnum)
+    if (own && own == num)
     {
-    case meshtastic_PortNum_TEXT_MESSAGE_APP:
-      if (d.payload.size > 0)
-      {
-        std::string senderName = "Unknown";
-        if (nodeNames.count(msg.packet.from))
-        {
-          senderName = nodeNames[msg.packet.from];
-        }
-        else
-        {
-          char buf[16];
-          snprintf(buf, sizeof(buf), "!%08x", msg.packet.from);
-          senderName = buf;
-        }
-        printTextMessage(d.payload.bytes, d.payload.size, senderName.c_str(), msg.packet.rx_time);
-      }
-      break;
-
-    case meshtastic_PortNum_POSITION_APP:
-    {
-      meshtastic_Position position = meshtastic_Position_init_zero;
-      pb_istream_t ps = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
-      if (pb_decode(&ps, meshtastic_Position_fields, &position))
-      {
-        printPosition(position.latitude_i / 1e7, position.longitude_i / 1e7, position.altitude);
-      }
-      else
-      {
-        bleLog("POS decode fail");
-      }
-      break;
-    }
-
-    case meshtastic_PortNum_NODEINFO_APP:
-    {
-      meshtastic_User user = meshtastic_User_init_zero;
-      pb_istream_t ns = pb_istream_from_buffer(d.payload.bytes, d.payload.size);
-      if (pb_decode(&ns, meshtastic_User_fields, &user))
-      {
-        // printNodeInfo(msg.packet.from, user.long_name);
-        nodeNames[msg.packet.from] = user.long_name;
-      }
-      else
-      {
-        bleLog("NODE decode fail");
-      }
-      break;
-    }
-
-    default:
-      printBinaryPayload(d.payload.bytes, d.payload.size);
-      break;
-    }
-  }
-  else if (msg.which_payload_variant == meshtastic_FromRadio_channel_tag)
-  {
-    const meshtastic_Channel &c = msg.channel;
-    if (c.settings.name[0] != 0)
-    {
-      channelIndices[c.settings.name] = c.index;
-      bleLogf("Channel %s index %d", c.settings.name, c.index);
-    }
-  }
-  else if (msg.which_payload_variant == meshtastic_FromRadio_config_complete_id_tag)
-  {
-    if (msg.config_complete_id == wantConfigId)
-    {
-      configComplete = true;
-      bleLog("Config complete");
+      return true;
     }
   }
+  return false;
 }
 
-void drainFromRadio()
+static const char *senderName(uint32_t from, char *unknown, size_t size)
 {
-  while (true)
+  const char *name = nodeDbName(from);
+  if (!name)
   {
-    std::string packet;
-    if (!readFromRadioPacket(packet))
-    {
-      break;
-    }
-    bleLogf("FromRadio bytes=%u", (unsigned)packet.size());
-    decodeFromRadioPacket(packet);
+    snprintf(unknown, size, "!%08x", from);
+    name = unknown;
   }
+  return name;
 }
 
-class ClientCallbacks : public NimBLEClientCallbacks
+void handleTextPacket(const MeshEvent &e)
 {
-  void onConnect(NimBLEClient *) override
+  if (e.size == 0)
   {
-    meshtasticConnected = true;
-    bleLog("Meshtastic connected");
-  }
-
-  void onDisconnect(NimBLEClient *, int) override
-  {
-    meshtasticConnected = false;
-    bleLog("Meshtastic disconnected");
+    return;
   }
+  char unknown[16];
+  // DMs and alerts skip the digest window
+  bool urgent = e.port == meshtastic_PortNum_ALERT_APP || isOwnNode(e.to) ||
+                memchr(e.payload, '\a', e.size);
+  digestQueueText(e.payload, e.size, senderName(e.from, unknown, sizeof(unknown)), e.rxTime, urgent);
+}
 
-  void onPassKeyEntry(NimBLEConnInfo &info) override
+void handlePositionPacket(const MeshEvent &e)
+{
+  meshtastic_Position position = meshtastic_Position_init_zero;
+  pb_istream_t ps = pb_istream_from_buffer(e.payload, e.size);
+  if (pb_decode(&ps, meshtastic_Position_fields, &position))
   {
-    bleLog("Passkey requested");
-    uint32_t passkey = atoi(getPrinterSettings().meshPin);
-    NimBLEDevice::injectPassKey(info, passkey);
+    printPosition(position.latitude_i / 1e7, position.longitude_i / 1e7, position.altitude);
   }
-
-  void onAuthenticationComplete(NimBLEConnInfo &) override
+  else
   {
-    bleLog("Bonded");
+    bleLog("POS decode fail");
   }
-} clientCallbacks;
+}
 
-void setup()
+void handleNodeInfoPacket(const MeshEvent &e)
 {
-  wantConfigId = millis() & 0xFFFF;
-
-  NimBLEDevice::init(localDeviceName);
-  setupPrinterControl();
-  printerSetup();
-  bleLog("Boot");
-
-#ifdef ENABLE_CONTEST_QR_MODULE
-  contestQrSetup();
-  contestQrSetIntervalMinutes(15);
-  contestQrSetContent("https://meshtastic.org/e/?add=true#CjESILQC2idq9-coIo9Sggdz78UgpetPU2o7-F2ITBLHMOyWGglib250YXN0aWMoATABEg8IATgDQANIAVAbaAHABgE");
-#endif
-
-  NimBLEDevice::deleteAllBonds();
-  bleLog("Cleared bonds");
-  NimBLEDevice::setMTU(512);
-  NimBLEDevice::setSecurityAuth(false, false, false);
-  NimBLEDevice::setSecurityIOCap(BLE_HS_IO_KEYBOARD_ONLY);
-  NimBLEDevice::setSecurityPasskey(atoi(getPrinterSettings().meshPin));
+  nodeDbUpdateUser(e.from, e.payload, e.size);
+}
 
-  NimBLEScan *scan = NimBLEDevice::getScan();
-  scan->setActiveScan(true);
-  NimBLEScanResults results = scan->getResults(5 * 1000, false);
-  bleLog("Scan completed");
+void handleBinaryPacket(const MeshEvent &e)
+{
+  bleLogf("Port %u len=%u", (unsigned)e.port, (unsigned)e.size);
+  printBinaryPayload(e.payload, e.size);
+}
 
-  const NimBLEAdvertisedDevice *targetDevice = nullptr;
-  const char *targetName = getPrinterSettings().meshName;
-  for (int i = 0; i < results.getCount(); ++i)
+// What happens to each port. Disabled ports are dropped on the ingest task
+// right after the port number is read; flip a flag to print one as a hex
+// dump for debugging.
+static const PortRoute portRoutes[] = {
+    {meshtastic_PortNum_TEXT_MESSAGE_APP, true, handleTextPacket, "text"},
+    {meshtastic_PortNum_ALERT_APP, true, handleTextPacket, "alert"},
+    {meshtastic_PortNum_POSITION_APP, true, handlePositionPacket, "position"},
+    {meshtastic_PortNum_NODEINFO_APP, true, handleNodeInfoPacket, "nodeinfo"},
+    {meshtastic_PortNum_ROUTING_APP, false, handleBinaryPacket, "routing"},
+    {meshtastic_PortNum_ADMIN_APP, false, handleBinaryPacket, "admin"},
+    {meshtastic_PortNum_WAYPOINT_APP, false, handleBinaryPacket, "waypoint"},
+    {meshtastic_PortNum_STORE_FORWARD_APP, true, storeForwardPacket, "storeforward"},
+    {meshtastic_PortNum_RANGE_TEST_APP, false, handleBinaryPacket, "rangetest"},
+    {meshtastic_PortNum_TELEMETRY_APP, true, telemetryPacket, "telemetry"},
+    {meshtastic_PortNum_TRACEROUTE_APP, false, handleBinaryPacket, "traceroute"},
+    {meshtastic_PortNum_NEIGHBORINFO_APP, false, handleBinaryPacket, "neighborinfo"},
+    {meshtastic_PortNum_MAP_REPORT_APP, false, handleBinaryPacket, "mapreport"},
+    {meshtastic_PortNum_PAXCOUNTER_APP, false, handleBinaryPacket, "paxcounter"},
+};
+static const PortRoute otherPorts = {0, false, handleBinaryPacket, "other"};
+
+// Events come decoded from the ingest task, packets only for enabled ports;
+// only the payloads of the ports that print are decoded, by their handlers.
+// Packets print the same whichever radio delivered them; the radio only
+// matters for config records.
+void handleMeshEvent(const MeshEvent &e)
+{
+  switch (e.kind)
   {
-    const NimBLEAdvertisedDevice *device = results.getDevice(i);
-    std::string name = device->getName();
-    if (name == targetName)
+  case MeshEventKind::Packet:
+    statsBootMark("packet");
+    storeForwardClock(e.rxTime);
+    portDispatch(e);
+    break;
+
+  case MeshEventKind::Channel:
+    configSyncChannel(e.radio, (uint8_t)e.from, e.payload, e.size);
+    break;
+
+  case MeshEventKind::NodeInfo:
+    nodeDbUpdateUser(e.from, e.payload, e.size);
+    break;
+
+  case MeshEventKind::MyInfo:
+    myNodeNums[e.radio] = e.from;
+    configSyncMyInfo(e.radio, e.from, e.id);
+    bleLogf("Radio %u is node !%08x", e.radio, e.from);
+    break;
+
+  case MeshEventKind::ConfigComplete:
+    if (configSyncComplete(e.radio, e.id))
     {
-      targetDevice = device;
-      bleLogf("Target %s %s", device->getAddress().toString().c_str(), name.c_str());
-      break;
+      meshLinkConfigDone(e.radio);
+      bleLog("Config complete");
     }
-  }
+    break;
 
-  if (!targetDevice)
-  {
-    bleLog("Target not found");
-    return;
-  }
-
-  NimBLEClient *client = NimBLEDevice::createClient();
-  if (!client)
-  {
-    bleLog("Client create failed");
-    return;
+  case MeshEventKind::Rebooted:
+    // Only seen on the serial link; over BLE a reboot drops the connection.
+    bleLog("Radio rebooted");
+    configSyncStart(e.radio, false);
+    break;
   }
+}
 
-  client->setClientCallbacks(&clientCallbacks, false);
-  bleLog("Connecting");
-  if (!client->connect(targetDevice))
+void handleMeshEvents()
+{
+  static MeshEvent event;
+  while (meshIngestPop(event))
   {
-    bleLog("Connect failed");
-    NimBLEDevice::deleteClient(client);
-    return;
+    handleMeshEvent(event);
   }
+}
 
-  NimBLERemoteService *deviceInfo = client->getService(deviceInfoServiceUuid);
+// Runs on every (re)connection once a radio's service is found: starts the
+// config sync, and on the radio's first link of a boot also prints its
+// device information. A radio on the serial link has no client and no
+// Device Information service.
+void onRadioReady(uint8_t radio, NimBLEClient *client, bool firstLink)
+{
+  NimBLERemoteService *deviceInfo = firstLink && client ? client->getService(deviceInfoServiceUuid) : nullptr;
   if (deviceInfo)
   {
     bleLog("DeviceInformationService");
@@ -271,137 +205,61 @@ void setup()
     printChar("SW", softwareRevUuid);
   }
 
-  bleLog("Securing");
-  if (!client->secureConnection())
-  {
-    bleLog("Secure start failed");
-  }
-
-  NimBLERemoteService *service = client->getService(targetService);
-  if (!service)
-  {
-    bleLog("Service not found");
-    return;
-  }
-
-  bleLogf("Service %s", targetService);
-
-  fromRadio = service->getCharacteristic(uuidFromRadio);
-  toRadio = service->getCharacteristic(uuidToRadio);
-  fromNum = service->getCharacteristic(uuidFromNum);
-
-  meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
-  req.which_payload_variant = meshtastic_ToRadio_want_config_id_tag;
-  req.want_config_id = wantConfigId++;
-
-  uint8_t buffer[16];
-  pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
-  if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
-  {
-    bleLog("Start config encode failed");
-    return;
-  }
-
-  bleLog("Request config");
-  if (!toRadio->writeValue(buffer, ostream.bytes_written, true))
-  {
-    bleLog("Start config failed");
-    return;
-  }
-
-  bleLog("Reading FromRadio");
-  unsigned long startConfig = millis();
-  while (!configComplete && millis() - startConfig < 10000)
-  {
-    drainFromRadio();
-    delay(100);
-  }
+  configSyncStart(radio, firstLink);
+}
 
+void setup()
+{
+  statsBootMark("setup");
+  NimBLEDevice::init(localDeviceName);
+  setupPrinterControl();
+  printerSetup();
+  statsBootMark("printer");
+  // Queued into the UART buffer; it prints while the link comes up.
   printStartupLogo();
+  statsBootMark("logo");
+  digestSetup(storeForwardPrinted);
+  portRegistrySetup(portRoutes, sizeof(portRoutes) / sizeof(portRoutes[0]), otherPorts);
+  meshIngestSetup();
+  nodeDbSetup();
+  configSyncSetup();
+  storeForwardSetup();
+  telemetrySetup();
+  telemetrySetIntervalMinutes(6 * 60);
+  bleLog("Boot");
 
-  auto notifyCallback = [](NimBLERemoteCharacteristic *characteristic, uint8_t *, size_t, bool isNotify)
-  {
-    if (!isNotify)
-    {
-      return;
-    }
-    if (notifyQueueCount < maxNotifyQueue)
-    {
-      notifyQueueCount++;
-      fromRadioPending = true;
-      bleLogf("FromNum notify queued: %d", notifyQueueCount);
-    }
-    else
-    {
-      bleLog("FromNum notify dropped (queue full)");
-    }
-  };
+#ifdef ENABLE_CONTEST_QR_MODULE
+  contestQrSetup();
+  contestQrSetIntervalMinutes(15);
+  contestQrSetContent("https://meshtastic.org/e/?add=true#CjESILQC2idq9-coIo9Sggdz78UgpetPU2o7-F2ITBLHMOyWGglib250YXN0aWMoATABEg8IATgDQANIAVAbaAHABgE");
+#endif
 
-  if (!fromNum->subscribe(true, notifyCallback, true))
-  {
-    bleLog("FromNum subscribe failed");
-  }
+  // Bonds are kept so a reboot reconnects without pairing again.
+  NimBLEDevice::setMTU(512);
+  NimBLEDevice::setSecurityAuth(true, false, false);
+  NimBLEDevice::setSecurityIOCap(BLE_HS_IO_KEYBOARD_ONLY);
+  NimBLEDevice::setSecurityPasskey(atoi(getPrinterSettings().meshPin));
+
+  meshLinkSetup(onRadioReady);
+  statsBootMark("ble");
 }
 
 void sendMeshtasticNotification(const char *message)
 {
-  if (!toRadio)
-  {
-    bleLog("Cannot send notification: toRadio not set");
-    return;
-  }
-
-  meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
-  req.which_payload_variant = meshtastic_ToRadio_packet_tag;
-
-  meshtastic_MeshPacket *p = &req.packet;
-  p->which_payload_variant = meshtastic_MeshPacket_decoded_tag;
-  p->to = 0xFFFFFFFF; // Broadcast
-
-  static uint32_t packetId = 0;
-  if (packetId == 0)
-    packetId = millis();
-  p->id = ++packetId;
-
-  int channelIndex = 0;
-
-  bleLogf("Available channels: %d", channelIndices.size());
-  for (auto const &[name, index] : channelIndices)
+  int channelIndex = configSyncChannelIndex("bontastic");
+  if (channelIndex < 0)
   {
-    bleLogf(" - %s: %d", name.c_str(), index);
+    channelIndex = configSyncChannelIndex("Bontastic");
   }
-
-  if (channelIndices.count("bontastic"))
-  {
-    channelIndex = channelIndices["bontastic"];
-  }
-  else if (channelIndices.count("Bontastic"))
+  if (channelIndex < 0)
   {
-    channelIndex = channelIndices["Bontastic"];
+    channelIndex = 0;
   }
-
   bleLogf("Selected channel index: %d", channelIndex);
-  p->channel = channelIndex;
-
-  meshtastic_Data *d = &p->decoded;
-  d->portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
-  d->payload.size = strlen(message);
-  if (d->payload.size > sizeof(d->payload.bytes))
-  {
-    d->payload.size = sizeof(d->payload.bytes);
-  }
-  memcpy(d->payload.bytes, message, d->payload.size);
-
-  uint8_t buffer[256];
-  pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
-  if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
-  {
-    bleLog("Notification encode failed");
-    return;
-  }
 
   bleLogf("Sending notification: %s", message);
-  if (!toRadio->writeValue(buffer, ostream.bytes_written, true))
+  if (!meshLinkSendData(0xFFFFFFFF, channelIndex, meshtastic_PortNum_TEXT_MESSAGE_APP, (const uint8_t *)message,
+                        strlen(message)))
   {
     bleLog("Notification send failed");
   }
@@ -410,17 +268,17 @@ void sendMeshtasticNotification(const char *message)
 void loop()
 {
   printerControlLoop();
+  printerIdleLoop();
+  digestLoop();
+  nodeDbLoop();
+  meshLinkLoop();
+  configSyncLoop();
 
 #ifdef ENABLE_CONTEST_QR_MODULE
   contestQrLoop();
 #endif
 
-  if (fromRadioPending)
-  {
-    fromRadioPending = false;
-    int count = notifyQueueCount;
-    notifyQueueCount = 0;
-    bleLogf("Draining FromRadio for %d notify events", count);
-    drainFromRadio();
-  }
+  handleMeshEvents();
+  storeForwardLoop();
+  telemetryLoop();
 }
\ No newline at end of file
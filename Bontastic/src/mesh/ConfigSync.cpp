@@ -0,0 +1,250 @@
+#include "ConfigSync.h"
+#include "MeshIngest.h"
+#include "MeshLink.h"
+#include "NodeDb.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include "../protobufs/mesh.pb.h"
+#include "../nanopb/pb_encode.h"
+#include <Preferences.h>
+#include <string.h>
+
+// Special want_config_id values understood by Meshtastic 2.6+ firmware.
+static const uint32_t onlyConfigNonce = 69420;
+static const uint32_t onlyNodesNonce = 69421;
+
+static const uint8_t maxChannels = 8;
+static const uint32_t followUpTimeoutMs = 10000;
+static const uint32_t followUpKickMs = 100;
+
+// Node table fingerprint: the radio and its node count when the table was
+// last downloaded in full.
+struct NodeFingerprint
+{
+    uint32_t nodeNum;
+    uint32_t nodedbCount;
+};
+
+static Preferences syncPrefs;
+static char channels[maxChannels][12];
+static char pendingChannels[maxChannels][12];
+static NodeFingerprint savedFingerprint;
+static NodeFingerprint reported;
+
+static uint32_t fullNonce;
+static uint32_t wantedIds[meshMaxRadios];
+static uint32_t followUpSinceMs;
+static uint32_t lastKickMs;
+static uint32_t syncStartMs;
+
+static uint32_t fullSyncs;
+static uint32_t configOnlySyncs;
+static uint32_t nodeSyncs;
+static uint32_t channelSaves;
+static uint32_t liveAfterMs;
+
+static void syncStatsProvider(std::string &out)
+{
+    statsAppend(out, "sync_full", fullSyncs);
+    statsAppend(out, "sync_config_only", configOnlySyncs);
+    statsAppend(out, "sync_nodes_only", nodeSyncs);
+    statsAppend(out, "sync_channel_saves", channelSaves);
+    statsAppend(out, "sync_live_after_ms", liveAfterMs);
+}
+
+static bool requestConfig(uint8_t radio, uint32_t id)
+{
+    meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
+    req.which_payload_variant = meshtastic_ToRadio_want_config_id_tag;
+    req.want_config_id = id;
+
+    uint8_t buffer[16];
+    pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
+    if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
+    {
+        bleLog("Start config encode failed");
+        return false;
+    }
+    bleLogf("Request config %lu from radio %u", (unsigned long)id, radio);
+    if (!meshLinkSend(radio, buffer, ostream.bytes_written))
+    {
+        bleLog("Start config failed");
+        return false;
+    }
+    wantedIds[radio] = id;
+    return true;
+}
+
+static bool cacheWarm()
+{
+    return savedFingerprint.nodeNum && nodeDbCount() > 0;
+}
+
+void configSyncSetup()
+{
+    statsRegisterProvider(syncStatsProvider);
+    fullNonce = millis() & 0xFFFF;
+    if (!syncPrefs.begin("cfgsync", false))
+    {
+        return;
+    }
+    syncPrefs.getBytes("channels", channels, sizeof(channels));
+    for (uint8_t i = 0; i < maxChannels; i++)
+    {
+        channels[i][sizeof(channels[i]) - 1] = 0;
+    }
+    syncPrefs.getBytes("nodes", &savedFingerprint, sizeof(savedFingerprint));
+}
+
+void configSyncStart(uint8_t radio, bool firstLink)
+{
+    if (radio != meshPrimaryRadio)
+    {
+        // Only the nodes are of use from a secondary radio, for the names
+        // of nodes the primary cannot hear; once per boot is enough.
+        requestConfig(radio, firstLink ? ++fullNonce : onlyConfigNonce);
+        return;
+    }
+    memset(pendingChannels, 0, sizeof(pendingChannels));
+    memset(&reported, 0, sizeof(reported));
+    followUpSinceMs = 0;
+    if (cacheWarm())
+    {
+        configOnlySyncs++;
+        requestConfig(radio, onlyConfigNonce);
+    }
+    else
+    {
+        fullSyncs++;
+        requestConfig(radio, ++fullNonce);
+    }
+    syncStartMs = millis();
+}
+
+void configSyncMyInfo(uint8_t radio, uint32_t nodeNum, uint32_t nodedbCount)
+{
+    if (radio != meshPrimaryRadio)
+    {
+        return;
+    }
+    reported.nodeNum = nodeNum;
+    reported.nodedbCount = nodedbCount;
+}
+
+void configSyncChannel(uint8_t radio, uint8_t index, const uint8_t *name, size_t len)
+{
+    if (radio != meshPrimaryRadio || index >= maxChannels)
+    {
+        return;
+    }
+    if (len >= sizeof(pendingChannels[index]))
+    {
+        len = sizeof(pendingChannels[index]) - 1;
+    }
+    memcpy(pendingChannels[index], name, len);
+    pendingChannels[index][len] = 0;
+}
+
+static void commitChannels()
+{
+    if (!memcmp(channels, pendingChannels, sizeof(channels)))
+    {
+        return;
+    }
+    memcpy(channels, pendingChannels, sizeof(channels));
+    syncPrefs.putBytes("channels", channels, sizeof(channels));
+    channelSaves++;
+    bleLog("Channels changed, saved");
+}
+
+static void commitNodes()
+{
+    nodeDbSave();
+    if (memcmp(&savedFingerprint, &reported, sizeof(reported)))
+    {
+        savedFingerprint = reported;
+        syncPrefs.putBytes("nodes", &savedFingerprint, sizeof(savedFingerprint));
+    }
+}
+
+bool configSyncComplete(uint8_t radio, uint32_t id)
+{
+    if (id != wantedIds[radio])
+    {
+        return false;
+    }
+    wantedIds[radio] = 0;
+    if (radio != meshPrimaryRadio)
+    {
+        nodeDbSave();
+        return true;
+    }
+    followUpSinceMs = 0;
+
+    if (id == onlyNodesNonce)
+    {
+        commitNodes();
+        bleLog("Node sync complete");
+        return false;
+    }
+
+    commitChannels();
+    liveAfterMs = millis() - syncStartMs;
+    if (id != onlyConfigNonce)
+    {
+        commitNodes();
+        return true;
+    }
+
+    // Without a node count (older firmware) the saved table is kept and
+    // live NODEINFO packets refresh it.
+    bool stale = reported.nodeNum != savedFingerprint.nodeNum ||
+                 (reported.nodedbCount && reported.nodedbCount != savedFingerprint.nodedbCount);
+    if (stale && requestConfig(radio, onlyNodesNonce))
+    {
+        nodeSyncs++;
+        followUpSinceMs = millis();
+        lastKickMs = 0;
+    }
+    return true;
+}
+
+// The follow-up download starts once the link is already live, when
+// ingest only reads what FromNum announces, so it is drained here.
+void configSyncLoop()
+{
+    if (!followUpSinceMs)
+    {
+        return;
+    }
+    uint32_t now = millis();
+    if (now - followUpSinceMs >= followUpTimeoutMs)
+    {
+        bleLog("Node sync timed out");
+        followUpSinceMs = 0;
+        wantedIds[meshPrimaryRadio] = 0;
+        return;
+    }
+    if (now - lastKickMs >= followUpKickMs)
+    {
+        lastKickMs = now;
+        meshIngestKick(meshPrimaryRadio);
+    }
+}
+
+int configSyncChannelIndex(const char *name)
+{
+    for (uint8_t i = 0; i < maxChannels; i++)
+    {
+        if (channels[i][0] && !strcmp(channels[i], name))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const char *configSyncChannelName(uint8_t index)
+{
+    return index < maxChannels ? channels[index] : "";
+}
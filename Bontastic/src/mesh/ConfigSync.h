@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Chooses what to ask the radio for on each connection. A cold cache gets
+// the full want_config download. A warm one (node table and channels
+// saved in flash) asks for config only, which goes live in well under a
+// second, and follows up with a nodes-only download when the radio's node
+// count says the saved table is stale. Radios that predate the special
+// nonces answer them with a full download, which is handled the same way.
+// Channels and the node fingerprint are taken from the primary radio only;
+// other radios are asked for their nodes once per boot, and for config
+// only on later links, which is what starts their packet stream.
+void configSyncSetup();
+void configSyncLoop();
+// Sends the first want_config request for a radio's fresh connection.
+void configSyncStart(uint8_t radio, bool firstLink);
+void configSyncMyInfo(uint8_t radio, uint32_t nodeNum, uint32_t nodedbCount);
+void configSyncChannel(uint8_t radio, uint8_t index, const uint8_t *name, size_t len);
+// Handles config_complete_id. Returns true when the radio's live traffic
+// can flow.
+bool configSyncComplete(uint8_t radio, uint32_t id);
+// Index of the named channel on the primary radio, or -1 when it has no
+// such channel.
+int configSyncChannelIndex(const char *name);
+const char *configSyncChannelName(uint8_t index);
@@ -0,0 +1,452 @@
+#include "FromRadioScan.h"
+#include <string.h>
+
+// Field numbers from mesh.proto and channel.proto
+static const uint32_t fromRadioPacket = 2;
+static const uint32_t fromRadioMyInfo = 3;
+static const uint32_t fromRadioNodeInfo = 4;
+static const uint32_t fromRadioConfigComplete = 7;
+static const uint32_t fromRadioRebooted = 8;
+static const uint32_t fromRadioChannel = 10;
+
+static const uint32_t packetFrom = 1;
+static const uint32_t packetTo = 2;
+static const uint32_t packetChannel = 3;
+static const uint32_t packetDecoded = 4;
+static const uint32_t packetId = 6;
+static const uint32_t packetRxTime = 7;
+
+static const uint32_t dataPortnum = 1;
+static const uint32_t dataPayload = 2;
+static const uint32_t dataReplyId = 7;
+
+static const uint32_t myInfoNodeNum = 1;
+static const uint32_t myInfoNodedbCount = 15;
+
+static const uint32_t nodeInfoNum = 1;
+static const uint32_t nodeInfoUser = 2;
+
+static const uint32_t userLongName = 2;
+static const uint32_t userShortName = 3;
+
+static const uint32_t channelIndex = 1;
+static const uint32_t channelSettings = 2;
+static const uint32_t settingsName = 3;
+
+enum WireType
+{
+    wireVarint = 0,
+    wireFixed64 = 1,
+    wireBytes = 2,
+    wireFixed32 = 5
+};
+
+struct Wire
+{
+    const uint8_t *p;
+    const uint8_t *end;
+};
+
+static bool readVarint(Wire &w, uint64_t &v)
+{
+    v = 0;
+    for (int shift = 0; shift < 64 && w.p < w.end; shift += 7)
+    {
+        uint8_t b = *w.p++;
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool readFixed32(Wire &w, uint32_t &v)
+{
+    if (w.end - w.p < 4)
+    {
+        return false;
+    }
+    v = (uint32_t)w.p[0] | (uint32_t)w.p[1] << 8 | (uint32_t)w.p[2] << 16 | (uint32_t)w.p[3] << 24;
+    w.p += 4;
+    return true;
+}
+
+// Splits off the body of a length-delimited field.
+static bool readBytes(Wire &w, Wire &body)
+{
+    uint64_t len;
+    if (!readVarint(w, len) || len > (uint64_t)(w.end - w.p))
+    {
+        return false;
+    }
+    body.p = w.p;
+    body.end = w.p + len;
+    w.p += len;
+    return true;
+}
+
+static bool readTag(Wire &w, uint32_t &field, uint8_t &type)
+{
+    uint64_t tag;
+    if (!readVarint(w, tag))
+    {
+        return false;
+    }
+    field = (uint32_t)(tag >> 3);
+    type = tag & 7;
+    return field != 0;
+}
+
+static bool skipField(Wire &w, uint8_t type)
+{
+    uint64_t v;
+    Wire body;
+    switch (type)
+    {
+    case wireVarint:
+        return readVarint(w, v);
+    case wireFixed64:
+        if (w.end - w.p < 8)
+        {
+            return false;
+        }
+        w.p += 8;
+        return true;
+    case wireBytes:
+        return readBytes(w, body);
+    case wireFixed32:
+        if (w.end - w.p < 4)
+        {
+            return false;
+        }
+        w.p += 4;
+        return true;
+    default:
+        // Groups are not used by any Meshtastic message.
+        return false;
+    }
+}
+
+// Reads a varint field into a uint32, or skips a field of the wrong type.
+static bool readUint32(Wire &w, uint8_t type, uint32_t &out)
+{
+    if (type != wireVarint)
+    {
+        return skipField(w, type);
+    }
+    uint64_t v;
+    if (!readVarint(w, v))
+    {
+        return false;
+    }
+    out = (uint32_t)v;
+    return true;
+}
+
+static bool readFixed32Field(Wire &w, uint8_t type, uint32_t &out)
+{
+    if (type != wireFixed32)
+    {
+        return skipField(w, type);
+    }
+    return readFixed32(w, out);
+}
+
+static bool scanData(Wire w, FromRadioView &view)
+{
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        if (field == dataPortnum)
+        {
+            ok = readUint32(w, type, view.portnum);
+        }
+        else if (field == dataPayload && type == wireBytes)
+        {
+            Wire body;
+            ok = readBytes(w, body);
+            view.payload = body.p;
+            view.payloadLen = body.end - body.p;
+        }
+        else if (field == dataReplyId)
+        {
+            ok = readFixed32Field(w, type, view.replyId);
+        }
+        else
+        {
+            ok = skipField(w, type);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool scanPacket(Wire w, FromRadioView &view)
+{
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        switch (field)
+        {
+        case packetFrom:
+            ok = readFixed32Field(w, type, view.from);
+            break;
+        case packetTo:
+            ok = readFixed32Field(w, type, view.to);
+            break;
+        case packetChannel:
+            ok = readUint32(w, type, view.channel);
+            break;
+        case packetId:
+            ok = readFixed32Field(w, type, view.id);
+            break;
+        case packetRxTime:
+            ok = readFixed32Field(w, type, view.rxTime);
+            break;
+        case packetDecoded:
+            if (type == wireBytes)
+            {
+                Wire body;
+                ok = readBytes(w, body) && scanData(body, view);
+                view.decoded = true;
+                break;
+            }
+            // fall through
+        default:
+            ok = skipField(w, type);
+            break;
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool scanMyInfo(Wire w, FromRadioView &view)
+{
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        if (field == myInfoNodeNum)
+        {
+            ok = readUint32(w, type, view.value);
+        }
+        else if (field == myInfoNodedbCount)
+        {
+            ok = readUint32(w, type, view.nodedbCount);
+        }
+        else
+        {
+            ok = skipField(w, type);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool scanNodeInfo(Wire w, FromRadioView &view)
+{
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        if (field == nodeInfoNum)
+        {
+            ok = readUint32(w, type, view.value);
+        }
+        else if (field == nodeInfoUser && type == wireBytes)
+        {
+            Wire user;
+            ok = readBytes(w, user);
+            view.payload = user.p;
+            view.payloadLen = user.end - user.p;
+        }
+        else
+        {
+            ok = skipField(w, type);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool scanUserNames(const uint8_t *data, size_t len, const uint8_t *&longName, size_t &longLen,
+                   const uint8_t *&shortName, size_t &shortLen)
+{
+    longName = shortName = data;
+    longLen = shortLen = 0;
+    Wire w = {data, data + len};
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        if ((field == userLongName || field == userShortName) && type == wireBytes)
+        {
+            Wire name;
+            ok = readBytes(w, name);
+            if (field == userLongName)
+            {
+                longName = name.p;
+                longLen = name.end - name.p;
+            }
+            else
+            {
+                shortName = name.p;
+                shortLen = name.end - name.p;
+            }
+        }
+        else
+        {
+            ok = skipField(w, type);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool scanChannel(Wire w, FromRadioView &view)
+{
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        if (field == channelIndex)
+        {
+            ok = readUint32(w, type, view.value);
+        }
+        else if (field == channelSettings && type == wireBytes)
+        {
+            Wire settings;
+            ok = readBytes(w, settings);
+            while (ok && settings.p < settings.end)
+            {
+                ok = readTag(settings, field, type);
+                if (ok && field == settingsName && type == wireBytes)
+                {
+                    Wire name;
+                    ok = readBytes(settings, name);
+                    view.payload = name.p;
+                    view.payloadLen = name.end - name.p;
+                }
+                else if (ok)
+                {
+                    ok = skipField(settings, type);
+                }
+            }
+        }
+        else
+        {
+            ok = skipField(w, type);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool scanFromRadio(const uint8_t *data, size_t len, FromRadioView &view)
+{
+    memset(&view, 0, sizeof(view));
+    Wire w = {data, data + len};
+    uint32_t field;
+    uint8_t type;
+    while (w.p < w.end)
+    {
+        if (!readTag(w, field, type))
+        {
+            return false;
+        }
+        bool ok;
+        Wire body;
+        if (field == fromRadioPacket && type == wireBytes)
+        {
+            ok = readBytes(w, body) && scanPacket(body, view);
+            view.kind = FromRadioKind::Packet;
+        }
+        else if (field == fromRadioMyInfo && type == wireBytes)
+        {
+            ok = readBytes(w, body) && scanMyInfo(body, view);
+            view.kind = FromRadioKind::MyInfo;
+        }
+        else if (field == fromRadioNodeInfo && type == wireBytes)
+        {
+            ok = readBytes(w, body) && scanNodeInfo(body, view);
+            view.kind = FromRadioKind::NodeInfo;
+        }
+        else if (field == fromRadioChannel && type == wireBytes)
+        {
+            ok = readBytes(w, body) && scanChannel(body, view);
+            view.kind = FromRadioKind::Channel;
+        }
+        else if (field == fromRadioConfigComplete && type == wireVarint)
+        {
+            ok = readUint32(w, type, view.value);
+            view.kind = FromRadioKind::ConfigComplete;
+        }
+        else if (field == fromRadioRebooted && type == wireVarint)
+        {
+            ok = readUint32(w, type, view.value);
+            view.kind = view.value ? FromRadioKind::Rebooted : FromRadioKind::Other;
+        }
+        else
+        {
+            ok = skipField(w, type);
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum class FromRadioKind : uint8_t
+{
+    Other,
+    Packet,
+    MyInfo,
+    Channel,
+    NodeInfo,
+    ConfigComplete,
+    Rebooted
+};
+
+// The handful of FromRadio fields ingest uses. `payload` points into the
+// scanned buffer: the Data payload of a decoded packet, the name of a
+// channel or the encoded User of a NodeInfo. Packets whose payload is still
+// encrypted have `decoded` unset.
+struct FromRadioView
+{
+    FromRadioKind kind;
+    bool decoded;
+    uint32_t from;
+    uint32_t to;
+    uint32_t id;
+    uint32_t channel;
+    uint32_t rxTime;
+    uint32_t portnum;
+    uint32_t replyId;
+    uint32_t value; // my_node_num, config_complete_id, channel index or node num
+    uint32_t nodedbCount; // my_info only
+    const uint8_t *payload;
+    size_t payloadLen;
+};
+
+// Single pass over the protobuf wire format of one FromRadio record. Fields
+// other than the ones above are skipped without being decoded. Returns false
+// for malformed input.
+bool scanFromRadio(const uint8_t *data, size_t len, FromRadioView &view);
+// Finds long_name and short_name in an encoded meshtastic_User, as carried
+// by NodeInfo records and NODEINFO_APP payloads. Missing names are empty.
+bool scanUserNames(const uint8_t *data, size_t len, const uint8_t *&longName, size_t &longLen,
+                   const uint8_t *&shortName, size_t &shortLen);
@@ -0,0 +1,482 @@
+#include "MeshIngest.h"
+#include "PacketPool.h"
+#include "FromRadioScan.h"
+#include "PacketDedup.h"
+#include "PortRegistry.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include <NimBLEDevice.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <atomic>
+#include <string.h>
+
+// Run next to the NimBLE host so reads complete while loop() is busy
+// printing.
+#ifdef CONFIG_BT_NIMBLE_PINNED_TO_CORE
+static const BaseType_t ingestCore = CONFIG_BT_NIMBLE_PINNED_TO_CORE;
+#else
+static const BaseType_t ingestCore = 0;
+#endif
+static const UBaseType_t ingestPriority = 3;
+static const uint32_t ingestStackBytes = 6144;
+
+// How long a full queue may hold up ingest before the event is dropped; the
+// radio keeps buffering in the meantime.
+static const uint32_t queueFullWaitMs = 1000;
+// Records read from one radio before the next gets its turn.
+static const uint32_t drainBatch = 4;
+
+// Power of two, so the free-running indices wrap cleanly.
+static const uint8_t queueSize = 16;
+static MeshEvent queue[queueSize];
+static std::atomic<uint8_t> queueHead; // next slot to write, ingest task only
+static std::atomic<uint8_t> queueTail; // next slot to read, loop() only
+
+// FromNum counts the records a radio has queued for us. Once the count of
+// records read is in step with it, a drain reads exactly the difference
+// instead of reading until FromRadio comes back empty.
+struct RadioIngest
+{
+    // A new link's FromRadio, taken over by the task before its next drain
+    // of this radio; the fields below the atomics are the task's alone.
+    std::atomic<NimBLERemoteCharacteristic *> startedFromRadio;
+    std::atomic<bool> restart;
+    NimBLERemoteCharacteristic *fromRadio;
+    std::atomic<uint32_t> notifiedNum;
+    std::atomic<bool> drainAllRequested;
+    bool counterSynced;
+    uint32_t readNum;
+    bool drainingAll;
+    uint32_t drainTarget;
+    uint32_t drainTrips;
+};
+
+static RadioIngest radios[meshMaxRadios];
+// Radios with something to read, one bit each; the task drains them in
+// turn into the shared queue.
+static std::atomic<uint8_t> pendingRadios;
+static TaskHandle_t ingestTask;
+static SemaphoreHandle_t readDone;
+
+static std::atomic<uint32_t> notifies;
+static std::atomic<uint32_t> records;
+static std::atomic<uint32_t> decodeErrors;
+static std::atomic<uint32_t> dropped;
+static std::atomic<uint32_t> queueHighWater;
+static std::atomic<uint32_t> readErrors;
+
+static std::atomic<uint32_t> drains;
+static std::atomic<uint32_t> roundTrips;
+static std::atomic<uint32_t> emptyReads;
+static std::atomic<uint32_t> lastDrainTrips;
+static std::atomic<uint32_t> maxDrainTrips;
+static std::atomic<uint32_t> lostNotifies;
+static std::atomic<uint32_t> resyncs;
+
+static void ingestStatsProvider(std::string &out)
+{
+    statsAppend(out, "ingest_notifies", notifies.load());
+    statsAppend(out, "ingest_records", records.load());
+    statsAppend(out, "ingest_decode_errors", decodeErrors.load());
+    statsAppend(out, "ingest_dropped", dropped.load());
+    statsAppend(out, "ingest_queue_hwm", queueHighWater.load());
+    statsAppend(out, "ingest_read_errors", readErrors.load());
+    statsAppend(out, "ingest_drains", drains.load());
+    statsAppend(out, "ingest_round_trips", roundTrips.load());
+    statsAppend(out, "ingest_empty_reads", emptyReads.load());
+    statsAppend(out, "ingest_last_drain_trips", lastDrainTrips.load());
+    statsAppend(out, "ingest_max_drain_trips", maxDrainTrips.load());
+    statsAppend(out, "ingest_lost_notifies", lostNotifies.load());
+    statsAppend(out, "ingest_resyncs", resyncs.load());
+}
+
+static uint8_t queueDepth()
+{
+    return (uint8_t)(queueHead.load(std::memory_order_relaxed) - queueTail.load(std::memory_order_acquire));
+}
+
+// Returns the slot to fill, or nullptr while the queue is full.
+static MeshEvent *queueReserve()
+{
+    if (queueDepth() >= queueSize)
+    {
+        return nullptr;
+    }
+    return &queue[queueHead.load(std::memory_order_relaxed) % queueSize];
+}
+
+static void queueCommit()
+{
+    queueHead.fetch_add(1, std::memory_order_release);
+    uint32_t depth = queueDepth();
+    if (depth > queueHighWater.load(std::memory_order_relaxed))
+    {
+        queueHighWater.store(depth, std::memory_order_relaxed);
+    }
+}
+
+bool meshIngestPop(MeshEvent &event)
+{
+    uint8_t tail = queueTail.load(std::memory_order_relaxed);
+    if (tail == queueHead.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    event = queue[tail % queueSize];
+    queueTail.store((uint8_t)(tail + 1), std::memory_order_release);
+    return true;
+}
+
+bool meshIngestPending()
+{
+    return queueDepth() > 0;
+}
+
+static MeshEvent *waitForSlot(uint32_t maxWaitMs)
+{
+    MeshEvent *slot = queueReserve();
+    for (uint32_t waited = 0; !slot && waited < maxWaitMs; waited += 20)
+    {
+        vTaskDelay(pdMS_TO_TICKS(20));
+        slot = queueReserve();
+    }
+    return slot;
+}
+
+// Only the records the print side acts on become events; the rest of the
+// config stream (nodes, module config, metadata) is skipped here.
+static bool toEvent(const FromRadioView &view, uint8_t radio, MeshEvent &e)
+{
+    memset(&e, 0, offsetof(MeshEvent, payload));
+    e.radio = radio;
+    if (view.payloadLen > sizeof(e.payload))
+    {
+        return false;
+    }
+    switch (view.kind)
+    {
+    case FromRadioKind::Packet:
+        // Ports nobody handles go first, so they cost no dedup lookup.
+        // Replays after a reconnect or config request, and packets every
+        // radio in range heard, arrive again with the same sender and id;
+        // a packet is recorded once it is queued, in queueRecord().
+        if (!view.decoded || !portWanted(view.portnum) ||
+            packetDedupSeen((uint16_t)view.portnum, view.from, view.id))
+        {
+            return false;
+        }
+        e.kind = MeshEventKind::Packet;
+        e.channel = (uint8_t)view.channel;
+        e.port = (uint16_t)view.portnum;
+        e.from = view.from;
+        e.to = view.to;
+        e.id = view.id;
+        e.replyId = view.replyId;
+        e.rxTime = view.rxTime;
+        break;
+    case FromRadioKind::Channel:
+        e.kind = MeshEventKind::Channel;
+        e.from = view.value;
+        break;
+    case FromRadioKind::NodeInfo:
+        e.kind = MeshEventKind::NodeInfo;
+        e.from = view.value;
+        break;
+    case FromRadioKind::MyInfo:
+        e.kind = MeshEventKind::MyInfo;
+        e.from = view.value;
+        e.id = view.nodedbCount;
+        return true;
+    case FromRadioKind::ConfigComplete:
+        e.kind = MeshEventKind::ConfigComplete;
+        e.id = view.value;
+        return true;
+    case FromRadioKind::Rebooted:
+        e.kind = MeshEventKind::Rebooted;
+        return true;
+    default:
+        return false;
+    }
+    e.size = (uint16_t)view.payloadLen;
+    memcpy(e.payload, view.payload, view.payloadLen);
+    return true;
+}
+
+struct FromRadioRead
+{
+    PacketBuffer *buffer;
+    int status;
+};
+
+// Runs on the NimBLE host task once per chunk of the long read, then once
+// more with BLE_HS_EDONE or an error.
+static int onFromRadioRead(uint16_t, const ble_gatt_error *error, ble_gatt_attr *attr, void *arg)
+{
+    FromRadioRead *read = static_cast<FromRadioRead *>(arg);
+    if (error->status == 0 && attr)
+    {
+        // An oversized record is read to the end and then discarded.
+        uint16_t chunk = OS_MBUF_PKTLEN(attr->om);
+        if (attr->offset + chunk > sizeof(read->buffer->data))
+        {
+            read->status = BLE_HS_ENOMEM;
+            return 0;
+        }
+        os_mbuf_copydata(attr->om, 0, chunk, read->buffer->data + attr->offset);
+        read->buffer->len = attr->offset + chunk;
+        return 0;
+    }
+    if (read->status == 0 && error->status != BLE_HS_EDONE)
+    {
+        read->status = error->status;
+    }
+    xSemaphoreGive(readDone);
+    return 0;
+}
+
+// Reads one FromRadio record into the buffer. Replaces readValue(), which
+// returns a heap-allocated copy of every record. The host always finishes
+// the procedure (on completion, timeout or disconnect), so this waits for
+// it like readValue() does.
+static bool readFromRadio(NimBLERemoteCharacteristic *fromRadio, PacketBuffer &buffer)
+{
+    NimBLEClient *client = fromRadio->getClient();
+    FromRadioRead read = {&buffer, 0};
+    buffer.len = 0;
+    int rc = ble_gattc_read_long(client->getConnHandle(), fromRadio->getHandle(), 0, onFromRadioRead, &read);
+    if (rc != 0)
+    {
+        readErrors++;
+        return false;
+    }
+    xSemaphoreTake(readDone, portMAX_DELAY);
+    if (read.status != 0)
+    {
+        readErrors++;
+        bleLogf("FromRadio read failed rc=%d", read.status);
+        return false;
+    }
+    return buffer.len > 0;
+}
+
+// Scans one record and queues the event it carries, if any.
+static void queueRecord(uint8_t radio, const uint8_t *data, size_t len, uint32_t maxWaitMs)
+{
+    static MeshEvent event;
+    records++;
+    FromRadioView view;
+    if (!scanFromRadio(data, len, view))
+    {
+        decodeErrors++;
+        bleLog("FromRadio decode failed");
+        return;
+    }
+    if (!toEvent(view, radio, event))
+    {
+        return;
+    }
+
+    MeshEvent *slot = waitForSlot(maxWaitMs);
+    if (!slot)
+    {
+        dropped++;
+        bleLog("Ingest queue full, event dropped");
+        return;
+    }
+    memcpy(slot, &event, offsetof(MeshEvent, payload) + event.size);
+    queueCommit();
+    if (event.kind == MeshEventKind::Packet)
+    {
+        packetDedupRecord(event.port, event.from, event.id);
+    }
+}
+
+// Reads and queues one record. Returns false once FromRadio is empty or
+// cannot be read; `trips` counts the GATT reads issued.
+static bool ingestOne(uint8_t radio, uint32_t &trips)
+{
+    PacketBuffer *packet = packetPoolAcquire();
+    if (!packet)
+    {
+        // Leave the rest on the radio until a buffer comes back.
+        return false;
+    }
+    trips++;
+    if (!readFromRadio(radios[radio].fromRadio, *packet))
+    {
+        packetPoolRelease(packet);
+        return false;
+    }
+    queueRecord(radio, packet->data, packet->len, queueFullWaitMs);
+    packetPoolRelease(packet);
+    return true;
+}
+
+// Reads up to drainBatch records from the radio and returns true when it
+// has more. Linked radios take turns a batch at a time, so the merged
+// stream follows arrival order and a packet heard by two radios reaches
+// the duplicate filter twice within a short span.
+static bool drainFromRadio(uint8_t radio)
+{
+    RadioIngest &r = radios[radio];
+    if (r.restart.exchange(false))
+    {
+        r.fromRadio = r.startedFromRadio.load();
+        r.counterSynced = false;
+        r.drainingAll = false;
+        r.drainTrips = 0;
+    }
+    if (!r.fromRadio)
+    {
+        return false;
+    }
+    uint32_t trips = 0;
+    uint32_t read = 0;
+    bool more = false;
+    if ((r.drainAllRequested.exchange(false) || !r.counterSynced) && !r.drainingAll)
+    {
+        // Config handshake or no counter yet: read until empty. Taking the
+        // counter first means a record notified mid-drain is at worst
+        // expected once more, which the resync below absorbs.
+        r.drainingAll = true;
+        r.drainTarget = r.notifiedNum.load();
+    }
+    if (r.drainingAll)
+    {
+        while (read < drainBatch && ingestOne(radio, trips))
+        {
+            read++;
+        }
+        more = read == drainBatch;
+        if (!more)
+        {
+            r.drainingAll = false;
+            emptyReads++;
+            if (r.drainTarget)
+            {
+                r.readNum = r.drainTarget;
+                r.counterSynced = true;
+            }
+        }
+    }
+    else
+    {
+        while (r.readNum != r.notifiedNum.load())
+        {
+            if (read == drainBatch)
+            {
+                more = true;
+                break;
+            }
+            if (!ingestOne(radio, trips))
+            {
+                // FromRadio ran dry before the counter: the two disagree.
+                emptyReads++;
+                resyncs++;
+                r.readNum = r.notifiedNum.load();
+                break;
+            }
+            r.readNum++;
+            read++;
+        }
+    }
+
+    // Trips are counted per drain, across the batches it took.
+    roundTrips += trips;
+    r.drainTrips += trips;
+    if (!more)
+    {
+        drains++;
+        lastDrainTrips = r.drainTrips;
+        if (r.drainTrips > maxDrainTrips.load())
+        {
+            maxDrainTrips = r.drainTrips;
+        }
+        r.drainTrips = 0;
+    }
+    return more;
+}
+
+static void ingestTaskMain(void *)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint8_t pending = pendingRadios.exchange(0);
+        while (pending)
+        {
+            for (uint8_t i = 0; i < meshMaxRadios; i++)
+            {
+                if ((pending & (1 << i)) && !drainFromRadio(i))
+                {
+                    pending &= ~(1 << i);
+                }
+            }
+            pending |= pendingRadios.exchange(0);
+        }
+    }
+}
+
+void meshIngestSetup()
+{
+    statsRegisterProvider(ingestStatsProvider);
+    packetPoolSetup();
+    packetDedupSetup();
+    readDone = xSemaphoreCreateBinary();
+}
+
+static void wakeIngest(uint8_t radio)
+{
+    pendingRadios.fetch_or(1 << radio);
+    if (ingestTask)
+    {
+        xTaskNotifyGive(ingestTask);
+    }
+}
+
+bool meshIngestStart(uint8_t radio, NimBLERemoteCharacteristic *fromRadio)
+{
+    // The task may still be draining the old link, so the restart is
+    // posted to it. FromNum is subscribed only after this, so nothing else
+    // writes the counter yet.
+    RadioIngest &r = radios[radio];
+    r.notifiedNum = 0;
+    r.startedFromRadio = fromRadio;
+    r.restart = true;
+    if (ingestTask)
+    {
+        return true;
+    }
+    if (xTaskCreatePinnedToCore(ingestTaskMain, "meshIngest", ingestStackBytes, nullptr, ingestPriority, &ingestTask,
+                                ingestCore) != pdPASS)
+    {
+        ingestTask = nullptr;
+        bleLog("Ingest task start failed");
+        return false;
+    }
+    return true;
+}
+
+void meshIngestRecord(uint8_t radio, const uint8_t *data, size_t len, uint32_t maxWaitMs)
+{
+    queueRecord(radio, data, len, maxWaitMs);
+}
+
+void meshIngestKick(uint8_t radio)
+{
+    radios[radio].drainAllRequested = true;
+    wakeIngest(radio);
+}
+
+void meshIngestNotify(uint8_t radio, uint32_t fromNum)
+{
+    notifies++;
+    uint32_t previous = radios[radio].notifiedNum.exchange(fromNum);
+    if (previous && fromNum - previous > 1)
+    {
+        lostNotifies += fromNum - previous - 1;
+    }
+    wakeIngest(radio);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+class NimBLERemoteCharacteristic;
+
+// Radios the printer can be linked to at once. Each takes one of NimBLE's
+// connections; the default build has three, one kept for the web UI.
+static const uint8_t meshMaxRadios = 2;
+
+enum class MeshEventKind : uint8_t
+{
+    Packet,
+    Channel,
+    MyInfo,
+    NodeInfo,
+    ConfigComplete,
+    Rebooted
+};
+
+// Compact form of one FromRadio record. Packets keep the decoded payload for
+// the print side to interpret by port; channels carry their index in `from`
+// and their name in `payload`; NodeInfo carries the node number in `from`
+// and its encoded User in `payload`; MyInfo carries the node number in
+// `from` and the radio's node count in `id`; ConfigComplete carries the
+// config id in `id`. Rebooted means the radio restarted under a link that
+// stayed open and its config must be requested again.
+struct MeshEvent
+{
+    MeshEventKind kind;
+    uint8_t channel;
+    uint8_t radio; // which link it came in on; only config handling cares
+    uint16_t port;
+    uint16_t size;
+    uint32_t from;
+    uint32_t to;
+    uint32_t id;
+    uint32_t replyId;
+    uint32_t rxTime;
+    uint8_t payload[233];
+};
+
+// Registers stats and sets up the packet pool and duplicate filter; called
+// once at boot, before either transport starts.
+void meshIngestSetup();
+// Attaches a radio's FromRadio and starts, on first use, the task that reads
+// and decodes FromRadio on the BLE core. Every radio's events go through
+// one bounded single-producer queue to loop(), in the order they were read
+// and with packets heard by more than one radio passed on once.
+bool meshIngestStart(uint8_t radio, NimBLERemoteCharacteristic *fromRadio);
+// Wakes the task to read the radio's FromRadio until it is empty.
+void meshIngestKick(uint8_t radio);
+// Passes on a FromNum notification; the task reads exactly the records the
+// counter says are new. Safe to call from the notify callback.
+void meshIngestNotify(uint8_t radio, uint32_t fromNum);
+// Scans and queues one unframed record from a stream transport. Called from
+// that transport's reader task, the queue's only other producer being idle.
+// A full queue is waited on for at most `maxWaitMs` before the event is
+// dropped, so the reader gets back to its input in time.
+void meshIngestRecord(uint8_t radio, const uint8_t *data, size_t len, uint32_t maxWaitMs);
+bool meshIngestPop(MeshEvent &event);
+// True while events are waiting for loop().
+bool meshIngestPending();
@@ -0,0 +1,653 @@
+#include "MeshLink.h"
+#include "MeshIngest.h"
+#include "SerialLink.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include "../printer/PrinterControl.h"
+#include "../protobufs/mesh.pb.h"
+#include "../nanopb/pb_encode.h"
+#include <NimBLEDevice.h>
+#include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+static const char *targetService = "6ba1b218-15a8-461f-9fa8-5dcae273eafd";
+static const char *uuidFromRadio = "2c55e69e-4993-11ed-b878-0242ac120002";
+static const char *uuidToRadio = "f75c76d2-129e-4dad-a1dd-7866124401e7";
+static const char *uuidFromNum = "ed9da18c-a800-4f66-a670-aa7547e34453";
+
+static const uint32_t connectTimeoutMs = 4000;
+static const uint32_t scanMs = 5000;
+static const uint32_t configTimeoutMs = 10000;
+// FromNum does not announce config records, so ingest is kicked on this
+// cadence until the stream completes. Each kick drains everything queued.
+static const uint32_t configKickMs = 100;
+static const uint32_t backoffFirstMs = 1000;
+static const uint32_t backoffMaxMs = 60000;
+
+// Connecting, securing and service discovery block for seconds, so they run
+// on their own task next to the NimBLE host and loop() keeps printing.
+#ifdef CONFIG_BT_NIMBLE_PINNED_TO_CORE
+static const BaseType_t linkTaskCore = CONFIG_BT_NIMBLE_PINNED_TO_CORE;
+#else
+static const BaseType_t linkTaskCore = 0;
+#endif
+static const UBaseType_t linkTaskPriority = 1;
+static const uint32_t linkTaskStackBytes = 6144;
+
+enum class LinkState : uint8_t
+{
+    Connect, // attempt handed to the link task
+    Configure,
+    Up,
+    Backoff,
+    Off // no name configured for this slot
+};
+
+// Hand-over of one connection attempt between loop() and the link task.
+enum class Attempt : uint8_t
+{
+    Idle,
+    Wanted,    // set by loop(), picked up by the task
+    Attached,  // set by the task once the service is subscribed
+    Failed     // set by the task; the client may still be connected
+};
+
+class LinkCallbacks : public NimBLEClientCallbacks
+{
+public:
+    uint8_t radio;
+
+    void onConnect(NimBLEClient *) override;
+    void onDisconnect(NimBLEClient *, int reason) override;
+    void onPassKeyEntry(NimBLEConnInfo &info) override;
+    void onAuthenticationComplete(NimBLEConnInfo &) override;
+};
+
+// One radio connection. The cached address is the last radio that
+// completed a link in this slot, with the name it was found by so a changed
+// meshName setting falls back to scanning. While an attempt is Wanted the
+// task alone uses the client and characteristics; loop() owns the rest.
+struct Link
+{
+    LinkState state;
+    std::atomic<Attempt> attempt;
+    char name[32];
+    NimBLEClient *client;
+    LinkCallbacks callbacks;
+    NimBLERemoteCharacteristic *fromRadio;
+    NimBLERemoteCharacteristic *toRadio;
+    NimBLERemoteCharacteristic *fromNum;
+    std::atomic<bool> connected;
+    std::atomic<bool> disconnected;
+    bool linkedBefore;
+    volatile bool configDone;
+    uint32_t stateSinceMs;
+    uint32_t lastKickMs;
+    uint32_t backoffMs;
+    uint32_t downSinceMs;
+    bool cacheValid;
+    uint8_t cachedAddr[6];
+    uint8_t cachedType;
+};
+
+volatile bool meshtasticConnected;
+
+static Link links[meshMaxRadios];
+static MeshLinkReadyHandler readyHandler;
+static Preferences linkPrefs;
+static TaskHandle_t linkTask;
+
+static uint32_t connects;
+static uint32_t cachedConnects;
+static uint32_t cacheFailures;
+static uint32_t scans;
+static uint32_t disconnects;
+static uint32_t bondResets;
+static uint32_t lastDowntimeMs;
+static uint32_t maxDowntimeMs;
+static uint32_t totalDowntimeMs;
+
+static void linkStatsProvider(std::string &out)
+{
+    char states[2 * meshMaxRadios];
+    for (uint8_t i = 0; i < meshMaxRadios; i++)
+    {
+        states[2 * i] = '0' + (char)links[i].state;
+        states[2 * i + 1] = i + 1 < meshMaxRadios ? '/' : 0;
+    }
+    statsAppend(out, "link_state", states);
+    statsAppend(out, "link_connects", connects);
+    statsAppend(out, "link_cached_connects", cachedConnects);
+    statsAppend(out, "link_cache_failures", cacheFailures);
+    statsAppend(out, "link_scans", scans);
+    statsAppend(out, "link_disconnects", disconnects);
+    statsAppend(out, "link_bond_resets", bondResets);
+    statsAppend(out, "link_last_downtime_ms", lastDowntimeMs);
+    statsAppend(out, "link_max_downtime_ms", maxDowntimeMs);
+    statsAppend(out, "link_total_downtime_ms", totalDowntimeMs);
+}
+
+static void updateConnected()
+{
+    bool any = false;
+    for (Link &link : links)
+    {
+        any |= link.connected;
+    }
+    meshtasticConnected = any;
+}
+
+void LinkCallbacks::onConnect(NimBLEClient *)
+{
+    links[radio].connected = true;
+    updateConnected();
+    bleLogf("Meshtastic %u connected", radio);
+}
+
+void LinkCallbacks::onDisconnect(NimBLEClient *, int reason)
+{
+    links[radio].connected = false;
+    links[radio].disconnected = true;
+    updateConnected();
+    bleLogf("Meshtastic %u disconnected reason=%d", radio, reason);
+}
+
+void LinkCallbacks::onPassKeyEntry(NimBLEConnInfo &info)
+{
+    bleLog("Passkey requested");
+    uint32_t passkey = atoi(getPrinterSettings().meshPin);
+    NimBLEDevice::injectPassKey(info, passkey);
+}
+
+void LinkCallbacks::onAuthenticationComplete(NimBLEConnInfo &)
+{
+    bleLog("Bonded");
+}
+
+static void enterState(Link &link, LinkState next)
+{
+    link.state = next;
+    link.stateSinceMs = millis();
+}
+
+// Name `radio` is listed under in meshName, trimmed; false when the list
+// is shorter.
+static bool radioName(uint8_t radio, char *out, size_t size)
+{
+    const char *p = getPrinterSettings().meshName;
+    for (uint8_t i = 0; i < radio && p; i++)
+    {
+        p = strchr(p, ',');
+        p = p ? p + 1 : nullptr;
+    }
+    if (!p)
+    {
+        return false;
+    }
+    while (*p == ' ')
+    {
+        p++;
+    }
+    const char *end = strchr(p, ',');
+    size_t len = end ? (size_t)(end - p) : strlen(p);
+    while (len && p[len - 1] == ' ')
+    {
+        len--;
+    }
+    if (!len || len >= size)
+    {
+        return false;
+    }
+    memcpy(out, p, len);
+    out[len] = 0;
+    return true;
+}
+
+static void prefKey(char *key, const char *base, uint8_t radio)
+{
+    snprintf(key, 8, "%s%u", base, radio);
+}
+
+static void loadCachedAddress(uint8_t radio)
+{
+    Link &link = links[radio];
+    char key[8];
+    prefKey(key, "name", radio);
+    String name = linkPrefs.getString(key, "");
+    prefKey(key, "addr", radio);
+    link.cacheValid = !strcmp(name.c_str(), link.name) &&
+                      linkPrefs.getBytes(key, link.cachedAddr, sizeof(link.cachedAddr)) == sizeof(link.cachedAddr);
+    prefKey(key, "type", radio);
+    link.cachedType = linkPrefs.getUChar(key, 0);
+}
+
+static void saveCachedAddress(uint8_t radio, const NimBLEAddress &address)
+{
+    Link &link = links[radio];
+    const uint8_t *base = address.getBase();
+    if (link.cacheValid && !memcmp(base, link.cachedAddr, sizeof(link.cachedAddr)) &&
+        link.cachedType == address.getType())
+    {
+        return;
+    }
+    memcpy(link.cachedAddr, base, sizeof(link.cachedAddr));
+    link.cachedType = address.getType();
+    link.cacheValid = true;
+    char key[8];
+    prefKey(key, "addr", radio);
+    linkPrefs.putBytes(key, link.cachedAddr, sizeof(link.cachedAddr));
+    prefKey(key, "type", radio);
+    linkPrefs.putUChar(key, link.cachedType);
+    prefKey(key, "name", radio);
+    linkPrefs.putString(key, link.name);
+}
+
+static void startBackoff(Link &link)
+{
+    if (link.client->isConnected())
+    {
+        link.client->disconnect();
+    }
+    bleLogf("Reconnect %s in %lu ms", link.name, (unsigned long)link.backoffMs);
+    enterState(link, LinkState::Backoff);
+}
+
+static void onFromNum(NimBLERemoteCharacteristic *c, uint8_t *data, size_t length, bool isNotify)
+{
+    if (!isNotify)
+    {
+        return;
+    }
+    uint8_t radio = 0;
+    while (radio < meshMaxRadios && links[radio].fromNum != c)
+    {
+        radio++;
+    }
+    if (radio == meshMaxRadios)
+    {
+        return;
+    }
+    if (length >= sizeof(uint32_t))
+    {
+        meshIngestNotify(radio, data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24);
+    }
+    else
+    {
+        meshIngestKick(radio);
+    }
+}
+
+// Secures the fresh connection and finds and subscribes the Meshtastic
+// characteristics. Runs on the link task.
+static bool attachService(uint8_t radio)
+{
+    Link &link = links[radio];
+    NimBLEClient *client = link.client;
+    bleLog("Securing");
+    if (!client->secureConnection())
+    {
+        // The radio may have forgotten our bond; pair from scratch.
+        NimBLEAddress peer = client->getPeerAddress();
+        if (NimBLEDevice::isBonded(peer))
+        {
+            bondResets++;
+            NimBLEDevice::deleteBond(peer);
+            bleLog("Stale bond removed");
+        }
+        if (!client->secureConnection())
+        {
+            bleLog("Secure start failed");
+        }
+    }
+
+    NimBLERemoteService *service = client->getService(targetService);
+    if (!service)
+    {
+        bleLog("Service not found");
+        return false;
+    }
+    link.fromRadio = service->getCharacteristic(uuidFromRadio);
+    link.toRadio = service->getCharacteristic(uuidToRadio);
+    link.fromNum = service->getCharacteristic(uuidFromNum);
+    if (!link.fromRadio || !link.toRadio || !link.fromNum || !meshIngestStart(radio, link.fromRadio))
+    {
+        bleLog("Meshtastic characteristics missing");
+        return false;
+    }
+    // Subscribed before the config request so mesh packets that arrive
+    // during the config stream are announced; the config records themselves
+    // are drained by the kicks in loop().
+    if (!link.fromNum->subscribe(true, onFromNum, true))
+    {
+        bleLog("FromNum subscribe failed");
+    }
+    return true;
+}
+
+static bool connectCached(uint8_t radio)
+{
+    Link &link = links[radio];
+    bleLogf("Connecting to saved radio %s", link.name);
+    NimBLEAddress address(link.cachedAddr, link.cachedType);
+    link.disconnected = false;
+    if (link.client->connect(address))
+    {
+        if (attachService(radio))
+        {
+            cachedConnects++;
+            return true;
+        }
+        link.client->disconnect();
+    }
+    cacheFailures++;
+    bleLog("Saved radio did not answer");
+    return false;
+}
+
+// One scan serves every link in `wanted` that is looking for its radio.
+static void scanAndConnect(uint8_t wanted)
+{
+    scans++;
+    NimBLEScan *scan = NimBLEDevice::getScan();
+    scan->setActiveScan(true);
+    NimBLEScanResults results = scan->getResults(scanMs, false);
+    bleLog("Scan completed");
+
+    for (uint8_t radio = 0; radio < meshMaxRadios; radio++)
+    {
+        Link &link = links[radio];
+        if (!(wanted & (1 << radio)))
+        {
+            continue;
+        }
+        const NimBLEAdvertisedDevice *found = nullptr;
+        for (int i = 0; i < results.getCount() && !found; ++i)
+        {
+            const NimBLEAdvertisedDevice *device = results.getDevice(i);
+            if (device->getName() == link.name)
+            {
+                found = device;
+            }
+        }
+        if (!found)
+        {
+            bleLogf("Target %s not found", link.name);
+            link.attempt = Attempt::Failed;
+            continue;
+        }
+        bleLogf("Target %s %s", found->getAddress().toString().c_str(), link.name);
+        bleLog("Connecting");
+        // The disconnect of a failed attempt before the scan may have landed
+        // since; it must not end this connection.
+        link.disconnected = false;
+        link.attempt = link.client->connect(found) && attachService(radio) ? Attempt::Attached : Attempt::Failed;
+    }
+}
+
+// Works through the attempts loop() hands over: saved addresses first, then
+// one scan for the links whose radio did not answer there.
+static void linkTaskMain(void *)
+{
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint8_t scanWanted = 0;
+        for (uint8_t radio = 0; radio < meshMaxRadios; radio++)
+        {
+            Link &link = links[radio];
+            if (link.attempt != Attempt::Wanted)
+            {
+                continue;
+            }
+            // A radio that moved or changed address is looked up by name.
+            if (link.cacheValid && connectCached(radio))
+            {
+                link.attempt = Attempt::Attached;
+            }
+            else
+            {
+                scanWanted |= 1 << radio;
+            }
+        }
+        if (scanWanted)
+        {
+            scanAndConnect(scanWanted);
+        }
+    }
+}
+
+// Brings a slot in or out of use as names are added to or removed from
+// meshName; a slot keeps its client once created.
+static void startLink(uint8_t radio)
+{
+    Link &link = links[radio];
+    if (!radioName(radio, link.name, sizeof(link.name)))
+    {
+        enterState(link, LinkState::Off);
+        return;
+    }
+    if (!link.client)
+    {
+        link.callbacks.radio = radio;
+        link.client = NimBLEDevice::createClient();
+        link.client->setClientCallbacks(&link.callbacks, false);
+        link.client->setConnectTimeout(connectTimeoutMs);
+    }
+    loadCachedAddress(radio);
+    enterState(link, LinkState::Connect);
+    link.attempt = Attempt::Wanted;
+    xTaskNotifyGive(linkTask);
+}
+
+// Takes over a link the task has attached and hands it to the sketch to
+// request the config stream.
+static void linkAttached(uint8_t radio)
+{
+    Link &link = links[radio];
+    statsBootMark("connect");
+    saveCachedAddress(radio, link.client->getPeerAddress());
+    connects++;
+    link.configDone = false;
+    link.lastKickMs = 0;
+    // Entered first so the handler's config request can be sent.
+    enterState(link, LinkState::Configure);
+    readyHandler(radio, link.client, !link.linkedBefore);
+    link.linkedBefore = true;
+}
+
+static void linkLive(Link &link)
+{
+    statsBootMark("live");
+    if (link.downSinceMs)
+    {
+        lastDowntimeMs = millis() - link.downSinceMs;
+        totalDowntimeMs += lastDowntimeMs;
+        if (lastDowntimeMs > maxDowntimeMs)
+        {
+            maxDowntimeMs = lastDowntimeMs;
+        }
+        link.downSinceMs = 0;
+        bleLogf("Link %s back after %lu ms", link.name, (unsigned long)lastDowntimeMs);
+    }
+    link.backoffMs = backoffFirstMs;
+    enterState(link, LinkState::Up);
+}
+
+void meshLinkSetup(MeshLinkReadyHandler onReady)
+{
+    readyHandler = onReady;
+    statsRegisterProvider(linkStatsProvider);
+    for (Link &link : links)
+    {
+        link.backoffMs = backoffFirstMs;
+        enterState(link, LinkState::Off);
+    }
+#ifdef MESH_SERIAL_TRANSPORT
+    Link &link = links[meshPrimaryRadio];
+    strlcpy(link.name, "UART2", sizeof(link.name));
+    if (serialLinkBegin())
+    {
+        link.connected = true;
+        meshtasticConnected = true;
+        connects++;
+        enterState(link, LinkState::Configure);
+        readyHandler(meshPrimaryRadio, nullptr, true);
+        link.linkedBefore = true;
+    }
+    return;
+#endif
+    linkPrefs.begin("meshlink", false);
+    if (xTaskCreatePinnedToCore(linkTaskMain, "meshLink", linkTaskStackBytes, nullptr, linkTaskPriority, &linkTask,
+                                linkTaskCore) != pdPASS)
+    {
+        linkTask = nullptr;
+        bleLog("Link task start failed");
+        return;
+    }
+    for (uint8_t radio = 0; radio < meshMaxRadios; radio++)
+    {
+        startLink(radio);
+    }
+}
+
+void meshLinkLoop()
+{
+#ifdef MESH_SERIAL_TRANSPORT
+    // The stream delivers records as they come; only the timeout applies.
+    serialLinkLoop();
+    Link &serial = links[meshPrimaryRadio];
+    if (serial.state == LinkState::Configure &&
+        (serial.configDone || millis() - serial.stateSinceMs >= configTimeoutMs))
+    {
+        linkLive(serial);
+    }
+    return;
+#endif
+    if (!linkTask)
+    {
+        return;
+    }
+    for (uint8_t radio = 0; radio < meshMaxRadios; radio++)
+    {
+        Link &link = links[radio];
+        // Left alone while connecting; the task clears it before connect().
+        if ((link.state == LinkState::Up || link.state == LinkState::Configure) && link.disconnected.exchange(false))
+        {
+            disconnects++;
+            link.downSinceMs = millis();
+            link.backoffMs = backoffFirstMs;
+            startBackoff(link);
+            continue;
+        }
+
+        uint32_t now = millis();
+        switch (link.state)
+        {
+        case LinkState::Connect:
+            if (link.attempt == Attempt::Attached)
+            {
+                link.attempt = Attempt::Idle;
+                linkAttached(radio);
+            }
+            else if (link.attempt == Attempt::Failed)
+            {
+                link.attempt = Attempt::Idle;
+                startBackoff(link);
+            }
+            break;
+
+        case LinkState::Configure:
+            if (link.configDone || now - link.stateSinceMs >= configTimeoutMs)
+            {
+                linkLive(link);
+            }
+            else if (now - link.lastKickMs >= configKickMs)
+            {
+                link.lastKickMs = now;
+                meshIngestKick(radio);
+            }
+            break;
+
+        case LinkState::Backoff:
+            if (now - link.stateSinceMs >= link.backoffMs)
+            {
+                link.backoffMs = link.backoffMs * 2 > backoffMaxMs ? backoffMaxMs : link.backoffMs * 2;
+                startLink(radio);
+            }
+            break;
+
+        case LinkState::Off:
+            // Picks up a name added to the setting since boot.
+            if (now - link.stateSinceMs >= backoffMaxMs)
+            {
+                startLink(radio);
+            }
+            break;
+
+        case LinkState::Up:
+            break;
+        }
+    }
+}
+
+void meshLinkConfigDone(uint8_t radio)
+{
+    links[radio].configDone = true;
+}
+
+bool meshLinkUp()
+{
+    for (Link &link : links)
+    {
+        if (link.state == LinkState::Up)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool meshLinkSend(uint8_t radio, const uint8_t *data, size_t len)
+{
+    Link &link = links[radio];
+    if (link.state != LinkState::Up && link.state != LinkState::Configure)
+    {
+        return false;
+    }
+#ifdef MESH_SERIAL_TRANSPORT
+    return serialLinkSend(data, len);
+#else
+    return link.toRadio && link.toRadio->writeValue(data, len, true);
+#endif
+}
+
+bool meshLinkSendData(uint32_t to, uint8_t channel, uint16_t port, const uint8_t *payload, size_t len)
+{
+    static uint32_t packetId = 0;
+    if (packetId == 0)
+    {
+        packetId = millis();
+    }
+
+    meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
+    req.which_payload_variant = meshtastic_ToRadio_packet_tag;
+    meshtastic_MeshPacket &p = req.packet;
+    p.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p.to = to;
+    p.id = ++packetId;
+    p.channel = channel;
+    p.decoded.portnum = (meshtastic_PortNum)port;
+    p.decoded.payload.size = len < sizeof(p.decoded.payload.bytes) ? len : sizeof(p.decoded.payload.bytes);
+    memcpy(p.decoded.payload.bytes, payload, p.decoded.payload.size);
+
+    uint8_t buffer[meshtastic_ToRadio_size];
+    pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
+    if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
+    {
+        bleLog("Packet encode failed");
+        return false;
+    }
+    return meshLinkSend(meshPrimaryRadio, buffer, ostream.bytes_written);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Arduino.h>
+
+class NimBLEClient;
+
+// Called once a radio's Meshtastic service is found, to request the config
+// stream; `firstLink` is set on that radio's first connection since boot.
+// `client` is null when the radio is wired to UART2.
+typedef void (*MeshLinkReadyHandler)(uint8_t radio, NimBLEClient *client, bool firstLink);
+
+// The radio whose channels and node table the printer mirrors, and that
+// outgoing messages are sent through.
+static const uint8_t meshPrimaryRadio = 0;
+
+// Connection manager for the radio links, one per comma-separated name in
+// the meshName setting (up to meshMaxRadios). Each connects straight to the
+// address saved from its last successful link, and radios that do not
+// answer are looked up together in one scan by name. Connecting runs on a
+// background task; loop() only steps the link states. After a disconnect a
+// link reconnects with exponential backoff while the others stay up. With
+// MESH_SERIAL_TRANSPORT the only radio is on UART2 and the link is
+// configured once at boot instead.
+void meshLinkSetup(MeshLinkReadyHandler onReady);
+void meshLinkLoop();
+// Marks the radio's config stream as complete; its link counts as up from
+// here.
+void meshLinkConfigDone(uint8_t radio);
+// True while any radio's link is up.
+bool meshLinkUp();
+// Writes one encoded ToRadio record to the radio over whichever transport
+// is in use. Fails while that radio's link is down.
+bool meshLinkSend(uint8_t radio, const uint8_t *data, size_t len);
+// Sends a Data payload on `port` as a fresh MeshPacket through the primary
+// radio.
+bool meshLinkSendData(uint32_t to, uint8_t channel, uint16_t port, const uint8_t *payload, size_t len);
@@ -0,0 +1,314 @@
+#include "NodeDb.h"
+#include "FromRadioScan.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include <Preferences.h>
+#include <string.h>
+
+static const uint8_t capacity = 128;
+static const uint8_t noNode = 0xFF;
+// num -> slot, open addressing with linear probing; twice the capacity
+// keeps probe runs short.
+static const uint16_t indexSize = 256;
+static const uint32_t saveIntervalMs = 10 * 60 * 1000;
+static const uint8_t blobVersion = 1;
+
+// Names are stored once, inline, at the protobuf field limits.
+struct NodeEntry
+{
+    uint32_t num;
+    uint8_t prev;
+    uint8_t next;
+    char shortName[5];
+    char longName[40];
+};
+
+struct SavedNode
+{
+    uint32_t num;
+    char shortName[5];
+    char longName[40];
+};
+
+static NodeEntry nodes[capacity];
+static uint8_t nodeCount;
+static uint8_t nodeIndex[indexSize];
+// Doubly linked recency list through prev/next; head is the most recent.
+static uint8_t lruHead = noNode;
+static uint8_t lruTail = noNode;
+
+static Preferences nodePrefs;
+static bool dirty;
+static uint32_t lastSaveMs;
+
+static uint32_t nodeLookups;
+static uint32_t nodeMisses;
+static uint32_t nodeEvictions;
+static uint32_t nodeSaves;
+
+static void nodeStatsProvider(std::string &out)
+{
+    statsAppend(out, "nodes", nodeCount);
+    statsAppend(out, "node_lookups", nodeLookups);
+    statsAppend(out, "node_misses", nodeMisses);
+    statsAppend(out, "node_evictions", nodeEvictions);
+    statsAppend(out, "node_saves", nodeSaves);
+}
+
+static uint16_t homeSlot(uint32_t num)
+{
+    return (uint16_t)((num * 0x9E3779B1u) >> 24);
+}
+
+static uint16_t findIndex(uint32_t num)
+{
+    uint16_t i = homeSlot(num);
+    while (nodeIndex[i] != noNode)
+    {
+        if (nodes[nodeIndex[i]].num == num)
+        {
+            return i;
+        }
+        i = (i + 1) & (indexSize - 1);
+    }
+    return indexSize;
+}
+
+static void indexInsert(uint32_t num, uint8_t slot)
+{
+    uint16_t i = homeSlot(num);
+    while (nodeIndex[i] != noNode)
+    {
+        i = (i + 1) & (indexSize - 1);
+    }
+    nodeIndex[i] = slot;
+}
+
+// Backward-shift deletion keeps every remaining entry reachable from its
+// home slot without tombstones.
+static void indexRemove(uint16_t i)
+{
+    uint16_t hole = i;
+    uint16_t j = i;
+    while (true)
+    {
+        j = (j + 1) & (indexSize - 1);
+        if (nodeIndex[j] == noNode)
+        {
+            break;
+        }
+        uint16_t home = homeSlot(nodes[nodeIndex[j]].num);
+        // Move j into the hole unless its home lies cyclically in (hole, j].
+        bool stays = hole <= j ? (home > hole && home <= j) : (home > hole || home <= j);
+        if (!stays)
+        {
+            nodeIndex[hole] = nodeIndex[j];
+            hole = j;
+        }
+    }
+    nodeIndex[hole] = noNode;
+}
+
+static void lruUnlink(uint8_t slot)
+{
+    NodeEntry &n = nodes[slot];
+    if (n.prev != noNode)
+    {
+        nodes[n.prev].next = n.next;
+    }
+    else
+    {
+        lruHead = n.next;
+    }
+    if (n.next != noNode)
+    {
+        nodes[n.next].prev = n.prev;
+    }
+    else
+    {
+        lruTail = n.prev;
+    }
+}
+
+static void lruPushFront(uint8_t slot)
+{
+    NodeEntry &n = nodes[slot];
+    n.prev = noNode;
+    n.next = lruHead;
+    if (lruHead != noNode)
+    {
+        nodes[lruHead].prev = slot;
+    }
+    lruHead = slot;
+    if (lruTail == noNode)
+    {
+        lruTail = slot;
+    }
+}
+
+static void touch(uint8_t slot)
+{
+    if (slot != lruHead)
+    {
+        lruUnlink(slot);
+        lruPushFront(slot);
+    }
+}
+
+static NodeEntry &findOrAdd(uint32_t num)
+{
+    uint16_t i = findIndex(num);
+    if (i != indexSize)
+    {
+        touch(nodeIndex[i]);
+        return nodes[nodeIndex[i]];
+    }
+
+    uint8_t slot;
+    if (nodeCount < capacity)
+    {
+        slot = nodeCount++;
+    }
+    else
+    {
+        slot = lruTail;
+        lruUnlink(slot);
+        indexRemove(findIndex(nodes[slot].num));
+        nodeEvictions++;
+    }
+    NodeEntry &n = nodes[slot];
+    memset(&n, 0, sizeof(n));
+    n.num = num;
+    indexInsert(num, slot);
+    lruPushFront(slot);
+    return n;
+}
+
+static void copyName(char *dst, size_t size, const uint8_t *src, size_t len)
+{
+    if (len >= size)
+    {
+        // Cut before the sequence the limit falls in, so the name does not
+        // end in half a character.
+        len = size - 1;
+        while (len && (src[len] & 0xC0) == 0x80)
+        {
+            len--;
+        }
+    }
+    memcpy(dst, src, len);
+    dst[len] = 0;
+}
+
+void nodeDbUpdateUser(uint32_t num, const uint8_t *user, size_t len)
+{
+    const uint8_t *longName;
+    const uint8_t *shortName;
+    size_t longLen;
+    size_t shortLen;
+    if (!num || !scanUserNames(user, len, longName, longLen, shortName, shortLen))
+    {
+        return;
+    }
+    NodeEntry &n = findOrAdd(num);
+    char longBuf[sizeof(n.longName)];
+    char shortBuf[sizeof(n.shortName)];
+    copyName(longBuf, sizeof(longBuf), longName, longLen);
+    copyName(shortBuf, sizeof(shortBuf), shortName, shortLen);
+    if (strcmp(longBuf, n.longName) || strcmp(shortBuf, n.shortName))
+    {
+        memcpy(n.longName, longBuf, sizeof(longBuf));
+        memcpy(n.shortName, shortBuf, sizeof(shortBuf));
+        dirty = true;
+    }
+}
+
+const char *nodeDbName(uint32_t num)
+{
+    nodeLookups++;
+    uint16_t i = findIndex(num);
+    if (i == indexSize)
+    {
+        nodeMisses++;
+        return nullptr;
+    }
+    uint8_t slot = nodeIndex[i];
+    touch(slot);
+    const NodeEntry &n = nodes[slot];
+    if (n.longName[0])
+    {
+        return n.longName;
+    }
+    return n.shortName[0] ? n.shortName : nullptr;
+}
+
+// Saved oldest first so loading re-creates the recency order.
+static void saveNodes()
+{
+    static SavedNode saved[capacity];
+    uint8_t count = 0;
+    for (uint8_t slot = lruTail; slot != noNode; slot = nodes[slot].prev)
+    {
+        SavedNode &s = saved[count++];
+        s.num = nodes[slot].num;
+        memcpy(s.shortName, nodes[slot].shortName, sizeof(s.shortName));
+        memcpy(s.longName, nodes[slot].longName, sizeof(s.longName));
+    }
+    nodePrefs.putUChar("version", blobVersion);
+    nodePrefs.putBytes("nodes", saved, count * sizeof(SavedNode));
+    nodeSaves++;
+    dirty = false;
+}
+
+static void loadNodes()
+{
+    static SavedNode saved[capacity];
+    if (nodePrefs.getUChar("version", 0) != blobVersion)
+    {
+        return;
+    }
+    size_t bytes = nodePrefs.getBytes("nodes", saved, sizeof(saved));
+    size_t count = bytes / sizeof(SavedNode);
+    for (size_t i = 0; i < count; i++)
+    {
+        NodeEntry &n = findOrAdd(saved[i].num);
+        memcpy(n.shortName, saved[i].shortName, sizeof(n.shortName));
+        memcpy(n.longName, saved[i].longName, sizeof(n.longName));
+        n.shortName[sizeof(n.shortName) - 1] = 0;
+        n.longName[sizeof(n.longName) - 1] = 0;
+    }
+    bleLogf("NodeDb loaded %u nodes", (unsigned)count);
+}
+
+void nodeDbSetup()
+{
+    memset(nodeIndex, noNode, sizeof(nodeIndex));
+    statsRegisterProvider(nodeStatsProvider);
+    if (nodePrefs.begin("nodedb", false))
+    {
+        loadNodes();
+    }
+    lastSaveMs = millis();
+}
+
+void nodeDbLoop()
+{
+    if (dirty && millis() - lastSaveMs >= saveIntervalMs)
+    {
+        nodeDbSave();
+    }
+}
+
+void nodeDbSave()
+{
+    if (dirty)
+    {
+        lastSaveMs = millis();
+        saveNodes();
+    }
+}
+
+uint8_t nodeDbCount()
+{
+    return nodeCount;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Fixed-capacity table of node names, filled from the NodeInfo records of
+// the config stream and from live NODEINFO_APP packets. The least recently
+// used node makes room when the table is full, and the table is saved to
+// flash so names are known right after a reboot.
+void nodeDbSetup();
+// Saves pending changes, at most once per save interval.
+void nodeDbLoop();
+// Updates a node from an encoded meshtastic_User message.
+void nodeDbUpdateUser(uint32_t num, const uint8_t *user, size_t len);
+// Long name of the node, or its short name when it has no long name, or
+// nullptr when unknown. Marks the node as recently used.
+const char *nodeDbName(uint32_t num);
+uint8_t nodeDbCount();
+// Saves pending changes now, e.g. once a node download completes.
+void nodeDbSave();
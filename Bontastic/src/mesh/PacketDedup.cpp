@@ -0,0 +1,117 @@
+#include "PacketDedup.h"
+#include "../printer/DeviceStats.h"
+#include "../protobufs/portnums.pb.h"
+
+// Open addressing with a bounded probe window. Expired entries are reused
+// by inserts but never end a lookup early, so no tombstones are needed; a
+// full window evicts its oldest entry.
+static const uint16_t tableSize = 256; // power of two, 3 KB
+static const uint8_t probeWindow = 8;
+static const uint32_t expiryMs = 10 * 60 * 1000;
+
+struct DedupEntry
+{
+    uint32_t from;
+    uint32_t id;
+    uint32_t seenMs;
+};
+
+static DedupEntry table[tableSize];
+
+static uint32_t lookups;
+static uint32_t hits;
+static uint32_t evictions;
+
+static void dedupStatsProvider(std::string &out)
+{
+    statsAppend(out, "dedup_lookups", lookups);
+    statsAppend(out, "dedup_hits", hits);
+    statsAppend(out, "dedup_hit_rate_pct", lookups ? (uint32_t)((uint64_t)hits * 100 / lookups) : 0);
+    statsAppend(out, "dedup_evictions", evictions);
+}
+
+void packetDedupSetup()
+{
+    statsRegisterProvider(dedupStatsProvider);
+}
+
+static uint16_t slotFor(uint32_t from, uint32_t id)
+{
+    uint32_t h = from * 0x9E3779B1u ^ id;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h & (tableSize - 1);
+}
+
+static bool exempt(uint16_t port, uint32_t id)
+{
+    return !id || port == meshtastic_PortNum_STORE_FORWARD_APP;
+}
+
+static bool expired(const DedupEntry &e, uint32_t now)
+{
+    return !e.id || now - e.seenMs >= expiryMs;
+}
+
+bool packetDedupSeen(uint16_t port, uint32_t from, uint32_t id)
+{
+    if (exempt(port, id))
+    {
+        return false;
+    }
+    lookups++;
+    uint32_t now = millis();
+    uint16_t start = slotFor(from, id);
+    for (uint8_t i = 0; i < probeWindow; i++)
+    {
+        const DedupEntry &e = table[(start + i) & (tableSize - 1)];
+        if (!expired(e, now) && e.from == from && e.id == id)
+        {
+            hits++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void packetDedupRecord(uint16_t port, uint32_t from, uint32_t id)
+{
+    if (exempt(port, id))
+    {
+        return;
+    }
+    uint32_t now = millis();
+    uint16_t start = slotFor(from, id);
+    int16_t freeSlot = -1;
+    uint16_t oldest = start;
+    for (uint8_t i = 0; i < probeWindow; i++)
+    {
+        uint16_t slot = (start + i) & (tableSize - 1);
+        DedupEntry &e = table[slot];
+        if (expired(e, now))
+        {
+            if (freeSlot < 0)
+            {
+                freeSlot = slot;
+            }
+            continue;
+        }
+        if (e.from == from && e.id == id)
+        {
+            e.seenMs = now;
+            return;
+        }
+        if (now - e.seenMs > now - table[oldest].seenMs)
+        {
+            oldest = slot;
+        }
+    }
+
+    if (freeSlot < 0)
+    {
+        evictions++;
+        freeSlot = oldest;
+    }
+    table[freeSlot] = {from, id, now};
+}
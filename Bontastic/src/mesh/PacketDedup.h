@@ -0,0 +1,16 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Remembers recently seen (from, id) pairs so a packet replayed after a
+// reconnect or delivered by a second radio is handled only once.
+void packetDedupSetup();
+// Returns true when the packet was recorded within the expiry window.
+// Packets without an id are never treated as duplicates, and neither are
+// Store & Forward replays: the router resends history with the original
+// sender and id, and the messages a catch-up is for were often heard live
+// while nothing could print. The S&F client filters its replays itself.
+bool packetDedupSeen(uint16_t port, uint32_t from, uint32_t id);
+// Records a packet once it has been handed on; a packet dropped before
+// that can still arrive again and be handled.
+void packetDedupRecord(uint16_t port, uint32_t from, uint32_t id);
@@ -0,0 +1,64 @@
+#include "PacketPool.h"
+#include "../printer/DeviceStats.h"
+#include <atomic>
+
+static const uint8_t poolSize = 4;
+static PacketBuffer pool[poolSize];
+// Bit i set while pool[i] is handed out.
+static std::atomic<uint8_t> inUse;
+
+static std::atomic<uint32_t> acquired;
+static std::atomic<uint32_t> exhausted;
+static std::atomic<uint32_t> highWater;
+
+static void poolStatsProvider(std::string &out)
+{
+    statsAppend(out, "pool_acquired", acquired.load());
+    statsAppend(out, "pool_exhausted", exhausted.load());
+    statsAppend(out, "pool_in_use_hwm", highWater.load());
+}
+
+void packetPoolSetup()
+{
+    statsRegisterProvider(poolStatsProvider);
+}
+
+PacketBuffer *packetPoolAcquire()
+{
+    uint8_t mask = inUse.load(std::memory_order_relaxed);
+    while (true)
+    {
+        uint8_t slot = 0;
+        while (slot < poolSize && (mask & (1u << slot)))
+        {
+            slot++;
+        }
+        if (slot == poolSize)
+        {
+            exhausted++;
+            return nullptr;
+        }
+        uint8_t taken = mask | (uint8_t)(1u << slot);
+        if (inUse.compare_exchange_weak(mask, taken, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            acquired++;
+            uint32_t count = __builtin_popcount(taken);
+            if (count > highWater.load(std::memory_order_relaxed))
+            {
+                highWater.store(count, std::memory_order_relaxed);
+            }
+            pool[slot].len = 0;
+            return &pool[slot];
+        }
+    }
+}
+
+void packetPoolRelease(PacketBuffer *buffer)
+{
+    if (!buffer)
+    {
+        return;
+    }
+    uint8_t slot = (uint8_t)(buffer - pool);
+    inUse.fetch_and((uint8_t)~(1u << slot), std::memory_order_release);
+}
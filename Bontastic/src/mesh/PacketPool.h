@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../protobufs/mesh.pb.h"
+
+// One encoded FromRadio record, filled straight from the GATT read.
+struct PacketBuffer
+{
+    uint16_t len;
+    uint8_t data[meshtastic_FromRadio_size];
+};
+
+// Fixed pool of packet buffers so ingest runs without heap allocations.
+// Acquire returns nullptr when every buffer is in use.
+PacketBuffer *packetPoolAcquire();
+void packetPoolRelease(PacketBuffer *buffer);
+void packetPoolSetup();
@@ -0,0 +1,116 @@
+#include "PortRegistry.h"
+#include "MeshIngest.h"
+#include "../printer/DeviceStats.h"
+#include <atomic>
+#include <stdio.h>
+
+// Port numbers are below 512 (meshtastic_PortNum_MAX).
+static const uint16_t portCount = 512;
+static const uint8_t maxRoutes = 24;
+static const uint8_t noRoute = 0xFF;
+
+struct PortStats
+{
+    std::atomic<uint32_t> dropped; // ingest task
+    uint32_t handled;              // loop()
+    uint64_t totalUs; // 32 bits wrap after 71 minutes of handler time
+    uint32_t maxUs;
+};
+
+static const PortRoute *routes;
+static uint8_t routeCount;
+static const PortRoute *otherRoute;
+// Route index for every port, so both lookups are a single load.
+static uint8_t routeOf[portCount];
+// One slot per route, the last for `other`.
+static PortStats stats[maxRoutes + 1];
+
+static uint8_t routeIndex(uint32_t port)
+{
+    uint8_t index = port < portCount ? routeOf[port] : noRoute;
+    return index == noRoute ? maxRoutes : index;
+}
+
+static const PortRoute &routeAt(uint8_t index)
+{
+    return index == maxRoutes ? *otherRoute : routes[index];
+}
+
+static void portStatsProvider(std::string &out)
+{
+    char key[24];
+    char value[64];
+    for (uint8_t i = 0; i <= maxRoutes; i++)
+    {
+        if (i >= routeCount && i != maxRoutes)
+        {
+            continue;
+        }
+        const PortStats &s = stats[i];
+        uint32_t dropped = s.dropped.load();
+        if (!s.handled && !dropped)
+        {
+            continue;
+        }
+        snprintf(key, sizeof(key), "port_%s", routeAt(i).name);
+        snprintf(value, sizeof(value), "%lu/%lu/%llu/%lu", (unsigned long)s.handled, (unsigned long)dropped,
+                 (unsigned long long)s.totalUs, (unsigned long)s.maxUs);
+        statsAppend(out, key, value);
+    }
+}
+
+void portRegistrySetup(const PortRoute *table, size_t count, const PortRoute &other)
+{
+    routes = table;
+    routeCount = count < maxRoutes ? count : maxRoutes;
+    otherRoute = &other;
+    memset(routeOf, noRoute, sizeof(routeOf));
+    for (uint8_t i = 0; i < routeCount; i++)
+    {
+        if (routes[i].port < portCount)
+        {
+            routeOf[routes[i].port] = i;
+        }
+    }
+    statsRegisterProvider(portStatsProvider);
+}
+
+bool portWanted(uint32_t port)
+{
+    if (!otherRoute)
+    {
+        return true;
+    }
+    uint8_t index = routeIndex(port);
+    if (routeAt(index).enabled)
+    {
+        return true;
+    }
+    stats[index].dropped++;
+    return false;
+}
+
+void portDispatch(const MeshEvent &event)
+{
+    if (!otherRoute)
+    {
+        return;
+    }
+    uint8_t index = routeIndex(event.port);
+    const PortRoute &route = routeAt(index);
+    if (!route.handler)
+    {
+        return;
+    }
+    uint32_t start = micros();
+    route.handler(event);
+    uint32_t us = micros() - start;
+
+    PortStats &s = stats[index];
+    s.handled++;
+    s.totalUs += us;
+    if (us > s.maxUs)
+    {
+        s.maxUs = us;
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Arduino.h>
+
+struct MeshEvent;
+
+typedef void (*PortHandler)(const MeshEvent &event);
+
+// One entry of the sketch's port table. Disabled ports are dropped by the
+// ingest task as soon as the packet's portnum is known, before the payload
+// is copied, the packet is checked for duplicates or anything is logged.
+struct PortRoute
+{
+    uint16_t port;
+    bool enabled;
+    PortHandler handler;
+    const char *name; // stats key, "port_<name>"
+};
+
+// Takes the sketch's constant port table; `other` covers every port the
+// table does not list. Both must outlive the registry. Stats report, per
+// route that saw traffic, "port_<name>=handled/dropped/total_us/max_us".
+void portRegistrySetup(const PortRoute *routes, size_t count, const PortRoute &other);
+// Cheap check for the ingest task; counts the drop when it says no.
+bool portWanted(uint32_t port);
+// Runs and times the handler for a packet event on loop().
+void portDispatch(const MeshEvent &event);
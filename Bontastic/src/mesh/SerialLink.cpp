@@ -0,0 +1,221 @@
+#include "SerialLink.h"
+#include "MeshIngest.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include "../protobufs/mesh.pb.h"
+#include "../nanopb/pb_encode.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+// Sits beside the BLE ingest task; loop() stays free for printing.
+static const BaseType_t readerCore = 0;
+static const UBaseType_t readerPriority = 3;
+static const uint32_t readerStackBytes = 4096;
+// About 90 ms of traffic at meshSerialBaud.
+static const size_t rxBufferBytes = 8192;
+static const uint32_t idlePollMs = 2;
+// A full ingest queue holds the reader for at most about half of what the
+// RX buffer covers. Dropping that event is cheaper than an overrun, which
+// corrupts the frames around it.
+static const uint32_t queueWaitMs = rxBufferBytes * 10 * 1000 / meshSerialBaud / 2;
+
+// The radio drops a serial client it has not heard from in 15 minutes.
+static const uint32_t heartbeatMs = 5 * 60 * 1000;
+// Start bytes with no frame after them; the radio discards them, but they
+// bring its serial API out of light sleep before the first real frame.
+static const size_t wakeBytes = 32;
+
+enum class FrameState : uint8_t
+{
+    Start1,
+    Start2,
+    LengthHigh,
+    LengthLow,
+    Body
+};
+
+// Bytes outside a frame are the radio's debug log, if it has one enabled,
+// and are skipped until the next start pair.
+struct Framer
+{
+    FrameState state;
+    uint16_t len;
+    uint16_t pos;
+    uint8_t frame[meshFrameMaxBytes];
+};
+
+static Framer framer;
+static TaskHandle_t readerTask;
+static uint32_t lastSendMs;
+
+static std::atomic<uint32_t> rxFrames;
+static std::atomic<uint32_t> rxBytes;
+static std::atomic<uint32_t> skippedBytes;
+static std::atomic<uint32_t> badLengths;
+static uint32_t txFrames;
+static uint32_t txErrors;
+
+static void serialStatsProvider(std::string &out)
+{
+    statsAppend(out, "serial_rx_frames", rxFrames.load());
+    statsAppend(out, "serial_rx_bytes", rxBytes.load());
+    statsAppend(out, "serial_skipped_bytes", skippedBytes.load());
+    statsAppend(out, "serial_bad_lengths", badLengths.load());
+    statsAppend(out, "serial_tx_frames", txFrames);
+    statsAppend(out, "serial_tx_errors", txErrors);
+}
+
+// Feeds one byte; returns true when it completes a frame.
+static bool framerPush(Framer &f, uint8_t b)
+{
+    switch (f.state)
+    {
+    case FrameState::Start1:
+        if (b == meshFrameStart1)
+        {
+            f.state = FrameState::Start2;
+        }
+        else
+        {
+            skippedBytes++;
+        }
+        return false;
+
+    case FrameState::Start2:
+        if (b == meshFrameStart2)
+        {
+            f.state = FrameState::LengthHigh;
+        }
+        else
+        {
+            skippedBytes++;
+            f.state = b == meshFrameStart1 ? FrameState::Start2 : FrameState::Start1;
+        }
+        return false;
+
+    case FrameState::LengthHigh:
+        f.len = (uint16_t)b << 8;
+        f.state = FrameState::LengthLow;
+        return false;
+
+    case FrameState::LengthLow:
+        f.len |= b;
+        f.pos = 0;
+        if (f.len == 0 || f.len > sizeof(f.frame))
+        {
+            // A start pair inside log text; hunt for the next one.
+            badLengths++;
+            f.state = FrameState::Start1;
+            return false;
+        }
+        f.state = FrameState::Body;
+        return false;
+
+    case FrameState::Body:
+        f.frame[f.pos++] = b;
+        if (f.pos < f.len)
+        {
+            return false;
+        }
+        f.state = FrameState::Start1;
+        return true;
+    }
+    return false;
+}
+
+static void readerTaskMain(void *)
+{
+    static uint8_t chunk[128];
+    while (true)
+    {
+        int available = Serial2.available();
+        if (available <= 0)
+        {
+            vTaskDelay(pdMS_TO_TICKS(idlePollMs));
+            continue;
+        }
+        size_t n = Serial2.readBytes(chunk, (size_t)available < sizeof(chunk) ? (size_t)available : sizeof(chunk));
+        rxBytes += n;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (framerPush(framer, chunk[i]))
+            {
+                rxFrames++;
+                meshIngestRecord(0, framer.frame, framer.len, queueWaitMs);
+            }
+        }
+    }
+}
+
+static bool sendHeartbeat()
+{
+    meshtastic_ToRadio req = meshtastic_ToRadio_init_zero;
+    req.which_payload_variant = meshtastic_ToRadio_heartbeat_tag;
+    req.heartbeat = meshtastic_Heartbeat_init_zero;
+
+    uint8_t buffer[16];
+    pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
+    if (!pb_encode(&ostream, meshtastic_ToRadio_fields, &req))
+    {
+        return false;
+    }
+    return serialLinkSend(buffer, ostream.bytes_written);
+}
+
+bool serialLinkBegin()
+{
+    if (readerTask)
+    {
+        return true;
+    }
+    statsRegisterProvider(serialStatsProvider);
+    Serial2.setRxBufferSize(rxBufferBytes);
+    Serial2.begin(meshSerialBaud, SERIAL_8N1, meshSerialRxPin, meshSerialTxPin);
+
+    uint8_t wake[wakeBytes];
+    memset(wake, meshFrameStart2, sizeof(wake));
+    Serial2.write(wake, sizeof(wake));
+    delay(100);
+
+    if (xTaskCreatePinnedToCore(readerTaskMain, "meshSerial", readerStackBytes, nullptr, readerPriority, &readerTask,
+                                readerCore) != pdPASS)
+    {
+        readerTask = nullptr;
+        bleLog("Serial reader start failed");
+        return false;
+    }
+    bleLogf("Radio on UART2 at %lu baud", (unsigned long)meshSerialBaud);
+    return true;
+}
+
+bool serialLinkSend(const uint8_t *data, size_t len)
+{
+    if (!readerTask || len > meshFrameMaxBytes)
+    {
+        txErrors++;
+        return false;
+    }
+    uint8_t header[4] = {meshFrameStart1, meshFrameStart2, (uint8_t)(len >> 8), (uint8_t)len};
+    if (Serial2.write(header, sizeof(header)) != sizeof(header) || Serial2.write(data, len) != len)
+    {
+        txErrors++;
+        return false;
+    }
+    txFrames++;
+    lastSendMs = millis();
+    return true;
+}
+
+void serialLinkLoop()
+{
+    if (!readerTask || millis() - lastSendMs < heartbeatMs)
+    {
+        return;
+    }
+    lastSendMs = millis();
+    if (!sendHeartbeat())
+    {
+        bleLog("Heartbeat failed");
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Build with -DMESH_SERIAL_TRANSPORT to talk to a radio wired to UART2
+// instead of connecting over BLE (see the README for where to set it). The
+// radio's serial module must be enabled in PROTO mode at meshSerialBaud,
+// with its RX/TX crossed to the pins below.
+
+static const uint32_t meshSerialBaud = 921600;
+static const int meshSerialRxPin = 16;
+static const int meshSerialTxPin = 17;
+
+// Meshtastic stream API framing: 0x94 0xC3, a big-endian length, then one
+// ToRadio or FromRadio record.
+static const uint8_t meshFrameStart1 = 0x94;
+static const uint8_t meshFrameStart2 = 0xC3;
+static const size_t meshFrameMaxBytes = 512;
+
+// Opens the UART, wakes the radio and starts the task that unframes
+// FromRadio records into the same ingest path the BLE link feeds.
+bool serialLinkBegin();
+// Frames and writes one encoded ToRadio record.
+bool serialLinkSend(const uint8_t *data, size_t len);
+// Sends the periodic heartbeat that keeps the radio's serial API active.
+void serialLinkLoop();
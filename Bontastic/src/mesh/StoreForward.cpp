@@ -0,0 +1,492 @@
+#include "StoreForward.h"
+#include "MeshIngest.h"
+#include "MeshLink.h"
+#include "NodeDb.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include "../printer/PrintHelpers.h"
+#include "../printer/PrinterControl.h"
+#include "../protobufs/portnums.pb.h"
+#include "../protobufs/storeforward.pb.h"
+#include "../nanopb/pb_decode.h"
+#include "../nanopb/pb_encode.h"
+#include <Preferences.h>
+#include <string.h>
+
+static const uint32_t broadcastNode = 0xFFFFFFFF;
+
+// Replayed messages waiting for paper; room for a whole reply at a router's
+// default history_return_max of 25. A longer history is asked for again
+// from where the printed part ends.
+static const uint8_t backlogMaxMessages = 32;
+static const size_t backlogMaxBytes = 6144;
+// A slice at a time, with a gap that lets live traffic print in between.
+static const uint8_t sliceMessages = 4;
+static const uint32_t sliceGapMs = 3000;
+// The first slice waits for the router to get going, so the oldest replies
+// are in before anything prints.
+static const uint32_t settleMs = 5000;
+
+static const uint32_t responseTimeoutMs = 30000;
+static const uint32_t busyRetryMs = 60000;
+static const uint8_t maxAttempts = 3;
+static const uint32_t saveEveryMs = 60000;
+
+enum class CatchUp : uint8_t
+{
+    Idle,
+    Wanted,
+    Requested,
+    Receiving
+};
+
+struct BacklogMessage
+{
+    uint16_t offset;
+    uint16_t size;
+    uint32_t rxTime;
+    uint32_t from;
+};
+
+static Preferences sfPrefs;
+static uint32_t router;
+static uint32_t lastPrinted;
+static bool lastPrintedDirty;
+static uint32_t lastSaveMs;
+
+static CatchUp state;
+static uint32_t stateSinceMs;
+static uint8_t attempts;
+static bool pinged;
+// Replays are kept if they fall between the last message printed before
+// the gap and the first one printed live after it.
+static uint32_t catchUpFrom;
+static uint32_t catchUpTo;
+static uint32_t expected;
+static uint32_t received;
+static bool headerPrinted;
+// Replays that did not fit; the newest one printed is where the next
+// request starts.
+static bool deferred;
+static uint32_t replayedUpTo;
+
+static bool wasUp;
+static bool hadPaper = true;
+
+static uint32_t clockRxTime;
+static uint32_t clockMs;
+
+static BacklogMessage backlog[backlogMaxMessages];
+static uint8_t backlogCount;
+static uint8_t pool[backlogMaxBytes];
+static size_t poolUsed;
+static uint32_t firstQueuedMs;
+static uint32_t lastSliceMs;
+
+static uint32_t requests;
+static uint32_t busyReplies;
+static uint32_t replays;
+static uint32_t replaysSkipped;
+static uint32_t replaysDeferred;
+static uint32_t replaysPrinted;
+
+static void sfStatsProvider(std::string &out)
+{
+    char node[12];
+    snprintf(node, sizeof(node), "!%08lx", (unsigned long)router);
+    statsAppend(out, "sf_router", router ? node : "none");
+    statsAppend(out, "sf_state", (uint32_t)state);
+    statsAppend(out, "sf_requests", requests);
+    statsAppend(out, "sf_busy", busyReplies);
+    statsAppend(out, "sf_replays", replays);
+    statsAppend(out, "sf_replays_skipped", replaysSkipped);
+    statsAppend(out, "sf_replays_deferred", replaysDeferred);
+    statsAppend(out, "sf_replays_printed", replaysPrinted);
+    statsAppend(out, "sf_backlog", backlogCount);
+}
+
+static void enterState(CatchUp next)
+{
+    state = next;
+    stateSinceMs = millis();
+}
+
+static uint32_t meshNow()
+{
+    return clockRxTime ? clockRxTime + (millis() - clockMs) / 1000 : 0;
+}
+
+static bool sendToRouter(uint32_t to, const meshtastic_StoreAndForward &sf)
+{
+    uint8_t buffer[meshtastic_StoreAndForward_size];
+    pb_ostream_t ostream = pb_ostream_from_buffer(buffer, sizeof(buffer));
+    if (!pb_encode(&ostream, meshtastic_StoreAndForward_fields, &sf))
+    {
+        return false;
+    }
+    return meshLinkSendData(to, 0, meshtastic_PortNum_STORE_FORWARD_APP, buffer, ostream.bytes_written);
+}
+
+static bool requestHistory()
+{
+    meshtastic_StoreAndForward sf = meshtastic_StoreAndForward_init_zero;
+    sf.rr = meshtastic_StoreAndForward_RequestResponse_CLIENT_HISTORY;
+    sf.which_variant = meshtastic_StoreAndForward_history_tag;
+    // Minutes back to the last printed message; without a clock yet the
+    // router's own window applies and replays are filtered here.
+    uint32_t now = meshNow();
+    sf.variant.history.window = now > catchUpFrom ? (now - catchUpFrom) / 60 + 1 : 0;
+    bleLogf("S&F history request to !%08lx, %lu min", (unsigned long)router, (unsigned long)sf.variant.history.window);
+    requests++;
+    return sendToRouter(router, sf);
+}
+
+// Finds a router that has not sent a heartbeat since boot.
+static bool pingRouters()
+{
+    meshtastic_StoreAndForward sf = meshtastic_StoreAndForward_init_zero;
+    sf.rr = meshtastic_StoreAndForward_RequestResponse_CLIENT_PING;
+    bleLog("S&F router ping");
+    return sendToRouter(broadcastNode, sf);
+}
+
+static void learnRouter(uint32_t node)
+{
+    if (node == router)
+    {
+        return;
+    }
+    router = node;
+    sfPrefs.putUInt("router", router);
+    bleLogf("S&F router !%08lx", (unsigned long)router);
+}
+
+static void printSlice()
+{
+    uint8_t count = backlogCount < sliceMessages ? backlogCount : sliceMessages;
+    if (!headerPrinted)
+    {
+        // The router's count includes replays filtered out here, so no
+        // total is given.
+        printInfo("Missed", "while offline");
+        headerPrinted = true;
+    }
+
+    TextMessage messages[sliceMessages];
+    char unknown[sliceMessages][12];
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const BacklogMessage &m = backlog[i];
+        const char *sender = nodeDbName(m.from);
+        if (!sender)
+        {
+            snprintf(unknown[i], sizeof(unknown[i]), "!%08lx", (unsigned long)m.from);
+            sender = unknown[i];
+        }
+        messages[i] = {pool + m.offset, m.size, sender, m.rxTime};
+        if (m.rxTime > lastPrinted)
+        {
+            lastPrinted = m.rxTime;
+            lastPrintedDirty = true;
+        }
+        if (m.rxTime > replayedUpTo)
+        {
+            replayedUpTo = m.rxTime;
+        }
+    }
+    if (count == 1)
+    {
+        printTextMessage(messages[0].data, messages[0].size, messages[0].sender, messages[0].timestamp);
+    }
+    else
+    {
+        printTextDigest(messages, count);
+    }
+    replaysPrinted += count;
+
+    backlogCount -= count;
+    memmove(backlog, backlog + count, backlogCount * sizeof(BacklogMessage));
+    if (!backlogCount)
+    {
+        poolUsed = 0;
+    }
+    lastSliceMs = millis();
+}
+
+static bool backlogFull(size_t size)
+{
+    return backlogCount == backlogMaxMessages || poolUsed + size > sizeof(pool);
+}
+
+// Gives the newest replay's room back; the pool is in arrival order, so the
+// bytes after it move down.
+static void dropNewest()
+{
+    const BacklogMessage m = backlog[--backlogCount];
+    memmove(pool + m.offset, pool + m.offset + m.size, poolUsed - m.offset - m.size);
+    poolUsed -= m.size;
+    for (uint8_t i = 0; i < backlogCount; i++)
+    {
+        if (backlog[i].offset > m.offset)
+        {
+            backlog[i].offset -= m.size;
+        }
+    }
+}
+
+// Keeps the backlog in rx_time order whatever order the router replies in.
+static void queueReplay(const uint8_t *text, size_t size, uint32_t from, uint32_t rxTime)
+{
+    if (rxTime <= catchUpFrom || (catchUpTo && rxTime >= catchUpTo))
+    {
+        replaysSkipped++;
+        return;
+    }
+    for (uint8_t i = 0; i < backlogCount; i++)
+    {
+        if (backlog[i].from == from && backlog[i].rxTime == rxTime && backlog[i].size == size)
+        {
+            replaysSkipped++;
+            return;
+        }
+    }
+    if (size > sizeof(pool))
+    {
+        replaysSkipped++;
+        return;
+    }
+    if (backlogFull(size))
+    {
+        // Out of room: the oldest replays stay, so the history prints in
+        // order, and the rest is requested again once they have printed.
+        deferred = true;
+        replaysDeferred++;
+        while (backlogFull(size) && backlogCount && backlog[backlogCount - 1].rxTime > rxTime)
+        {
+            dropNewest();
+        }
+        if (backlogFull(size))
+        {
+            return;
+        }
+    }
+
+    uint8_t at = backlogCount;
+    while (at > 0 && backlog[at - 1].rxTime > rxTime)
+    {
+        at--;
+    }
+    memmove(backlog + at + 1, backlog + at, (backlogCount - at) * sizeof(BacklogMessage));
+    backlog[at] = {(uint16_t)poolUsed, (uint16_t)size, rxTime, from};
+    memcpy(pool + poolUsed, text, size);
+    poolUsed += size;
+    if (!backlogCount)
+    {
+        firstQueuedMs = millis();
+    }
+    backlogCount++;
+}
+
+static void startCatchUp()
+{
+    if (!lastPrinted)
+    {
+        // Nothing printed yet, so nothing was missed.
+        return;
+    }
+    catchUpFrom = lastPrinted;
+    catchUpTo = 0;
+    attempts = 0;
+    pinged = false;
+    headerPrinted = false;
+    deferred = false;
+    enterState(CatchUp::Wanted);
+}
+
+void storeForwardSetup()
+{
+    statsRegisterProvider(sfStatsProvider);
+    if (!sfPrefs.begin("sfclient", false))
+    {
+        return;
+    }
+    router = sfPrefs.getUInt("router", 0);
+    lastPrinted = sfPrefs.getUInt("last", 0);
+}
+
+void storeForwardLoop()
+{
+    uint32_t nowMs = millis();
+
+    // A link coming up (boot included) or paper coming back starts a
+    // catch-up.
+    bool up = meshLinkUp();
+    bool paper = !printerPaperOut();
+    if (up && paper && (!wasUp || !hadPaper))
+    {
+        startCatchUp();
+    }
+    wasUp = up;
+    hadPaper = paper;
+
+    switch (state)
+    {
+    case CatchUp::Wanted:
+        if (!up || nowMs - stateSinceMs < (attempts ? busyRetryMs : 0))
+        {
+            break;
+        }
+        if (router)
+        {
+            attempts++;
+            enterState(requestHistory() ? CatchUp::Requested : CatchUp::Idle);
+        }
+        else if (!pinged)
+        {
+            pinged = pingRouters();
+            stateSinceMs = nowMs;
+        }
+        else if (nowMs - stateSinceMs >= responseTimeoutMs)
+        {
+            bleLog("No S&F router answered");
+            enterState(CatchUp::Idle);
+        }
+        break;
+
+    case CatchUp::Requested:
+    case CatchUp::Receiving:
+        if (nowMs - stateSinceMs >= responseTimeoutMs)
+        {
+            enterState(CatchUp::Idle);
+        }
+        break;
+
+    case CatchUp::Idle:
+        break;
+    }
+
+    if (backlogCount && !printerPaperOut() && !meshIngestPending() && nowMs - firstQueuedMs >= settleMs &&
+        nowMs - lastSliceMs >= sliceGapMs)
+    {
+        printSlice();
+    }
+
+    // A history too long for the backlog continues once it has printed,
+    // within the same window.
+    if (deferred && !backlogCount && state == CatchUp::Idle && up)
+    {
+        deferred = false;
+        catchUpFrom = replayedUpTo;
+        attempts = 0;
+        enterState(CatchUp::Wanted);
+    }
+
+    if (lastPrintedDirty && nowMs - lastSaveMs >= saveEveryMs)
+    {
+        sfPrefs.putUInt("last", lastPrinted);
+        lastPrintedDirty = false;
+        lastSaveMs = nowMs;
+    }
+}
+
+void storeForwardPacket(const MeshEvent &event)
+{
+    meshtastic_StoreAndForward sf = meshtastic_StoreAndForward_init_zero;
+    pb_istream_t stream = pb_istream_from_buffer(event.payload, event.size);
+    if (!pb_decode(&stream, meshtastic_StoreAndForward_fields, &sf))
+    {
+        bleLog("S&F decode failed");
+        return;
+    }
+
+    switch (sf.rr)
+    {
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_HEARTBEAT:
+        if (sf.which_variant != meshtastic_StoreAndForward_heartbeat_tag || !sf.variant.heartbeat.secondary || !router)
+        {
+            learnRouter(event.from);
+        }
+        break;
+
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_PONG:
+        learnRouter(event.from);
+        if (state == CatchUp::Wanted)
+        {
+            // Sent on the next loop.
+            stateSinceMs = millis() - busyRetryMs;
+        }
+        break;
+
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_HISTORY:
+        if (state == CatchUp::Requested && event.from == router)
+        {
+            expected = sf.which_variant == meshtastic_StoreAndForward_history_tag ? sf.variant.history.history_messages : 0;
+            received = 0;
+            bleLogf("S&F replaying %lu messages", (unsigned long)expected);
+            enterState(expected ? CatchUp::Receiving : CatchUp::Idle);
+        }
+        break;
+
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_BUSY:
+        if (state == CatchUp::Requested && event.from == router)
+        {
+            busyReplies++;
+            enterState(attempts < maxAttempts ? CatchUp::Wanted : CatchUp::Idle);
+        }
+        break;
+
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_ERROR:
+        if (state == CatchUp::Requested && event.from == router)
+        {
+            bleLog("S&F router error");
+            enterState(CatchUp::Idle);
+        }
+        break;
+
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_BROADCAST:
+    case meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_DIRECT:
+        if (state != CatchUp::Receiving || sf.which_variant != meshtastic_StoreAndForward_text_tag)
+        {
+            break;
+        }
+        // The router sends each replay from the original sender with the
+        // time it heard it.
+        replays++;
+        queueReplay(sf.variant.text.bytes, sf.variant.text.size, event.from, event.rxTime);
+        stateSinceMs = millis();
+        if (++received >= expected)
+        {
+            enterState(CatchUp::Idle);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void storeForwardPrinted(uint32_t rxTime)
+{
+    if (!rxTime)
+    {
+        return;
+    }
+    if (state != CatchUp::Idle && !catchUpTo)
+    {
+        catchUpTo = rxTime;
+    }
+    if (rxTime > lastPrinted)
+    {
+        lastPrinted = rxTime;
+        lastPrintedDirty = true;
+    }
+}
+
+void storeForwardClock(uint32_t rxTime)
+{
+    if (rxTime)
+    {
+        clockRxTime = rxTime;
+        clockMs = millis();
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+
+struct MeshEvent;
+
+// Store & Forward client. The printer remembers the rx_time of the last
+// text it printed on paper. When the radio link comes back, or the paper
+// does, it asks the mesh's S&F router for the history since then. The
+// replayed messages are collected in rx_time order and printed a few at a
+// time, only while no live traffic is waiting.
+void storeForwardSetup();
+void storeForwardLoop();
+// Handler for STORE_FORWARD_APP packets.
+void storeForwardPacket(const MeshEvent &event);
+// Called with the rx_time of each live text message as it goes to paper.
+void storeForwardPrinted(uint32_t rxTime);
+// Feeds the mesh clock from a live packet's rx_time; the printer has no
+// clock of its own to size the history window by.
+void storeForwardClock(uint32_t rxTime);
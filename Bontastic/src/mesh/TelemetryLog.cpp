@@ -0,0 +1,547 @@
+#include "TelemetryLog.h"
+#include "MeshIngest.h"
+#include "NodeDb.h"
+#include "../printer/Bontastic_Thermal.h"
+#include "../printer/DeviceStats.h"
+#include "../printer/MeshtasticBLELogger.h"
+#include "../printer/PrintHelpers.h"
+#include "../printer/PrinterControl.h"
+#include "../protobufs/telemetry.pb.h"
+#include "../nanopb/pb_decode.h"
+#include <esp_timer.h>
+#include <math.h>
+#include <string.h>
+
+extern Bontastic_Thermal printer;
+
+enum Metric : uint8_t
+{
+    Battery,
+    Voltage,
+    Temperature,
+    Humidity,
+    Pressure,
+    PowerVoltage,
+    PowerCurrent,
+    MetricCount
+};
+
+// Values are stored as int16 in units of 1/scale.
+struct MetricInfo
+{
+    const char *name;
+    const char *unit;
+    uint8_t scale;
+};
+
+static const MetricInfo metrics[MetricCount] = {
+    {"Battery", "%", 1},
+    {"Voltage", "V", 100},
+    {"Temp", "C", 10},
+    {"Humidity", "%", 1},
+    {"Pressure", "hPa", 1},
+    {"Power", "V", 100},
+    {"Power", "mA", 1},
+};
+
+static const uint8_t tierCount = 3;
+static const uint8_t tierSlots = 24;
+// Minutes per slot; the rings span 2 h, 8 h and 24 h.
+static const uint16_t tierMinutes[tierCount] = {5, 20, 60};
+// About 9 KB. A node reporting device metrics takes two series, one with
+// environment and power sensors up to seven, so this holds 24 battery
+// nodes or 6 fully equipped ones. A node that does not fit pushes out the
+// node heard from longest ago, all its series at once.
+static const uint8_t maxSeries = 48;
+static const int16_t noValue = INT16_MIN;
+
+static const uint16_t chartWidth = 384;
+static const uint8_t chartHeight = 40;
+static const uint32_t chartSpanMinutes = 24 * 60;
+// One node's charts go out per pass, this far apart, so live messages can
+// print between them.
+static const uint32_t nodeGapMs = 5000;
+
+// Each ring holds one average per slot. Every sample goes into all three
+// rings, so a coarser slot is the average over its whole span.
+struct Tier
+{
+    uint32_t head; // slot number of the newest slot
+    int32_t sum;   // of the samples in the newest slot
+    uint16_t count;
+    int16_t slots[tierSlots];
+};
+
+struct Series
+{
+    uint32_t node; // 0 when the entry is free
+    uint8_t metric;
+    uint32_t lastMinute;
+    int16_t latest;
+    Tier tiers[tierCount];
+};
+
+static Series series[maxSeries];
+
+static uint32_t intervalMs;
+static uint32_t nextAt;
+static bool samplesSinceBoard;
+// Nodes still to print in the running board; 0 entries are done.
+static uint32_t boardNodes[maxSeries];
+static uint8_t boardNodeCount;
+static uint8_t boardNext;
+static uint32_t lastNodeMs;
+
+static uint8_t chart[chartWidth / 8 * chartHeight];
+
+static uint32_t telemetryPackets;
+static uint32_t telemetryDecodeFailures;
+static uint32_t telemetryEvictions;
+static uint32_t telemetryBoards;
+
+static void telemetryStatsProvider(std::string &out)
+{
+    uint32_t used = 0;
+    for (const Series &s : series)
+    {
+        used += s.node != 0;
+    }
+    statsAppend(out, "telemetry_packets", telemetryPackets);
+    statsAppend(out, "telemetry_decode_failures", telemetryDecodeFailures);
+    statsAppend(out, "telemetry_series", used);
+    statsAppend(out, "telemetry_evictions", telemetryEvictions);
+    statsAppend(out, "telemetry_boards", telemetryBoards);
+}
+
+// Minutes since boot from the 64-bit timer; millis() would wrap after 49.7
+// days and send the slot numbers backwards.
+static uint32_t nowMinutes()
+{
+    return (uint32_t)(esp_timer_get_time() / 60000000LL);
+}
+
+// The minute `node` was last heard from, over all its series.
+static uint32_t nodeLastMinute(uint32_t node)
+{
+    uint32_t last = 0;
+    for (const Series &s : series)
+    {
+        if (s.node == node && s.lastMinute > last)
+        {
+            last = s.lastMinute;
+        }
+    }
+    return last;
+}
+
+// Frees every series of the node heard from longest ago, other than `keep`.
+static void evictNode(uint32_t keep)
+{
+    uint32_t victim = 0;
+    uint32_t victimMinute = UINT32_MAX;
+    for (const Series &s : series)
+    {
+        if (s.node && s.node != keep && s.node != victim)
+        {
+            uint32_t last = nodeLastMinute(s.node);
+            if (last < victimMinute)
+            {
+                victim = s.node;
+                victimMinute = last;
+            }
+        }
+    }
+    for (Series &s : series)
+    {
+        if (victim && s.node == victim)
+        {
+            s.node = 0;
+        }
+    }
+    telemetryEvictions += victim != 0;
+}
+
+// The node's series for metric, or a free one taken for it.
+static Series *seriesFor(uint32_t node, uint8_t metric)
+{
+    Series *unused = nullptr;
+    for (Series &s : series)
+    {
+        if (s.node == node && s.metric == metric)
+        {
+            return &s;
+        }
+        if (!s.node && !unused)
+        {
+            unused = &s;
+        }
+    }
+    if (!unused)
+    {
+        evictNode(node);
+        for (Series &s : series)
+        {
+            if (!s.node)
+            {
+                unused = &s;
+                break;
+            }
+        }
+    }
+    if (!unused)
+    {
+        return nullptr;
+    }
+    uint32_t minute = nowMinutes();
+    unused->node = node;
+    unused->metric = metric;
+    for (uint8_t t = 0; t < tierCount; t++)
+    {
+        Tier &tier = unused->tiers[t];
+        tier.head = minute / tierMinutes[t];
+        tier.sum = 0;
+        tier.count = 0;
+        for (int16_t &slot : tier.slots)
+        {
+            slot = noValue;
+        }
+    }
+    return unused;
+}
+
+static void addToTier(Tier &tier, uint32_t slot, int16_t value)
+{
+    if (slot > tier.head)
+    {
+        uint32_t skipped = slot - tier.head;
+        for (uint32_t i = 1; i <= skipped && i <= tierSlots; i++)
+        {
+            tier.slots[(tier.head + i) % tierSlots] = noValue;
+        }
+        tier.head = slot;
+        tier.sum = 0;
+        tier.count = 0;
+    }
+    tier.sum += value;
+    tier.count++;
+    tier.slots[tier.head % tierSlots] = (int16_t)(tier.sum / tier.count);
+}
+
+static void addSample(uint32_t node, uint8_t metric, float value)
+{
+    if (isnan(value))
+    {
+        return;
+    }
+    float scaled = roundf(value * metrics[metric].scale);
+    int16_t v = (int16_t)(scaled > 32767.0f ? 32767.0f : scaled < -32767.0f ? -32767.0f : scaled);
+
+    Series *s = seriesFor(node, metric);
+    if (!s)
+    {
+        return;
+    }
+    uint32_t minute = nowMinutes();
+    s->lastMinute = minute;
+    s->latest = v;
+    for (uint8_t t = 0; t < tierCount; t++)
+    {
+        addToTier(s->tiers[t], minute / tierMinutes[t], v);
+    }
+    samplesSinceBoard = true;
+}
+
+// The value at `minute` from the finest ring that has one.
+static int16_t valueAt(const Series &s, uint32_t minute)
+{
+    for (uint8_t t = 0; t < tierCount; t++)
+    {
+        const Tier &tier = s.tiers[t];
+        uint32_t slot = minute / tierMinutes[t];
+        if (slot > tier.head || tier.head - slot >= tierSlots)
+        {
+            continue;
+        }
+        int16_t v = tier.slots[slot % tierSlots];
+        if (v != noValue)
+        {
+            return v;
+        }
+    }
+    return noValue;
+}
+
+static void setPixel(uint16_t x, uint8_t y)
+{
+    chart[y * (chartWidth / 8) + x / 8] |= 0x80 >> (x % 8);
+}
+
+static void formatValue(char *out, size_t size, uint8_t metric, int32_t v)
+{
+    const MetricInfo &m = metrics[metric];
+    if (m.scale == 1)
+    {
+        snprintf(out, size, "%ld", (long)v);
+    }
+    else
+    {
+        snprintf(out, size, "%.*f", m.scale >= 100 ? 2 : 1, (double)v / m.scale);
+    }
+}
+
+// Upside down, the paper is read from its far end, so whatever feeds first
+// ends up lowest: a board goes out bottom to top.
+static bool printingUpsideDown()
+{
+    return (getPrinterSettings().decorations & 0x10) != 0;
+}
+
+static void printChart(const Series &s)
+{
+    int16_t values[chartWidth];
+    int16_t low = INT16_MAX;
+    int16_t high = INT16_MIN + 1;
+    uint32_t now = nowMinutes();
+    for (uint16_t x = 0; x < chartWidth; x++)
+    {
+        uint32_t back = (uint32_t)(chartWidth - 1 - x) * chartSpanMinutes / chartWidth;
+        values[x] = back <= now ? valueAt(s, now - back) : noValue;
+        if (values[x] != noValue)
+        {
+            low = values[x] < low ? values[x] : low;
+            high = values[x] > high ? values[x] : high;
+        }
+    }
+    if (low > high)
+    {
+        return;
+    }
+
+    const MetricInfo &m = metrics[s.metric];
+    char latest[12];
+    char lowText[12];
+    char highText[12];
+    formatValue(latest, sizeof(latest), s.metric, s.latest);
+    formatValue(lowText, sizeof(lowText), s.metric, low);
+    formatValue(highText, sizeof(highText), s.metric, high);
+    char label[64];
+    snprintf(label, sizeof(label), "%s %s%s  (%s..%s)", m.name, latest, m.unit, lowText, highText);
+
+    // A line through the column values, a dotted baseline and a tick every
+    // six hours.
+    memset(chart, 0, sizeof(chart));
+    int32_t range = (int32_t)high - low;
+    int16_t lastY = -1;
+    for (uint16_t x = 0; x < chartWidth; x++)
+    {
+        if (x % 4 == 0)
+        {
+            setPixel(x, chartHeight - 1);
+        }
+        if (x % (chartWidth / 4) == 0)
+        {
+            setPixel(x, chartHeight - 2);
+            setPixel(x, chartHeight - 3);
+        }
+        if (values[x] == noValue)
+        {
+            lastY = -1;
+            continue;
+        }
+        // Rows 0..chartHeight-4, highest value at the top.
+        int16_t y = range ? (int16_t)((int32_t)(high - values[x]) * (chartHeight - 4) / range) : (chartHeight - 4) / 2;
+        int16_t from = lastY < 0 ? y : lastY;
+        for (int16_t row = from < y ? from : y; row <= (from < y ? y : from); row++)
+        {
+            setPixel(x, row);
+        }
+        lastY = y;
+    }
+    bool upsideDown = printingUpsideDown();
+    if (!upsideDown)
+    {
+        printer.println(label);
+    }
+    gsV0WithUpsideDown(chartWidth / 8, chartHeight, chart, sizeof(chart), upsideDown);
+    if (upsideDown)
+    {
+        printer.println(label);
+    }
+}
+
+static void printNodeName(const char *name)
+{
+    printer.boldOn();
+    printStyledText(reinterpret_cast<const uint8_t *>(name), strlen(name));
+    printer.boldOff();
+}
+
+static void printNode(uint32_t node)
+{
+    char unknown[12];
+    const char *name = nodeDbName(node);
+    if (!name)
+    {
+        snprintf(unknown, sizeof(unknown), "!%08lx", (unsigned long)node);
+        name = unknown;
+    }
+    bool upsideDown = printingUpsideDown();
+    if (!upsideDown)
+    {
+        printNodeName(name);
+    }
+    for (uint8_t i = 0; i < MetricCount; i++)
+    {
+        uint8_t metric = upsideDown ? MetricCount - 1 - i : i;
+        for (const Series &s : series)
+        {
+            if (s.node == node && s.metric == metric)
+            {
+                printChart(s);
+            }
+        }
+    }
+    if (upsideDown)
+    {
+        printNodeName(name);
+    }
+    printer.feed(1);
+}
+
+static void startBoard()
+{
+    boardNodeCount = 0;
+    boardNext = 0;
+    for (const Series &s : series)
+    {
+        bool listed = !s.node;
+        for (uint8_t i = 0; i < boardNodeCount && !listed; i++)
+        {
+            listed = boardNodes[i] == s.node;
+        }
+        if (!listed)
+        {
+            boardNodes[boardNodeCount++] = s.node;
+        }
+    }
+    samplesSinceBoard = false;
+    if (!boardNodeCount)
+    {
+        return;
+    }
+    telemetryBoards++;
+    bleLogf("Telemetry board, %u nodes", (unsigned)boardNodeCount);
+    if (!printingUpsideDown())
+    {
+        printInfo("Telemetry", "last 24 h");
+    }
+    lastNodeMs = millis() - nodeGapMs;
+}
+
+void telemetrySetIntervalMinutes(uint32_t minutes)
+{
+    intervalMs = minutes * 60UL * 1000UL;
+    nextAt = millis() + intervalMs;
+}
+
+void telemetrySetup()
+{
+    statsRegisterProvider(telemetryStatsProvider);
+    nextAt = millis() + intervalMs;
+}
+
+void telemetryLoop()
+{
+    uint32_t now = millis();
+    if (boardNext < boardNodeCount)
+    {
+        if (now - lastNodeMs >= nodeGapMs && !meshIngestPending() && !printerPaperOut())
+        {
+            printNode(boardNodes[boardNext++]);
+            lastNodeMs = now;
+            if (boardNext == boardNodeCount)
+            {
+                if (printingUpsideDown())
+                {
+                    printInfo("Telemetry", "last 24 h");
+                }
+                printer.feed(2);
+                applyPrinterSettings();
+            }
+        }
+        return;
+    }
+
+    if (!intervalMs || static_cast<int32_t>(now - nextAt) < 0)
+    {
+        return;
+    }
+    nextAt = now + intervalMs;
+    // Nothing new since the last board: spare the paper.
+    if (samplesSinceBoard && !printerPaperOut())
+    {
+        startBoard();
+    }
+}
+
+void telemetryPacket(const MeshEvent &event)
+{
+    meshtastic_Telemetry telemetry = meshtastic_Telemetry_init_zero;
+    pb_istream_t stream = pb_istream_from_buffer(event.payload, event.size);
+    if (!pb_decode(&stream, meshtastic_Telemetry_fields, &telemetry))
+    {
+        telemetryDecodeFailures++;
+        return;
+    }
+    telemetryPackets++;
+
+    switch (telemetry.which_variant)
+    {
+    case meshtastic_Telemetry_device_metrics_tag:
+    {
+        const meshtastic_DeviceMetrics &d = telemetry.variant.device_metrics;
+        // Above 100 means external power, which is not a level.
+        if (d.has_battery_level && d.battery_level <= 100)
+        {
+            addSample(event.from, Battery, d.battery_level);
+        }
+        if (d.has_voltage)
+        {
+            addSample(event.from, Voltage, d.voltage);
+        }
+        break;
+    }
+    case meshtastic_Telemetry_environment_metrics_tag:
+    {
+        const meshtastic_EnvironmentMetrics &e = telemetry.variant.environment_metrics;
+        if (e.has_temperature)
+        {
+            addSample(event.from, Temperature, e.temperature);
+        }
+        if (e.has_relative_humidity)
+        {
+            addSample(event.from, Humidity, e.relative_humidity);
+        }
+        if (e.has_barometric_pressure)
+        {
+            addSample(event.from, Pressure, e.barometric_pressure);
+        }
+        break;
+    }
+    case meshtastic_Telemetry_power_metrics_tag:
+    {
+        const meshtastic_PowerMetrics &p = telemetry.variant.power_metrics;
+        if (p.has_ch1_voltage)
+        {
+            addSample(event.from, PowerVoltage, p.ch1_voltage);
+        }
+        if (p.has_ch1_current)
+        {
+            addSample(event.from, PowerCurrent, p.ch1_current);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
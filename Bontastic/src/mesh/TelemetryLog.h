@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Arduino.h>
+
+struct MeshEvent;
+
+// In-memory history of the device, environment and power metrics nodes
+// report on TELEMETRY_APP. Each node/metric pair is a series of three
+// rings at 5, 20 and 60 minute resolution, so the last two hours are kept
+// fine and the day behind them coarser. On a schedule the last 24 hours
+// print as one sparkline per series, grouped by node; nothing prints for
+// individual packets.
+void telemetrySetup();
+void telemetryLoop();
+// Handler for TELEMETRY_APP packets.
+void telemetryPacket(const MeshEvent &event);
+// Period of the scheduled charts; they stay off until this is called, and
+// 0 turns them off again.
+void telemetrySetIntervalMinutes(uint32_t minutes);
@@ -29,6 +29,37 @@ size_t Bontastic_Thermal::write(uint8_t c)
     return 1;
 }
 
+size_t Bontastic_Thermal::write(const uint8_t *buffer, size_t size)
+{
+    if (!_stream || !buffer)
+    {
+        return 0;
+    }
+    // Hand runs between '\r' characters to the stream in one call so the
+    // UART driver can copy them into its TX buffer in bulk.
+    size_t start = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (buffer[i] == '\r')
+        {
+            if (i > start)
+            {
+                _stream->write(buffer + start, i - start);
+            }
+            start = i + 1;
+        }
+    }
+    if (size > start)
+    {
+        _stream->write(buffer + start, size - start);
+    }
+    return size;
+}
+
+Stream *Bontastic_Thermal::stream() const { return _stream; }
+
+void Bontastic_Thermal::setStream(Stream *s) { _stream = s; }
+
 void Bontastic_Thermal::begin()
 {
     reset();
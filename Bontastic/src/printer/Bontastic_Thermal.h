@@ -8,10 +8,15 @@ public:
     explicit Bontastic_Thermal(Stream *s = &Serial, uint8_t dtr = 255);
 
     size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
 
     void begin();
     void begin(uint16_t version);
 
+    // Swaps the output stream, e.g. to render into a PrintJob buffer.
+    Stream *stream() const;
+    void setStream(Stream *s);
+
     void reset();
     void setDefault();
 
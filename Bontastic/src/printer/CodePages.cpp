@@ -0,0 +1,142 @@
+#include "CodePages.h"
+#include "TextTranscoder.h"
+#include "Normalize.h"
+#include "assets/codepages.h"
+
+static uint8_t activePage = 23;
+static int activeTable = -1;
+
+static int findTable(uint8_t page)
+{
+    for (int i = 0; i < codepages_count; i++)
+    {
+        if (codepages_tables[i].page == page)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t tableByte(int table, uint32_t cp)
+{
+    if (cp > 0xFFFF)
+    {
+        return 0;
+    }
+    int lo = codepages_tables[table].first;
+    int hi = lo + codepages_tables[table].count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint16_t v = codepages_codepoints[mid];
+        if (v == cp)
+        {
+            return codepages_bytes[mid];
+        }
+        if (v < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+void setActiveCodePage(uint8_t page)
+{
+    activePage = page;
+    activeTable = findTable(page);
+}
+
+uint8_t activeCodePage()
+{
+    return activePage;
+}
+
+uint8_t codePageByte(uint32_t cp)
+{
+    if (cp < 0x80)
+    {
+        return (uint8_t)cp;
+    }
+    if (activeTable < 0)
+    {
+        // No table for this page (Katakana, Thai, ...): keep the historic
+        // Latin-1 pass-through.
+        return cp <= 0xFF ? (uint8_t)cp : 0;
+    }
+    return tableByte(activeTable, cp);
+}
+
+uint8_t bestCodePage(const uint8_t *utf8, size_t len, uint8_t current)
+{
+    // Most messages are ASCII or fit the configured page; only count
+    // characters once one turns up that the current page lacks.
+    uint16_t hits[codepages_count] = {};
+    uint16_t currentHits = 0;
+    bool missing = false;
+    size_t i = 0;
+    while (i < len)
+    {
+        if (utf8[i] < 0x80)
+        {
+            i++;
+            continue;
+        }
+        uint32_t cp;
+        size_t used = utf8DecodeComposed(utf8 + i, len - i, cp);
+        if (!used)
+        {
+            break;
+        }
+        i += used;
+        if (cp == utf8Invalid || isCombiningMark(cp))
+        {
+            continue;
+        }
+        if (!missing && codePageByte(cp))
+        {
+            continue;
+        }
+        if (!missing)
+        {
+            // Restart counting from the top so earlier characters count too.
+            missing = true;
+            i = 0;
+            continue;
+        }
+        if (codePageByte(cp))
+        {
+            currentHits++;
+        }
+        for (int t = 0; t < codepages_count; t++)
+        {
+            if (tableByte(t, cp))
+            {
+                hits[t]++;
+            }
+        }
+    }
+    if (!missing)
+    {
+        return current;
+    }
+
+    // The current page wins ties, also when it has no table of its own and
+    // only its pass-through counts, so a page switch needs a real gain.
+    int best = -1;
+    uint16_t bestHits = currentHits;
+    for (int t = 0; t < codepages_count; t++)
+    {
+        if (hits[t] > bestHits)
+        {
+            best = t;
+            bestHits = hits[t];
+        }
+    }
+    return best >= 0 ? codepages_tables[best].page : current;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Tells the transcoder which ESC t page the printer currently uses. This
+// does not send anything to the printer.
+void setActiveCodePage(uint8_t page);
+uint8_t activeCodePage();
+
+// Printer byte for cp in the active code page, or 0 when the page has no
+// such character. ASCII maps to itself.
+uint8_t codePageByte(uint32_t cp);
+
+// Picks the code page that covers the most non-ASCII characters of the
+// text. Returns current unless another page covers strictly more.
+uint8_t bestCodePage(const uint8_t *utf8, size_t len, uint8_t current);
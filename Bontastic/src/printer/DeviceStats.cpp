@@ -0,0 +1,203 @@
+#include "DeviceStats.h"
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+
+static const uint8_t maxProviders = 16;
+static StatsProvider providers[maxProviders];
+static uint8_t providerCount;
+static NimBLECharacteristic *statsCharacteristic;
+
+struct BootMark
+{
+    const char *phase;
+    uint32_t ms;
+};
+
+static const size_t statsPageBytes = 480;
+static std::atomic<uint8_t> statsPage;
+// Providers read state loop() owns, so the page is only rebuilt there. A
+// read or page change over BLE asks for a rebuild; while a client is
+// subscribed the page is also kept from going stale and pushed after each
+// print. With nobody listening nothing is rebuilt.
+static const uint32_t statsMaxAgeMs = 5000;
+static std::atomic<bool> refreshWanted;
+static std::atomic<uint32_t> subscribedConns; // one bit per connection handle
+static uint32_t lastRefreshMs;
+// Reused across rebuilds so a refresh does not go back to the heap once
+// they have grown to fit.
+static std::string statsText;
+static std::string statsValue;
+
+static const uint8_t maxBootMarks = 12;
+static BootMark bootMarks[maxBootMarks];
+static uint8_t bootMarkCount;
+
+void statsAttachCharacteristic(NimBLECharacteristic *c)
+{
+    statsCharacteristic = c;
+}
+
+void statsRegisterProvider(StatsProvider provider)
+{
+    if (!provider || providerCount >= maxProviders)
+    {
+        return;
+    }
+    for (uint8_t i = 0; i < providerCount; i++)
+    {
+        if (providers[i] == provider)
+        {
+            return;
+        }
+    }
+    providers[providerCount++] = provider;
+}
+
+void statsAppend(std::string &out, const char *key, uint32_t value)
+{
+    char text[12];
+    snprintf(text, sizeof(text), "%lu", (unsigned long)value);
+    statsAppend(out, key, text);
+}
+
+void statsAppend(std::string &out, const char *key, const char *value)
+{
+    out += key;
+    out += '=';
+    out += value;
+    out += '\n';
+}
+
+void statsSelectPage(uint8_t page)
+{
+    statsPage = page;
+    refreshWanted = true;
+}
+
+void statsRequestRefresh()
+{
+    refreshWanted = true;
+}
+
+void statsSetSubscribed(uint16_t conn, bool subscribed)
+{
+    uint32_t bit = 1u << (conn % 32);
+    if (subscribed)
+    {
+        subscribedConns.fetch_or(bit);
+        refreshWanted = true;
+    }
+    else
+    {
+        subscribedConns.fetch_and(~bit);
+    }
+}
+
+void statsLoop()
+{
+    if (refreshWanted.exchange(false))
+    {
+        statsRefresh(false);
+    }
+    else if (subscribedConns && millis() - lastRefreshMs >= statsMaxAgeMs)
+    {
+        statsRefresh(false);
+    }
+}
+
+void statsBootMark(const char *phase)
+{
+    if (bootMarkCount >= maxBootMarks)
+    {
+        return;
+    }
+    for (uint8_t i = 0; i < bootMarkCount; i++)
+    {
+        if (!strcmp(bootMarks[i].phase, phase))
+        {
+            return;
+        }
+    }
+    bootMarks[bootMarkCount++] = {phase, millis()};
+}
+
+// One line, "boot=setup:12,printer:40,...", in the order reached.
+static void appendBootMarks(std::string &out)
+{
+    if (!bootMarkCount)
+    {
+        return;
+    }
+    out += "boot=";
+    for (uint8_t i = 0; i < bootMarkCount; i++)
+    {
+        char text[40];
+        snprintf(text, sizeof(text), "%s%s:%lu", i ? "," : "", bootMarks[i].phase, (unsigned long)bootMarks[i].ms);
+        out += text;
+    }
+    out += '\n';
+}
+
+void statsRefresh(bool notify)
+{
+    if (!statsCharacteristic || (notify && !subscribedConns))
+    {
+        return;
+    }
+    lastRefreshMs = millis();
+    uint8_t selected = statsPage;
+    std::string &text = statsText;
+    if (!text.capacity())
+    {
+        text.reserve(1024);
+        statsValue.reserve(statsPageBytes + 32);
+    }
+    text.clear();
+    appendBootMarks(text);
+    for (uint8_t i = 0; i < providerCount; i++)
+    {
+        providers[i](text);
+    }
+
+    // Find the selected page, or the last one if it is past the end.
+    size_t pageStart = 0;
+    size_t pageEnd = 0;
+    uint8_t pages = 0;
+    size_t pos = 0;
+    while (pos < text.size() || !pages)
+    {
+        size_t end = pos;
+        while (end < text.size())
+        {
+            size_t nl = text.find('\n', end);
+            size_t lineEnd = nl == std::string::npos ? text.size() : nl + 1;
+            if (lineEnd - pos > statsPageBytes && end > pos)
+            {
+                break;
+            }
+            end = lineEnd;
+        }
+        if (pages <= selected)
+        {
+            pageStart = pos;
+            pageEnd = end;
+        }
+        pages++;
+        pos = end;
+    }
+
+    char header[24];
+    snprintf(header, sizeof(header), "page=%u/%u\n", (unsigned)(selected < pages ? selected + 1 : pages),
+             (unsigned)pages);
+    statsValue.assign(header);
+    statsValue.append(text, pageStart, pageEnd - pageStart);
+    statsCharacteristic->setValue(reinterpret_cast<const uint8_t *>(statsValue.data()), statsValue.size());
+    if (notify)
+    {
+        statsCharacteristic->notify();
+    }
+}
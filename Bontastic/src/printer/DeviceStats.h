@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+class NimBLECharacteristic;
+
+// Modules register a provider that appends "key=value" lines; the stats
+// characteristic is rebuilt from all providers on every read or refresh.
+// An attribute holds at most 512 bytes, so the text is served in pages cut
+// at line boundaries, each starting with a "page=N/M" line; the client
+// writes the zero-based page number it wants before reading.
+typedef void (*StatsProvider)(std::string &out);
+
+void statsAttachCharacteristic(NimBLECharacteristic *c);
+void statsRegisterProvider(StatsProvider provider);
+void statsAppend(std::string &out, const char *key, uint32_t value);
+void statsAppend(std::string &out, const char *key, const char *value);
+// Rebuilds the characteristic's page; loop() only. A notifying refresh is
+// skipped while no client is subscribed.
+void statsRefresh(bool notify);
+// Called from loop(); rebuilds the page when asked to, or when it is old
+// and a client is subscribed.
+void statsLoop();
+// Safe from the BLE callbacks: the page is rebuilt on the next statsLoop().
+void statsRequestRefresh();
+void statsSelectPage(uint8_t page);
+// From the characteristic's onSubscribe, for each connection.
+void statsSetSubscribed(uint16_t conn, bool subscribed);
+// Records when a boot phase was reached, in ms since boot. Only the first
+// mark of each phase counts; phase must be a string literal.
+void statsBootMark(const char *phase);
@@ -0,0 +1,180 @@
+#include "EmojiSprites.h"
+#include "Bontastic_Thermal.h"
+#include "PrinterControl.h"
+#include "PrintHelpers.h"
+#include "assets/emojisprites.h"
+#include <string.h>
+
+// Codes redefined while user-defined characters are switched on. They are
+// only selected around a single sprite, so ordinary text keeps printing
+// from the built-in font.
+static const uint8_t slotCount = emojiSlotCount;
+static const uint8_t slotFirstCode = 0x41;
+static const uint8_t noSprite = 0xFF;
+
+struct SpriteSlot
+{
+    uint8_t sprite;
+    uint32_t lastUse;
+};
+
+static SpriteSlot slots[slotCount] = {};
+static bool slotsValid;
+static uint32_t slotClock;
+static uint32_t slotHits;
+static uint32_t slotDownloads;
+
+static int findSprite(uint32_t cp)
+{
+    int lo = 0;
+    int hi = emojisprites_count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint32_t v = emojisprites_codepoints[mid];
+        if (v == cp)
+        {
+            return emojisprites_index[mid];
+        }
+        if (v < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return -1;
+}
+
+bool emojiSpriteAvailable(uint32_t cp)
+{
+    // Sprites are drawn for the 12x24 cell of font A.
+    if (printerTextStyle().font != 0)
+    {
+        return false;
+    }
+    return findSprite(cp) >= 0;
+}
+
+const uint8_t *emojiSpriteBitmap(uint32_t cp)
+{
+    int sprite = findSprite(cp);
+    if (sprite < 0)
+    {
+        return nullptr;
+    }
+    return emojisprites_data + (size_t)sprite * emojisprites_bytes;
+}
+
+void emojiSlotsReset()
+{
+    for (uint8_t i = 0; i < slotCount; i++)
+    {
+        slots[i].sprite = noSprite;
+        slots[i].lastUse = 0;
+    }
+    slotsValid = true;
+}
+
+void emojiSlotsSave(uint8_t *sprites)
+{
+    for (uint8_t i = 0; i < slotCount; i++)
+    {
+        sprites[i] = slotsValid ? slots[i].sprite : noSprite;
+    }
+}
+
+static size_t defineSlot(Bontastic_Thermal &printer, uint8_t slot, uint8_t sprite)
+{
+    uint8_t code = slotFirstCode + slot;
+    uint8_t glyph[1 + emojisprites_bytes];
+    glyph[0] = emojisprites_width;
+    memcpy(glyph + 1, emojisprites_data + (size_t)sprite * emojisprites_bytes, emojisprites_bytes);
+    printer.defineUserDefinedChars(3, code, code, glyph, sizeof(glyph));
+    slots[slot].sprite = sprite;
+    slotDownloads++;
+    return 5 + sizeof(glyph);
+}
+
+size_t emojiSlotsRestore(Bontastic_Thermal &printer, const uint8_t *sprites)
+{
+    if (!slotsValid)
+    {
+        emojiSlotsReset();
+    }
+    size_t sent = 0;
+    for (uint8_t i = 0; i < slotCount; i++)
+    {
+        if (sprites[i] != noSprite && slots[i].sprite != sprites[i])
+        {
+            sent += defineSlot(printer, i, sprites[i]);
+        }
+    }
+    return sent;
+}
+
+void emojiSlotsAdopt(const uint8_t *sprites)
+{
+    slotClock++;
+    for (uint8_t i = 0; i < slotCount; i++)
+    {
+        slots[i].sprite = sprites[i];
+        slots[i].lastUse = sprites[i] == noSprite ? 0 : slotClock;
+    }
+    slotsValid = true;
+}
+
+void emojiSlotStats(uint32_t &hits, uint32_t &downloads)
+{
+    hits = slotHits;
+    downloads = slotDownloads;
+}
+
+size_t printEmojiSprite(Bontastic_Thermal &printer, uint32_t cp)
+{
+    int sprite = findSprite(cp);
+    if (sprite < 0)
+    {
+        return 0;
+    }
+    if (!slotsValid)
+    {
+        emojiSlotsReset();
+    }
+
+    slotClock++;
+    uint8_t slot = 0;
+    bool loaded = false;
+    for (uint8_t i = 0; i < slotCount; i++)
+    {
+        if (slots[i].sprite == sprite)
+        {
+            slot = i;
+            loaded = true;
+            break;
+        }
+        if (slots[i].lastUse < slots[slot].lastUse)
+        {
+            slot = i;
+        }
+    }
+
+    size_t sent = 0;
+    uint8_t code = slotFirstCode + slot;
+    if (loaded)
+    {
+        slotHits++;
+    }
+    else
+    {
+        sent += defineSlot(printer, slot, (uint8_t)sprite);
+    }
+    slots[slot].lastUse = slotClock;
+
+    printer.userDefinedCharsEnabled(true);
+    printer.write(code);
+    printer.userDefinedCharsEnabled(false);
+    return sent + 7;
+}
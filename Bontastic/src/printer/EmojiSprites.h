@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+class Bontastic_Thermal;
+
+// True when cp has a sprite and the current font can show it inline.
+bool emojiSpriteAvailable(uint32_t cp);
+
+// 12x24 sprite for cp in ESC & column order (3 bytes per column, top
+// first), or nullptr.
+const uint8_t *emojiSpriteBitmap(uint32_t cp);
+
+// Prints cp as a single user-defined character. The sprite is only sent to
+// the printer when no slot holds it yet; otherwise the least recently used
+// slot is overwritten. Returns the number of bytes sent.
+size_t printEmojiSprite(Bontastic_Thermal &printer, uint32_t cp);
+
+// Forgets which sprites the printer holds, e.g. after ESC @ cleared them.
+void emojiSlotsReset();
+
+// Sprite held by each of the emojiSlotCount slots, for replaying a job
+// that was rendered against them.
+static const uint8_t emojiSlotCount = 16;
+void emojiSlotsSave(uint8_t *sprites);
+// Downloads the saved sprites the printer no longer holds. Returns the
+// number of bytes sent.
+size_t emojiSlotsRestore(Bontastic_Thermal &printer, const uint8_t *sprites);
+// Takes over saved slot contents as the printer's, e.g. after a replayed
+// job redefined the slots.
+void emojiSlotsAdopt(const uint8_t *sprites);
+
+void emojiSlotStats(uint32_t &hits, uint32_t &downloads);
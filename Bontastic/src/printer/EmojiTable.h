@@ -1,540 +1,159 @@
 #pragma once
+#include <Arduino.h>
 #include <stdint.h>
 
-struct EmojiMap
-{
-    uint32_t codepoint;
-    const char *shortcode;
-};
+// Generated by tools/gen_emoji_table.py from tools/emoji_shortcodes.txt - do not edit.
+//
+// Codepoints are sorted and split by plane so each fits in 16 bits. Entry i
+// owns emojiShortcodePool[emojiShortcodeOffsets[i] .. emojiShortcodeOffsets[i + 1]),
+// stored without the surrounding colons.
 
-static const EmojiMap emojiTable[] = {
-    // Smileys & People
-    {0x1F600, ":grinning:"},
-    {0x1F601, ":grin:"},
-    {0x1F602, ":joy:"},
-    {0x1F603, ":smiley:"},
-    {0x1F604, ":smile:"},
-    {0x1F605, ":sweat_smile:"},
-    {0x1F606, ":laughing:"},
-    {0x1F609, ":wink:"},
-    {0x1F60A, ":blush:"},
-    {0x1F60B, ":yum:"},
-    {0x1F60E, ":sunglasses:"},
-    {0x1F60D, ":heart_eyes:"},
-    {0x1F618, ":kissing_heart:"},
-    {0x1F617, ":kissing:"},
-    {0x1F619, ":kissing_smiling_eyes:"},
-    {0x1F61A, ":kissing_closed_eyes:"},
-    {0x1F642, ":slight_smile:"},
-    {0x1F917, ":hugging:"},
-    {0x1F914, ":thinking:"},
-    {0x1F610, ":neutral_face:"},
-    {0x1F611, ":expressionless:"},
-    {0x1F636, ":no_mouth:"},
-    {0x1F644, ":rolling_eyes:"},
-    {0x1F60F, ":smirk:"},
-    {0x1F623, ":persevere:"},
-    {0x1F625, ":disappointed_relieved:"},
-    {0x1F62E, ":open_mouth:"},
-    {0x1F62F, ":hushed:"},
-    {0x1F62A, ":sleepy:"},
-    {0x1F62B, ":tired_face:"},
-    {0x1F634, ":sleeping:"},
-    {0x1F60C, ":relieved:"},
-    {0x1F61B, ":stuck_out_tongue:"},
-    {0x1F61C, ":stuck_out_tongue_winking_eye:"},
-    {0x1F61D, ":stuck_out_tongue_closed_eyes:"},
-    {0x1F612, ":unamused:"},
-    {0x1F613, ":sweat:"},
-    {0x1F614, ":pensive:"},
-    {0x1F615, ":confused:"},
-    {0x1F643, ":upside_down_face:"},
-    {0x1F911, ":money_mouth_face:"},
-    {0x1F632, ":astonished:"},
-    {0x1F637, ":mask:"},
-    {0x1F912, ":thermometer_face:"},
-    {0x1F915, ":head_bandage:"},
-    {0x1F616, ":confounded:"},
-    {0x1F61E, ":disappointed:"},
-    {0x1F61F, ":worried:"},
-    {0x1F624, ":triumph:"},
-    {0x1F622, ":cry:"},
-    {0x1F62D, ":sob:"},
-    {0x1F626, ":frowning:"},
-    {0x1F627, ":anguished:"},
-    {0x1F628, ":fearful:"},
-    {0x1F629, ":weary:"},
-    {0x1F62C, ":grimacing:"},
-    {0x1F630, ":cold_sweat:"},
-    {0x1F631, ":scream:"},
-    {0x1F633, ":flushed:"},
-    {0x1F635, ":dizzy_face:"},
-    {0x1F621, ":rage:"},
-    {0x1F620, ":angry:"},
-    {0x1F608, ":smiling_imp:"},
-    {0x1F47F, ":imp:"},
-    {0x1F479, ":japanese_ogre:"},
-    {0x1F47A, ":japanese_goblin:"},
-    {0x1F480, ":skull:"},
-    {0x1F47B, ":ghost:"},
-    {0x1F47D, ":alien:"},
-    {0x1F916, ":robot:"},
-    {0x1F4A9, ":poop:"},
-    {0x1F63A, ":smiley_cat:"},
-    {0x1F638, ":smile_cat:"},
-    {0x1F639, ":joy_cat:"},
-    {0x1F63B, ":heart_eyes_cat:"},
-    {0x1F63C, ":smirk_cat:"},
-    {0x1F63D, ":kissing_cat:"},
-    {0x1F63E, ":pouting_cat:"},
-    {0x1F63F, ":crying_cat_face:"},
-    {0x1F640, ":scream_cat:"},
-    {0x1F648, ":see_no_evil:"},
-    {0x1F649, ":hear_no_evil:"},
-    {0x1F64A, ":speak_no_evil:"},
-    {0x1F48B, ":kiss:"},
-    {0x1F48C, ":love_letter:"},
-    {0x1F498, ":cupid:"},
-    {0x1F49D, ":gift_heart:"},
-    {0x1F496, ":sparkling_heart:"},
-    {0x1F497, ":heartpulse:"},
-    {0x1F493, ":heartbeat:"},
-    {0x1F49E, ":revolving_hearts:"},
-    {0x1F495, ":two_hearts:"},
-    {0x1F49F, ":heart_decoration:"},
-    {0x2764, ":heart:"},
-    {0x1F9E1, ":orange_heart:"},
-    {0x1F49B, ":yellow_heart:"},
-    {0x1F49A, ":green_heart:"},
-    {0x1F499, ":blue_heart:"},
-    {0x1F49C, ":purple_heart:"},
-    {0x1F5A4, ":black_heart:"},
-    {0x1F494, ":broken_heart:"},
-    {0x2763, ":heavy_heart_exclamation:"},
-    {0x1F4A2, ":anger:"},
-    {0x1F4A3, ":bomb:"},
-    {0x1F4A4, ":zzz:"},
-    {0x1F4A5, ":boom:"},
-    {0x1F4A6, ":sweat_drops:"},
-    {0x1F4A7, ":droplet:"},
-    {0x1F4A8, ":dash:"},
-    {0x1F4AB, ":dizzy:"},
-    {0x1F4AC, ":speech_balloon:"},
-    {0x1F4AD, ":thought_balloon:"},
-    {0x1F44B, ":wave:"},
-    {0x1F91A, ":raised_back_of_hand:"},
-    {0x1F590, ":raised_hand_with_fingers_splayed:"},
-    {0x270B, ":hand:"},
-    {0x1F596, ":vulcan_salute:"},
-    {0x1F44C, ":ok_hand:"},
-    {0x270C, ":v:"},
-    {0x1F91E, ":crossed_fingers:"},
-    {0x1F91F, ":love_you_gesture:"},
-    {0x1F918, ":metal:"},
-    {0x1F919, ":call_me_hand:"},
-    {0x1F448, ":point_left:"},
-    {0x1F449, ":point_right:"},
-    {0x1F446, ":point_up_2:"},
-    {0x1F447, ":point_down:"},
-    {0x261D, ":point_up:"},
-    {0x1F44D, ":+1:"},
-    {0x1F44E, ":-1:"},
-    {0x270A, ":fist:"},
-    {0x1F44A, ":facepunch:"},
-    {0x1F91B, ":left_facing_fist:"},
-    {0x1F91C, ":right_facing_fist:"},
-    {0x1F44F, ":clap:"},
-    {0x1F64C, ":raised_hands:"},
-    {0x1F450, ":open_hands:"},
-    {0x1F932, ":palms_up_together:"},
-    {0x1F91D, ":handshake:"},
-    {0x1F64F, ":pray:"},
-    {0x1F485, ":nail_care:"},
-    {0x1F4AA, ":muscle:"},
+static const uint16_t emojiCount = 523;
+static const uint16_t emojiBmpCount = 52;
 
-    // Animals & Nature
-    {0x1F436, ":dog:"},
-    {0x1F431, ":cat:"},
-    {0x1F42D, ":mouse:"},
-    {0x1F439, ":hamster:"},
-    {0x1F430, ":rabbit:"},
-    {0x1F98A, ":fox_face:"},
-    {0x1F43B, ":bear:"},
-    {0x1F43C, ":panda_face:"},
-    {0x1F428, ":koala:"},
-    {0x1F42F, ":tiger:"},
-    {0x1F981, ":lion:"},
-    {0x1F42E, ":cow:"},
-    {0x1F437, ":pig:"},
-    {0x1F43D, ":pig_nose:"},
-    {0x1F438, ":frog:"},
-    {0x1F435, ":monkey_face:"},
-    {0x1F412, ":monkey:"},
-    {0x1F414, ":chicken:"},
-    {0x1F427, ":penguin:"},
-    {0x1F426, ":bird:"},
-    {0x1F424, ":baby_chick:"},
-    {0x1F423, ":hatching_chick:"},
-    {0x1F425, ":hatched_chick:"},
-    {0x1F986, ":duck:"},
-    {0x1F985, ":eagle:"},
-    {0x1F989, ":owl:"},
-    {0x1F987, ":bat:"},
-    {0x1F43A, ":wolf:"},
-    {0x1F417, ":boar:"},
-    {0x1F434, ":horse:"},
-    {0x1F984, ":unicorn:"},
-    {0x1F41D, ":bee:"},
-    {0x1F41B, ":bug:"},
-    {0x1F98B, ":butterfly:"},
-    {0x1F40C, ":snail:"},
-    {0x1F41E, ":beetle:"},
-    {0x1F41C, ":ant:"},
-    {0x1F577, ":spider:"},
-    {0x1F578, ":spider_web:"},
-    {0x1F422, ":turtle:"},
-    {0x1F40D, ":snake:"},
-    {0x1F98E, ":lizard:"},
-    {0x1F419, ":octopus:"},
-    {0x1F991, ":squid:"},
-    {0x1F990, ":shrimp:"},
-    {0x1F420, ":tropical_fish:"},
-    {0x1F41F, ":fish:"},
-    {0x1F421, ":blowfish:"},
-    {0x1F42C, ":dolphin:"},
-    {0x1F988, ":shark:"},
-    {0x1F433, ":whale:"},
-    {0x1F40B, ":whale2:"},
-    {0x1F40A, ":crocodile:"},
-    {0x1F406, ":leopard:"},
-    {0x1F405, ":tiger2:"},
-    {0x1F403, ":water_buffalo:"},
-    {0x1F402, ":ox:"},
-    {0x1F404, ":cow2:"},
-    {0x1F98C, ":deer:"},
-    {0x1F42A, ":dromedary_camel:"},
-    {0x1F42B, ":camel:"},
-    {0x1F418, ":elephant:"},
-    {0x1F98F, ":rhinoceros:"},
-    {0x1F98D, ":gorilla:"},
-    {0x1F410, ":goat:"},
-    {0x1F40F, ":ram:"},
-    {0x1F411, ":sheep:"},
-    {0x1F416, ":pig2:"},
-    {0x1F400, ":rat:"},
-    {0x1F401, ":mouse2:"},
-    {0x1F413, ":rooster:"},
-    {0x1F415, ":dog2:"},
-    {0x1F429, ":poodle:"},
-    {0x1F43E, ":paw_prints:"},
-    {0x1F409, ":dragon:"},
-    {0x1F432, ":dragon_face:"},
-    {0x1F335, ":cactus:"},
-    {0x1F384, ":christmas_tree:"},
-    {0x1F332, ":evergreen_tree:"},
-    {0x1F333, ":deciduous_tree:"},
-    {0x1F334, ":palm_tree:"},
-    {0x1F331, ":seedling:"},
-    {0x1F33F, ":herb:"},
-    {0x2618, ":shamrock:"},
-    {0x1F340, ":four_leaf_clover:"},
-    {0x1F38D, ":bamboo:"},
-    {0x1F38B, ":tanabata_tree:"},
-    {0x1F343, ":leaves:"},
-    {0x1F342, ":fallen_leaf:"},
-    {0x1F341, ":maple_leaf:"},
-    {0x1F33E, ":ear_of_rice:"},
-    {0x1F33A, ":hibiscus:"},
-    {0x1F33B, ":sunflower:"},
-    {0x1F339, ":rose:"},
-    {0x1F940, ":wilted_flower:"},
-    {0x1F337, ":tulip:"},
-    {0x1F33C, ":blossom:"},
-    {0x1F338, ":cherry_blossom:"},
-    {0x1F490, ":bouquet:"},
-    {0x1F344, ":mushroom:"},
-    {0x1F330, ":chestnut:"},
-    {0x1F383, ":jack_o_lantern:"},
-    {0x1F41A, ":shell:"},
-    {0x1F30E, ":earth_americas:"},
-    {0x1F30D, ":earth_africa:"},
-    {0x1F30F, ":earth_asia:"},
-    {0x1F315, ":full_moon:"},
-    {0x1F318, ":waning_crescent_moon:"},
-    {0x1F311, ":new_moon:"},
-    {0x1F31A, ":new_moon_with_face:"},
-    {0x1F31D, ":full_moon_with_face:"},
-    {0x1F31E, ":sun_with_face:"},
-    {0x2B50, ":star:"},
-    {0x1F31F, ":star2:"},
-    {0x2728, ":sparkles:"},
-    {0x26A1, ":zap:"},
-    {0x1F525, ":fire:"},
-    {0x1F4A5, ":collision:"},
-    {0x2600, ":sunny:"},
-    {0x26C5, ":partly_sunny:"},
-    {0x2601, ":cloud:"},
-    {0x1F329, ":lightning:"},
-    {0x2614, ":umbrella:"},
-    {0x2744, ":snowflake:"},
-    {0x26C4, ":snowman:"},
-    {0x1F308, ":rainbow:"},
-    {0x1F30A, ":ocean:"},
+static const uint16_t emojiCodepoints[] PROGMEM = {
+    0x231A, 0x231B, 0x23F0, 0x23F1, 0x23F2, 0x2600, 0x2601, 0x2614, 0x2618, 0x261D, 0x2693, 0x26A1,
+    0x26BD, 0x26BE, 0x26C4, 0x26C5, 0x26EA, 0x26F2, 0x26F3, 0x26F5, 0x26FA, 0x26FD, 0x2702, 0x2705,
+    0x2708, 0x2709, 0x270A, 0x270B, 0x270C, 0x270F, 0x2712, 0x2714, 0x2716, 0x2728, 0x2733, 0x2734,
+    0x2744, 0x2747, 0x274C, 0x274E, 0x2753, 0x2754, 0x2755, 0x2757, 0x2763, 0x2764, 0x2795, 0x2796,
+    0x2797, 0x27B0, 0x27BF, 0x2B50, 0xF308, 0xF30A, 0xF30D, 0xF30E, 0xF30F, 0xF311, 0xF315, 0xF318,
+    0xF31A, 0xF31D, 0xF31E, 0xF31F, 0xF329, 0xF330, 0xF331, 0xF332, 0xF333, 0xF334, 0xF335, 0xF337,
+    0xF338, 0xF339, 0xF33A, 0xF33B, 0xF33C, 0xF33E, 0xF33F, 0xF340, 0xF341, 0xF342, 0xF343, 0xF344,
+    0xF381, 0xF382, 0xF383, 0xF384, 0xF388, 0xF389, 0xF38A, 0xF38B, 0xF38D, 0xF393, 0xF396, 0xF3A3,
+    0xF3A4, 0xF3A5, 0xF3A7, 0xF3A8, 0xF3A9, 0xF3AA, 0xF3AB, 0xF3AC, 0xF3AD, 0xF3AE, 0xF3AF, 0xF3B0,
+    0xF3B1, 0xF3B2, 0xF3B3, 0xF3B5, 0xF3B6, 0xF3B7, 0xF3B8, 0xF3B9, 0xF3BA, 0xF3BB, 0xF3BC, 0xF3BE,
+    0xF3C0, 0xF3C5, 0xF3C6, 0xF3C8, 0xF3E0, 0xF3E1, 0xF3E2, 0xF3E3, 0xF3E5, 0xF3E6, 0xF3E7, 0xF3E8,
+    0xF3E9, 0xF3EA, 0xF3EB, 0xF3EC, 0xF3ED, 0xF3EF, 0xF3F0, 0xF400, 0xF401, 0xF402, 0xF403, 0xF404,
+    0xF405, 0xF406, 0xF409, 0xF40A, 0xF40B, 0xF40C, 0xF40D, 0xF40F, 0xF410, 0xF411, 0xF412, 0xF413,
+    0xF414, 0xF415, 0xF416, 0xF417, 0xF418, 0xF419, 0xF41A, 0xF41B, 0xF41C, 0xF41D, 0xF41E, 0xF41F,
+    0xF420, 0xF421, 0xF422, 0xF423, 0xF424, 0xF425, 0xF426, 0xF427, 0xF428, 0xF429, 0xF42A, 0xF42B,
+    0xF42C, 0xF42D, 0xF42E, 0xF42F, 0xF430, 0xF431, 0xF432, 0xF433, 0xF434, 0xF435, 0xF436, 0xF437,
+    0xF438, 0xF439, 0xF43A, 0xF43B, 0xF43C, 0xF43D, 0xF43E, 0xF446, 0xF447, 0xF448, 0xF449, 0xF44A,
+    0xF44B, 0xF44C, 0xF44D, 0xF44E, 0xF44F, 0xF450, 0xF451, 0xF479, 0xF47A, 0xF47B, 0xF47D, 0xF47F,
+    0xF480, 0xF485, 0xF48B, 0xF48C, 0xF490, 0xF493, 0xF494, 0xF495, 0xF496, 0xF497, 0xF498, 0xF499,
+    0xF49A, 0xF49B, 0xF49C, 0xF49D, 0xF49E, 0xF49F, 0xF4A1, 0xF4A2, 0xF4A3, 0xF4A4, 0xF4A5, 0xF4A6,
+    0xF4A7, 0xF4A8, 0xF4A9, 0xF4AA, 0xF4AB, 0xF4AC, 0xF4AD, 0xF4BB, 0xF4BD, 0xF4BE, 0xF4BF, 0xF4C0,
+    0xF4C5, 0xF4C8, 0xF4C9, 0xF4CA, 0xF4CB, 0xF4CC, 0xF4CD, 0xF4CE, 0xF4CF, 0xF4D0, 0xF4D6, 0xF4D7,
+    0xF4D8, 0xF4D9, 0xF4DA, 0xF4DC, 0xF4DD, 0xF4E6, 0xF4E7, 0xF4E8, 0xF4E9, 0xF4EA, 0xF4EB, 0xF4EE,
+    0xF4F0, 0xF4F1, 0xF4F2, 0xF4F3, 0xF4F4, 0xF4F6, 0xF4F7, 0xF4F9, 0xF4FA, 0xF4FB, 0xF4FC, 0xF500,
+    0xF501, 0xF502, 0xF503, 0xF504, 0xF505, 0xF506, 0xF507, 0xF508, 0xF509, 0xF50A, 0xF50B, 0xF50C,
+    0xF50D, 0xF50E, 0xF511, 0xF512, 0xF513, 0xF514, 0xF516, 0xF517, 0xF518, 0xF519, 0xF51A, 0xF51B,
+    0xF51C, 0xF51D, 0xF51E, 0xF51F, 0xF520, 0xF521, 0xF522, 0xF523, 0xF524, 0xF525, 0xF526, 0xF527,
+    0xF528, 0xF529, 0xF52B, 0xF52C, 0xF52D, 0xF52E, 0xF52F, 0xF530, 0xF531, 0xF532, 0xF533, 0xF534,
+    0xF535, 0xF536, 0xF537, 0xF538, 0xF539, 0xF53A, 0xF53B, 0xF53C, 0xF53D, 0xF550, 0xF551, 0xF552,
+    0xF553, 0xF554, 0xF555, 0xF556, 0xF557, 0xF558, 0xF559, 0xF55A, 0xF55B, 0xF55C, 0xF55D, 0xF55E,
+    0xF55F, 0xF560, 0xF561, 0xF562, 0xF563, 0xF564, 0xF565, 0xF566, 0xF567, 0xF577, 0xF578, 0xF590,
+    0xF596, 0xF5A4, 0xF5FB, 0xF5FC, 0xF5FD, 0xF5FE, 0xF5FF, 0xF600, 0xF601, 0xF602, 0xF603, 0xF604,
+    0xF605, 0xF606, 0xF608, 0xF609, 0xF60A, 0xF60B, 0xF60C, 0xF60D, 0xF60E, 0xF60F, 0xF610, 0xF611,
+    0xF612, 0xF613, 0xF614, 0xF615, 0xF616, 0xF617, 0xF618, 0xF619, 0xF61A, 0xF61B, 0xF61C, 0xF61D,
+    0xF61E, 0xF61F, 0xF620, 0xF621, 0xF622, 0xF623, 0xF624, 0xF625, 0xF626, 0xF627, 0xF628, 0xF629,
+    0xF62A, 0xF62B, 0xF62C, 0xF62D, 0xF62E, 0xF62F, 0xF630, 0xF631, 0xF632, 0xF633, 0xF634, 0xF635,
+    0xF636, 0xF637, 0xF638, 0xF639, 0xF63A, 0xF63B, 0xF63C, 0xF63D, 0xF63E, 0xF63F, 0xF640, 0xF642,
+    0xF643, 0xF644, 0xF648, 0xF649, 0xF64A, 0xF64C, 0xF64F, 0xF680, 0xF681, 0xF682, 0xF683, 0xF684,
+    0xF685, 0xF686, 0xF687, 0xF688, 0xF689, 0xF68A, 0xF68B, 0xF68C, 0xF68D, 0xF68E, 0xF691, 0xF692,
+    0xF693, 0xF695, 0xF697, 0xF699, 0xF69A, 0xF69B, 0xF69C, 0xF69D, 0xF69E, 0xF69F, 0xF6A0, 0xF6A1,
+    0xF6A2, 0xF6A4, 0xF6A5, 0xF6A6, 0xF6A7, 0xF6A8, 0xF6A9, 0xF6B2, 0xF6F4, 0xF6F5, 0xF6F8, 0xF911,
+    0xF912, 0xF914, 0xF915, 0xF916, 0xF917, 0xF918, 0xF919, 0xF91A, 0xF91B, 0xF91C, 0xF91D, 0xF91E,
+    0xF91F, 0xF932, 0xF940, 0xF981, 0xF984, 0xF985, 0xF986, 0xF987, 0xF988, 0xF989, 0xF98A, 0xF98B,
+    0xF98C, 0xF98D, 0xF98E, 0xF98F, 0xF990, 0xF991, 0xF9E1,
+};
 
-    // Objects
-    {0x1F680, ":rocket:"},
-    {0x1F681, ":helicopter:"},
-    {0x1F682, ":steam_locomotive:"},
-    {0x1F683, ":railway_car:"},
-    {0x1F684, ":bullettrain_side:"},
-    {0x1F685, ":bullettrain_front:"},
-    {0x1F687, ":metro:"},
-    {0x1F689, ":station:"},
-    {0x1F68C, ":bus:"},
-    {0x1F691, ":ambulance:"},
-    {0x1F692, ":fire_engine:"},
-    {0x1F693, ":police_car:"},
-    {0x1F695, ":taxi:"},
-    {0x1F697, ":car:"},
-    {0x1F699, ":blue_car:"},
-    {0x1F69A, ":truck:"},
-    {0x1F6A2, ":ship:"},
-    {0x1F6A4, ":speedboat:"},
-    {0x1F6B2, ":bike:"},
-    {0x1F6F4, ":scooter:"},
-    {0x1F6F5, ":motor_scooter:"},
-    {0x1F6F8, ":flying_saucer:"},
-    {0x2708, ":airplane:"},
-    {0x2693, ":anchor:"},
-    {0x231B, ":hourglass:"},
-    {0x231A, ":watch:"},
-    {0x23F0, ":alarm_clock:"},
-    {0x23F1, ":stopwatch:"},
-    {0x23F2, ":timer_clock:"},
-    {0x1F388, ":balloon:"},
-    {0x1F389, ":tada:"},
-    {0x1F38A, ":confetti_ball:"},
-    {0x1F381, ":gift:"},
-    {0x1F382, ":birthday:"},
-    {0x1F393, ":mortar_board:"},
-    {0x1F451, ":crown:"},
-    {0x1F396, ":medal:"},
-    {0x1F3C6, ":trophy:"},
-    {0x1F3C5, ":sports_medal:"},
-    {0x26BD, ":soccer:"},
-    {0x26BE, ":baseball:"},
-    {0x1F3C0, ":basketball:"},
-    {0x1F3C8, ":football:"},
-    {0x1F3BE, ":tennis:"},
-    {0x1F3B1, ":8ball:"},
-    {0x1F3B3, ":bowling:"},
-    {0x26F3, ":golf:"},
-    {0x1F3A3, ":fishing_pole_and_fish:"},
-    {0x1F3A4, ":microphone:"},
-    {0x1F3A5, ":movie_camera:"},
-    {0x1F3A7, ":headphones:"},
-    {0x1F3A8, ":art:"},
-    {0x1F3A9, ":tophat:"},
-    {0x1F3AA, ":circus_tent:"},
-    {0x1F3AB, ":ticket:"},
-    {0x1F3AC, ":clapper:"},
-    {0x1F3AD, ":performing_arts:"},
-    {0x1F3AE, ":video_game:"},
-    {0x1F3AF, ":dart:"},
-    {0x1F3B0, ":slot_machine:"},
-    {0x1F3B2, ":game_die:"},
-    {0x1F3B5, ":musical_note:"},
-    {0x1F3B6, ":notes:"},
-    {0x1F3B7, ":saxophone:"},
-    {0x1F3B8, ":guitar:"},
-    {0x1F3B9, ":musical_keyboard:"},
-    {0x1F3BA, ":trumpet:"},
-    {0x1F3BB, ":violin:"},
-    {0x1F3BC, ":musical_score:"},
-    {0x1F4F1, ":iphone:"},
-    {0x1F4F2, ":calling:"},
-    {0x1F4BB, ":computer:"},
-    {0x1F4BD, ":minidisc:"},
-    {0x1F4BE, ":floppy_disk:"},
-    {0x1F4BF, ":cd:"},
-    {0x1F4C0, ":dvd:"},
-    {0x1F4FA, ":tv:"},
-    {0x1F4FB, ":radio:"},
-    {0x1F50A, ":speaker:"},
-    {0x1F50D, ":mag:"},
-    {0x1F50E, ":mag_right:"},
-    {0x1F511, ":key:"},
-    {0x1F512, ":lock:"},
-    {0x1F513, ":unlock:"},
-    {0x1F514, ":bell:"},
-    {0x1F527, ":wrench:"},
-    {0x1F528, ":hammer:"},
-    {0x1F529, ":nut_and_bolt:"},
-    {0x1F52B, ":gun:"},
-    {0x1F52C, ":microscope:"},
-    {0x1F52D, ":telescope:"},
-    {0x1F52E, ":crystal_ball:"},
-    {0x1F4A1, ":bulb:"},
-    {0x1F4D6, ":book:"},
-    {0x1F4D7, ":green_book:"},
-    {0x1F4D8, ":blue_book:"},
-    {0x1F4D9, ":orange_book:"},
-    {0x1F4DA, ":books:"},
-    {0x1F4E6, ":package:"},
-    {0x1F4E7, ":e-mail:"},
-    {0x1F4E8, ":incoming_envelope:"},
-    {0x1F4E9, ":envelope_with_arrow:"},
-    {0x1F4EA, ":mailbox_closed:"},
-    {0x1F4EB, ":mailbox:"},
-    {0x1F4EE, ":postbox:"},
-    {0x1F4F0, ":newspaper:"},
-    {0x1F4DC, ":scroll:"},
-    {0x1F4DD, ":memo:"},
-    {0x1F4C5, ":calendar:"},
-    {0x1F4C8, ":chart_with_upwards_trend:"},
-    {0x1F4C9, ":chart_with_downwards_trend:"},
-    {0x1F4CA, ":bar_chart:"},
-    {0x1F4CB, ":clipboard:"},
-    {0x1F4CC, ":pushpin:"},
-    {0x1F4CD, ":round_pushpin:"},
-    {0x1F4CE, ":paperclip:"},
-    {0x1F4CF, ":straight_ruler:"},
-    {0x1F4D0, ":triangular_ruler:"},
-    {0x1F6A9, ":flags:"},
-    {0x1F6A8, ":rotating_light:"},
-    {0x1F6A7, ":construction:"},
-    {0x1F6A5, ":traffic_light:"},
-    {0x1F6A6, ":vertical_traffic_light:"},
-    {0x1F6A1, ":aerial_tramway:"},
-    {0x1F6A0, ":mountain_cableway:"},
-    {0x1F69F, ":suspension_railway:"},
-    {0x1F69E, ":mountain_railway:"},
-    {0x1F69D, ":monorail:"},
-    {0x1F69C, ":tractor:"},
-    {0x1F69B, ":articulated_lorry:"},
-    {0x1F68E, ":trolleybus:"},
-    {0x1F68D, ":oncoming_bus:"},
-    {0x1F68B, ":tram:"},
-    {0x1F68A, ":light_rail:"},
-    {0x1F688, ":light_rail:"},
-    {0x1F686, ":train2:"},
-    {0x1F3E0, ":house:"},
-    {0x1F3E1, ":house_with_garden:"},
-    {0x1F3E2, ":office:"},
-    {0x1F3E3, ":post_office:"},
-    {0x1F3E5, ":hospital:"},
-    {0x1F3E6, ":bank:"},
-    {0x1F3E7, ":atm:"},
-    {0x1F3E8, ":hotel:"},
-    {0x1F3E9, ":love_hotel:"},
-    {0x1F3EA, ":convenience_store:"},
-    {0x1F3EB, ":school:"},
-    {0x1F3EC, ":department_store:"},
-    {0x1F3ED, ":factory:"},
-    {0x1F3EF, ":japanese_castle:"},
-    {0x1F3F0, ":european_castle:"},
-    {0x26EA, ":church:"},
-    {0x1F5FB, ":mount_fuji:"},
-    {0x1F5FC, ":tokyo_tower:"},
-    {0x1F5FD, ":statue_of_liberty:"},
-    {0x1F5FE, ":japan:"},
-    {0x1F5FF, ":moyai:"},
-    {0x26F5, ":boat:"},
-    {0x26F2, ":fountain:"},
-    {0x26FA, ":tent:"},
-    {0x26FD, ":fuelpump:"},
-    {0x2702, ":scissors:"},
-    {0x2705, ":white_check_mark:"},
-    {0x2709, ":envelope:"},
-    {0x270F, ":pencil2:"},
-    {0x2712, ":black_nib:"},
-    {0x2714, ":heavy_check_mark:"},
-    {0x2716, ":heavy_multiplication_x:"},
-    {0x2733, ":sparkle:"},
-    {0x2734, ":eight_spoked_asterisk:"},
-    {0x2747, ":sparkle:"},
-    {0x274C, ":x:"},
-    {0x274E, ":negative_squared_cross_mark:"},
-    {0x2753, ":question:"},
-    {0x2754, ":grey_question:"},
-    {0x2755, ":grey_exclamation:"},
-    {0x2757, ":exclamation:"},
-    {0x2795, ":heavy_plus_sign:"},
-    {0x2796, ":heavy_minus_sign:"},
-    {0x2797, ":heavy_division_sign:"},
-    {0x27B0, ":curly_loop:"},
-    {0x27BF, ":loop:"},
-    {0x1F51F, ":keycap_ten:"},
-    {0x1F4F3, ":vibration_mode:"},
-    {0x1F4F4, ":mobile_phone_off:"},
-    {0x1F4F6, ":signal_strength:"},
-    {0x1F4F7, ":camera:"},
-    {0x1F4F9, ":video_camera:"},
-    {0x1F4FC, ":vhs:"},
-    {0x1F500, ":twisted_rightwards_arrows:"},
-    {0x1F501, ":repeat:"},
-    {0x1F502, ":repeat_one:"},
-    {0x1F503, ":arrows_clockwise:"},
-    {0x1F504, ":arrows_counterclockwise:"},
-    {0x1F505, ":low_brightness:"},
-    {0x1F506, ":high_brightness:"},
-    {0x1F507, ":mute:"},
-    {0x1F508, ":sound:"},
-    {0x1F509, ":speaker:"},
-    {0x1F50B, ":battery:"},
-    {0x1F50C, ":electric_plug:"},
-    {0x1F516, ":bookmark:"},
-    {0x1F517, ":link:"},
-    {0x1F518, ":radio_button:"},
-    {0x1F519, ":back:"},
-    {0x1F51A, ":end:"},
-    {0x1F51B, ":on:"},
-    {0x1F51C, ":soon:"},
-    {0x1F51D, ":top:"},
-    {0x1F51E, ":underage:"},
-    {0x1F520, ":capital_abcd:"},
-    {0x1F521, ":abcd:"},
-    {0x1F522, ":1234:"},
-    {0x1F523, ":symbols:"},
-    {0x1F524, ":abc:"},
-    {0x1F526, ":flashlight:"},
-    {0x1F52F, ":six_pointed_star:"},
-    {0x1F530, ":beginner:"},
-    {0x1F531, ":trident:"},
-    {0x1F532, ":black_square_button:"},
-    {0x1F533, ":white_square_button:"},
-    {0x1F534, ":red_circle:"},
-    {0x1F535, ":large_blue_circle:"},
-    {0x1F536, ":large_orange_diamond:"},
-    {0x1F537, ":large_blue_diamond:"},
-    {0x1F538, ":small_orange_diamond:"},
-    {0x1F539, ":small_blue_diamond:"},
-    {0x1F53A, ":small_red_triangle:"},
-    {0x1F53B, ":small_red_triangle_down:"},
-    {0x1F53C, ":arrow_up_small:"},
-    {0x1F53D, ":arrow_down_small:"},
-    {0x1F550, ":clock1:"},
-    {0x1F551, ":clock2:"},
-    {0x1F552, ":clock3:"},
-    {0x1F553, ":clock4:"},
-    {0x1F554, ":clock5:"},
-    {0x1F555, ":clock6:"},
-    {0x1F556, ":clock7:"},
-    {0x1F557, ":clock8:"},
-    {0x1F558, ":clock9:"},
-    {0x1F559, ":clock10:"},
-    {0x1F55A, ":clock11:"},
-    {0x1F55B, ":clock12:"},
-    {0x1F55C, ":clock130:"},
-    {0x1F55D, ":clock230:"},
-    {0x1F55E, ":clock330:"},
-    {0x1F55F, ":clock430:"},
-    {0x1F560, ":clock530:"},
-    {0x1F561, ":clock630:"},
-    {0x1F562, ":clock730:"},
-    {0x1F563, ":clock830:"},
-    {0x1F564, ":clock930:"},
-    {0x1F565, ":clock1030:"},
-    {0x1F566, ":clock1130:"},
-    {0x1F567, ":clock1230:"},
+static const uint16_t emojiShortcodeOffsets[] PROGMEM = {
+    0, 5, 14, 25, 34, 45, 50, 55, 63, 71, 79, 85,
+    88, 94, 102, 109, 121, 127, 135, 139, 143, 147, 155, 163,
+    179, 187, 195, 199, 203, 204, 211, 220, 236, 258, 266, 273,
+    294, 303, 310, 311, 338, 346, 359, 375, 386, 409, 414, 429,
+    445, 464, 474, 478, 482, 489, 494, 506, 520, 530, 538, 547,
+    567, 585, 604, 617, 622, 631, 639, 647, 661, 675, 684, 690,
+    695, 709, 713, 721, 730, 737, 748, 752, 768, 778, 789, 795,
+    803, 807, 815, 829, 843, 850, 854, 867, 880, 886, 898, 903,
+    924, 934, 946, 956, 959, 965, 976, 982, 989, 1004, 1014, 1018,
+    1030, 1035, 1043, 1050, 1062, 1067, 1076, 1082, 1098, 1105, 1111, 1124,
+    1130, 1140, 1152, 1158, 1166, 1171, 1188, 1194, 1205, 1213, 1217, 1220,
+    1225, 1235, 1252, 1258, 1274, 1281, 1296, 1311, 1314, 1320, 1322, 1335,
+    1339, 1345, 1352, 1358, 1367, 1373, 1378, 1383, 1386, 1390, 1395, 1401,
+    1408, 1415, 1419, 1423, 1427, 1435, 1442, 1447, 1450, 1453, 1456, 1462,
+    1466, 1479, 1487, 1493, 1507, 1517, 1530, 1534, 1541, 1546, 1552, 1567,
+    1572, 1579, 1584, 1587, 1592, 1598, 1601, 1612, 1617, 1622, 1633, 1636,
+    1639, 1643, 1650, 1654, 1658, 1668, 1676, 1686, 1696, 1706, 1716, 1727,
+    1736, 1740, 1747, 1749, 1751, 1755, 1765, 1770, 1783, 1798, 1803, 1808,
+    1811, 1816, 1825, 1829, 1840, 1847, 1856, 1868, 1878, 1893, 1903, 1908,
+    1918, 1929, 1941, 1953, 1963, 1979, 1995, 1999, 2004, 2008, 2011, 2015,
+    2026, 2033, 2037, 2041, 2047, 2052, 2066, 2081, 2089, 2097, 2108, 2110,
+    2113, 2121, 2145, 2171, 2180, 2189, 2196, 2209, 2218, 2232, 2248, 2252,
+    2262, 2271, 2282, 2287, 2293, 2297, 2304, 2310, 2327, 2346, 2360, 2367,
+    2374, 2383, 2389, 2396, 2410, 2426, 2441, 2447, 2459, 2461, 2466, 2469,
+    2494, 2500, 2510, 2526, 2549, 2563, 2578, 2582, 2587, 2594, 2601, 2608,
+    2621, 2624, 2633, 2636, 2640, 2646, 2650, 2658, 2662, 2674, 2678, 2681,
+    2683, 2687, 2690, 2698, 2708, 2720, 2724, 2728, 2735, 2738, 2742, 2752,
+    2758, 2764, 2776, 2779, 2789, 2798, 2810, 2826, 2834, 2841, 2860, 2879,
+    2889, 2906, 2926, 2944, 2964, 2982, 3000, 3023, 3037, 3053, 3059, 3065,
+    3071, 3077, 3083, 3089, 3095, 3101, 3107, 3114, 3121, 3128, 3136, 3144,
+    3152, 3160, 3168, 3176, 3184, 3192, 3200, 3209, 3218, 3227, 3233, 3243,
+    3275, 3288, 3299, 3309, 3320, 3337, 3342, 3347, 3355, 3359, 3362, 3368,
+    3373, 3384, 3392, 3403, 3407, 3412, 3415, 3423, 3433, 3443, 3448, 3460,
+    3474, 3482, 3487, 3494, 3502, 3512, 3519, 3532, 3552, 3571, 3587, 3615,
+    3643, 3655, 3662, 3667, 3671, 3674, 3683, 3690, 3711, 3719, 3728, 3735,
+    3740, 3746, 3756, 3765, 3768, 3778, 3784, 3794, 3800, 3810, 3817, 3825,
+    3835, 3843, 3847, 3856, 3863, 3873, 3887, 3896, 3907, 3918, 3933, 3943,
+    3955, 3971, 3983, 3994, 4006, 4019, 4031, 4035, 4041, 4051, 4067, 4078,
+    4094, 4111, 4117, 4122, 4132, 4139, 4149, 4153, 4156, 4168, 4178, 4187,
+    4198, 4208, 4212, 4215, 4223, 4228, 4245, 4252, 4260, 4276, 4294, 4311,
+    4325, 4329, 4338, 4351, 4373, 4385, 4399, 4404, 4408, 4415, 4428, 4441,
+    4457, 4473, 4481, 4493, 4498, 4505, 4510, 4522, 4541, 4557, 4574, 4583,
+    4598, 4614, 4631, 4644, 4648, 4655, 4660, 4664, 4667, 4672, 4675, 4683,
+    4692, 4696, 4703, 4709, 4719, 4725, 4730, 4742,
 };
+
+static const char emojiShortcodePool[] PROGMEM =
+    "watchhourglassalarm_clockstopwatchtimer_clocksunnycloudumbrellashamrockpoint_upanchorzapsoccer"
+    "baseballsnowmanpartly_sunnychurchfountaingolfboattentfuelpumpscissorswhite_check_markairplane"
+    "envelopefisthandvpencil2black_nibheavy_check_markheavy_multiplication_xsparklessparkle"
+    "eight_spoked_asterisksnowflakesparklexnegative_squared_cross_markquestiongrey_question"
+    "grey_exclamationexclamationheavy_heart_exclamationheartheavy_plus_signheavy_minus_sign"
+    "heavy_division_signcurly_looploopstarrainbowoceanearth_africaearth_americasearth_asianew_moon"
+    "full_moonwaning_crescent_moonnew_moon_with_facefull_moon_with_facesun_with_facestar2lightning"
+    "chestnutseedlingevergreen_treedeciduous_treepalm_treecactustulipcherry_blossomrosehibiscussunflower"
+    "blossomear_of_riceherbfour_leaf_clovermaple_leaffallen_leafleavesmushroomgiftbirthdayjack_o_lantern"
+    "christmas_treeballoontadaconfetti_balltanabata_treebamboomortar_boardmedalfishing_pole_and_fish"
+    "microphonemovie_cameraheadphonesarttophatcircus_tentticketclapperperforming_artsvideo_gamedart"
+    "slot_machine8ballgame_diebowlingmusical_notenotessaxophoneguitarmusical_keyboardtrumpetviolin"
+    "musical_scoretennisbasketballsports_medaltrophyfootballhousehouse_with_gardenofficepost_office"
+    "hospitalbankatmhotellove_hotelconvenience_storeschooldepartment_storefactoryjapanese_castle"
+    "european_castleratmouse2oxwater_buffalocow2tiger2leoparddragoncrocodilewhale2snailsnakeramgoatsheep"
+    "monkeyroosterchickendog2pig2boarelephantoctopusshellbugantbeebeetlefishtropical_fishblowfishturtle"
+    "hatching_chickbaby_chickhatched_chickbirdpenguinkoalapoodledromedary_camelcameldolphinmousecowtiger"
+    "rabbitcatdragon_facewhalehorsemonkey_facedogpigfroghamsterwolfbearpanda_facepig_nosepaw_prints"
+    "point_up_2point_downpoint_leftpoint_rightfacepunchwaveok_hand+1-1clapopen_handscrownjapanese_ogre"
+    "japanese_goblinghostalienimpskullnail_carekisslove_letterbouquetheartbeatbroken_hearttwo_hearts"
+    "sparkling_heartheartpulsecupidblue_heartgreen_heartyellow_heartpurple_heartgift_heart"
+    "revolving_heartsheart_decorationbulbangerbombzzzboomsweat_dropsdropletdashpoopmuscledizzy"
+    "speech_balloonthought_ballooncomputerminidiscfloppy_diskcddvdcalendarchart_with_upwards_trend"
+    "chart_with_downwards_trendbar_chartclipboardpushpinround_pushpinpaperclipstraight_ruler"
+    "triangular_rulerbookgreen_bookblue_bookorange_bookbooksscrollmemopackagee-mailincoming_envelope"
+    "envelope_with_arrowmailbox_closedmailboxpostboxnewspaperiphonecallingvibration_modemobile_phone_off"
+    "signal_strengthcameravideo_cameratvradiovhstwisted_rightwards_arrowsrepeatrepeat_onearrows_clockwise"
+    "arrows_counterclockwiselow_brightnesshigh_brightnessmutesoundspeakerspeakerbatteryelectric_plugmag"
+    "mag_rightkeylockunlockbellbookmarklinkradio_buttonbackendonsoontopunderagekeycap_tencapital_abcdabcd"
+    "1234symbolsabcfireflashlightwrenchhammernut_and_boltgunmicroscopetelescopecrystal_ball"
+    "six_pointed_starbeginnertridentblack_square_buttonwhite_square_buttonred_circlelarge_blue_circle"
+    "large_orange_diamondlarge_blue_diamondsmall_orange_diamondsmall_blue_diamondsmall_red_triangle"
+    "small_red_triangle_downarrow_up_smallarrow_down_smallclock1clock2clock3clock4clock5clock6clock7"
+    "clock8clock9clock10clock11clock12clock130clock230clock330clock430clock530clock630clock730clock830"
+    "clock930clock1030clock1130clock1230spiderspider_webraised_hand_with_fingers_splayedvulcan_salute"
+    "black_heartmount_fujitokyo_towerstatue_of_libertyjapanmoyaigrinninggrinjoysmileysmilesweat_smile"
+    "laughingsmiling_impwinkblushyumrelievedheart_eyessunglassessmirkneutral_faceexpressionlessunamused"
+    "sweatpensiveconfusedconfoundedkissingkissing_heartkissing_smiling_eyeskissing_closed_eyes"
+    "stuck_out_tonguestuck_out_tongue_winking_eyestuck_out_tongue_closed_eyesdisappointedworriedangryrage"
+    "cryperseveretriumphdisappointed_relievedfrowninganguishedfearfulwearysleepytired_facegrimacingsob"
+    "open_mouthhushedcold_sweatscreamastonishedflushedsleepingdizzy_faceno_mouthmasksmile_catjoy_cat"
+    "smiley_catheart_eyes_catsmirk_catkissing_catpouting_catcrying_cat_facescream_catslight_smile"
+    "upside_down_facerolling_eyessee_no_evilhear_no_evilspeak_no_evilraised_handsprayrockethelicopter"
+    "steam_locomotiverailway_carbullettrain_sidebullettrain_fronttrain2metrolight_railstationlight_rail"
+    "trambusoncoming_bustrolleybusambulancefire_enginepolice_cartaxicarblue_cartruckarticulated_lorry"
+    "tractormonorailmountain_railwaysuspension_railwaymountain_cablewayaerial_tramwayshipspeedboat"
+    "traffic_lightvertical_traffic_lightconstructionrotating_lightflagsbikescootermotor_scooter"
+    "flying_saucermoney_mouth_facethermometer_facethinkinghead_bandagerobothuggingmetalcall_me_hand"
+    "raised_back_of_handleft_facing_fistright_facing_fisthandshakecrossed_fingerslove_you_gesture"
+    "palms_up_togetherwilted_flowerlionunicorneagleduckbatsharkowlfox_facebutterflydeergorillalizard"
+    "rhinocerosshrimpsquidorange_heart";
@@ -0,0 +1,44 @@
+#include "Gb2312.h"
+#include "assets/gb2312.h"
+
+uint16_t gb2312Code(uint32_t cp)
+{
+    uint32_t han = cp - gb2312_han_first;
+    if (han < gb2312_han_words * 32u)
+    {
+        uint32_t word = gb2312_han_bitmap[han / 32];
+        uint32_t bit = 1u << (han % 32);
+        if (!(word & bit))
+        {
+            return 0;
+        }
+        uint16_t index = gb2312_han_rank[han / 32] + __builtin_popcount(word & (bit - 1));
+        return gb2312_han_codes[index];
+    }
+
+    // Last run starting at or before cp.
+    int lo = 0;
+    int hi = gb2312_run_count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (gb2312_run_first[mid] <= cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if (lo == 0)
+    {
+        return 0;
+    }
+    uint32_t offset = cp - gb2312_run_first[lo - 1];
+    if (offset >= gb2312_run_length[lo - 1])
+    {
+        return 0;
+    }
+    return gb2312_run_code[lo - 1] + offset;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Two-byte GB2312 code for cp (high byte first), or 0 when the printer's
+// Chinese font has no such character.
+uint16_t gb2312Code(uint32_t cp);
@@ -0,0 +1,353 @@
+#include "GlyphRaster.h"
+#include "EmojiSprites.h"
+#include "Gb2312.h"
+#include "Normalize.h"
+#include "PrintHelpers.h"
+#include "PrinterControl.h"
+#include "TextTranscoder.h"
+#include "assets/glyphfont.h"
+#include <string.h>
+
+static const uint16_t bandWidth = 384;
+static const uint16_t bandBytes = bandWidth / 8;
+static const uint8_t maxBandHeight = 48;
+static uint8_t band[bandBytes * maxBandHeight];
+
+struct CachedGlyph
+{
+    uint16_t codepoint;
+    uint8_t width;
+    uint32_t lastUse;
+    uint16_t rows[glyphfont_height];
+};
+
+// Small LRU of decoded glyphs; a message rarely uses more distinct
+// non-Latin glyphs than this, so each is unpacked from flash once.
+static const uint8_t glyphCacheSize = 32;
+static CachedGlyph glyphCache[glyphCacheSize];
+static uint32_t glyphClock;
+static uint32_t glyphHits;
+static uint32_t glyphMisses;
+
+static int findGlyph(uint32_t cp)
+{
+    if (cp > 0xFFFF)
+    {
+        return -1;
+    }
+    int lo = 0;
+    int hi = glyphfont_count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint16_t v = glyphfont_codepoints[mid];
+        if (v == cp)
+        {
+            return mid;
+        }
+        if (v < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return -1;
+}
+
+uint8_t rasterGlyphWidth(uint32_t cp)
+{
+    int index = findGlyph(cp);
+    if (index < 0)
+    {
+        return 0;
+    }
+    return (glyphfont_data[glyphfont_offsets[index]] & 0x80) ? 16 : 8;
+}
+
+static const CachedGlyph *loadGlyph(uint32_t cp)
+{
+    glyphClock++;
+    CachedGlyph *victim = &glyphCache[0];
+    for (uint8_t i = 0; i < glyphCacheSize; i++)
+    {
+        CachedGlyph &g = glyphCache[i];
+        if (g.width && g.codepoint == cp)
+        {
+            g.lastUse = glyphClock;
+            glyphHits++;
+            return &g;
+        }
+        if (g.lastUse < victim->lastUse)
+        {
+            victim = &g;
+        }
+    }
+
+    int index = findGlyph(cp);
+    if (index < 0)
+    {
+        return nullptr;
+    }
+    glyphMisses++;
+
+    const uint8_t *p = glyphfont_data + glyphfont_offsets[index];
+    bool wide = p[0] & 0x80;
+    uint8_t first = p[0] & 0x0F;
+    uint8_t count = p[1];
+    p += 2;
+    memset(victim->rows, 0, sizeof(victim->rows));
+    for (uint8_t r = 0; r < count && first + r < glyphfont_height; r++)
+    {
+        if (wide)
+        {
+            victim->rows[first + r] = (uint16_t)((p[0] << 8) | p[1]);
+            p += 2;
+        }
+        else
+        {
+            victim->rows[first + r] = (uint16_t)(p[0] << 8);
+            p++;
+        }
+    }
+    victim->codepoint = (uint16_t)cp;
+    victim->width = wide ? 16 : 8;
+    victim->lastUse = glyphClock;
+    return victim;
+}
+
+void rasterCacheStats(uint32_t &hits, uint32_t &misses)
+{
+    hits = glyphHits;
+    misses = glyphMisses;
+}
+
+bool rasterNeeded(const uint8_t *utf8, size_t len)
+{
+    size_t i = 0;
+    while (i < len)
+    {
+        if (utf8[i] < 0x80)
+        {
+            i++;
+            continue;
+        }
+        uint32_t cp;
+        size_t used = utf8DecodeComposed(utf8 + i, len - i, cp);
+        if (!used)
+        {
+            break;
+        }
+        i += used;
+        if (cp == utf8Invalid || printerHasGlyph(cp) || isCombiningMark(cp) || gb2312Code(cp))
+        {
+            continue;
+        }
+        const char *name;
+        size_t nameLen;
+        if (foldCodepoint(cp, name, nameLen))
+        {
+            continue;
+        }
+        if (!emojiShortcode(cp, name, nameLen) && findGlyph(cp) >= 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct BandLayout
+{
+    uint8_t cellWidth;
+    uint8_t scaleX;
+    uint8_t scaleY;
+    uint8_t height;
+    uint8_t top;
+};
+
+// Draws one glyph into a run of cells starting at x and returns the number
+// of pixels the cells take up.
+static uint16_t drawGlyph(const BandLayout &layout, uint16_t x, uint32_t cp)
+{
+    const CachedGlyph *g = loadGlyph(cp);
+    if (!g)
+    {
+        g = loadGlyph('?');
+        if (!g)
+        {
+            return layout.cellWidth;
+        }
+    }
+    uint16_t cellPx = (uint16_t)(g->width / 8) * layout.cellWidth;
+    uint16_t glyphPx = (uint16_t)g->width * layout.scaleX;
+    uint16_t x0 = x + (cellPx > glyphPx ? (cellPx - glyphPx) / 2 : 0);
+
+    for (uint8_t row = 0; row < glyphfont_height; row++)
+    {
+        uint16_t bits = g->rows[row];
+        if (!bits)
+        {
+            continue;
+        }
+        for (uint8_t col = 0; col < g->width; col++)
+        {
+            if (!(bits & (0x8000 >> col)))
+            {
+                continue;
+            }
+            for (uint8_t sx = 0; sx < layout.scaleX; sx++)
+            {
+                uint16_t px = x0 + col * layout.scaleX + sx;
+                if (px >= bandWidth)
+                {
+                    break;
+                }
+                for (uint8_t sy = 0; sy < layout.scaleY; sy++)
+                {
+                    uint16_t py = layout.top + row * layout.scaleY + sy;
+                    band[py * bandBytes + px / 8] |= (uint8_t)(0x80 >> (px % 8));
+                }
+            }
+        }
+    }
+    return cellPx;
+}
+
+// Draws a 12x24 emoji sprite into one cell, filling the band height the
+// same way the printer would print the user-defined character.
+static uint16_t drawSprite(const BandLayout &layout, uint16_t x, const uint8_t *sprite)
+{
+    uint16_t x0 = x + (layout.cellWidth > 12 ? (layout.cellWidth - 12) / 2 : 0);
+    for (uint8_t col = 0; col < 12; col++)
+    {
+        uint16_t px = x0 + col;
+        if (px >= bandWidth)
+        {
+            break;
+        }
+        for (uint8_t row = 0; row < 24; row++)
+        {
+            if (!(sprite[col * 3 + row / 8] & (0x80 >> (row % 8))))
+            {
+                continue;
+            }
+            for (uint8_t sy = 0; sy < layout.scaleY; sy++)
+            {
+                uint16_t py = row * layout.scaleY + sy;
+                if (py < layout.height)
+                {
+                    band[py * bandBytes + px / 8] |= (uint8_t)(0x80 >> (px % 8));
+                }
+            }
+        }
+    }
+    return layout.cellWidth;
+}
+
+static uint16_t drawAscii(const BandLayout &layout, uint16_t x, const char *text, size_t len)
+{
+    for (size_t i = 0; i < len && x < bandWidth; i++)
+    {
+        x += drawGlyph(layout, x, (uint8_t)text[i]);
+    }
+    return x;
+}
+
+void printRasterLine(const uint8_t *utf8, size_t len)
+{
+    const PrinterSettings &settings = printerTextStyle();
+
+    // Match the cell grid of the text font so raster and text lines wrap
+    // and align the same way.
+    BandLayout layout;
+    layout.cellWidth = (uint8_t)(bandWidth / printerCharsPerLine());
+    layout.scaleX = layout.cellWidth >= 16 ? 2 : 1;
+    layout.scaleY = settings.size >= 1 ? 2 : 1;
+    layout.height = (uint8_t)((settings.font ? 17 : 24) * layout.scaleY);
+    if (layout.height > maxBandHeight)
+    {
+        layout.height = maxBandHeight;
+    }
+    uint8_t glyphHeight = glyphfont_height * layout.scaleY;
+    layout.top = layout.height > glyphHeight ? (layout.height - glyphHeight) / 2 : 0;
+    if (layout.top + glyphHeight > layout.height)
+    {
+        layout.height = layout.top + glyphHeight;
+    }
+
+    memset(band, 0, sizeof(band));
+    uint16_t x = 0;
+    size_t i = 0;
+    while (i < len && x < bandWidth)
+    {
+        uint32_t cp;
+        size_t used = utf8DecodeComposed(utf8 + i, len - i, cp);
+        if (!used)
+        {
+            used = len - i;
+            cp = utf8Invalid;
+        }
+        i += used;
+
+        const char *name;
+        size_t nameLen;
+        if (cp == utf8Invalid)
+        {
+            x = drawAscii(layout, x, "?", 1);
+        }
+        else if (isCombiningMark(cp))
+        {
+            continue;
+        }
+        else if (foldCodepoint(cp, name, nameLen))
+        {
+            x = drawAscii(layout, x, name, nameLen);
+        }
+        else if (findGlyph(cp) >= 0)
+        {
+            x += drawGlyph(layout, x, cp);
+        }
+        else if (emojiSpriteAvailable(cp))
+        {
+            x += drawSprite(layout, x, emojiSpriteBitmap(cp));
+        }
+        else if (emojiShortcode(cp, name, nameLen))
+        {
+            x = drawAscii(layout, x, ":", 1);
+            x = drawAscii(layout, x, name, nameLen);
+            x = drawAscii(layout, x, ":", 1);
+        }
+        else
+        {
+            x = drawAscii(layout, x, "[?]", 3);
+        }
+    }
+
+    // Honour justification by shifting the inked cells inside the band.
+    uint16_t used = x > bandWidth ? bandWidth : x;
+    uint16_t shift = 0;
+    if (settings.justify == 1)
+    {
+        shift = (bandWidth - used) / 2;
+    }
+    else if (settings.justify == 2)
+    {
+        shift = bandWidth - used;
+    }
+    shift &= ~7;
+    if (shift)
+    {
+        for (uint8_t y = 0; y < layout.height; y++)
+        {
+            uint8_t *row = band + y * bandBytes;
+            memmove(row + shift / 8, row, bandBytes - shift / 8);
+            memset(row, 0, shift / 8);
+        }
+    }
+
+    bool upsideDown = (settings.decorations & 0x10) != 0;
+    gsV0WithUpsideDown(bandBytes, layout.height, band, (size_t)bandBytes * layout.height, upsideDown);
+}
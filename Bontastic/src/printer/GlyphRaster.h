@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Width in pixels (8 or 16) of cp in the built-in raster font, 0 if the
+// font has no glyph for it.
+uint8_t rasterGlyphWidth(uint32_t cp);
+
+// True when the text holds a codepoint the printer cannot print natively
+// but the raster font covers.
+bool rasterNeeded(const uint8_t *utf8, size_t len);
+
+// Renders one already wrapped line into a raster band sized to the current
+// font settings and prints it with GS v 0.
+void printRasterLine(const uint8_t *utf8, size_t len);
+
+void rasterCacheStats(uint32_t &hits, uint32_t &misses);
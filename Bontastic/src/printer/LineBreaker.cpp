@@ -0,0 +1,159 @@
+#include "LineBreaker.h"
+#include "TextTranscoder.h"
+#include <string.h>
+
+static const size_t noCursor = (size_t)-1;
+
+LineBreaker::LineBreaker(const uint8_t *text, size_t len, size_t maxColumns)
+    : _text(text), _len(text ? len : 0), _maxColumns(maxColumns ? maxColumns : 1)
+{
+    rewind();
+}
+
+void LineBreaker::rewind()
+{
+    _fwdPos = 0;
+    _fwdParaEnd = 0;
+    _fwdInPara = false;
+
+    // A trailing newline ends the last paragraph instead of opening an
+    // empty one, same as splitting the text forward.
+    _revDone = (_len == 0);
+    _revParaEnd = (_len > 0 && _text[_len - 1] == '\n') ? _len - 1 : _len;
+    _revCursor = noCursor;
+}
+
+size_t LineBreaker::contentEnd(size_t paraStart, size_t paraEnd) const
+{
+    if (paraEnd > paraStart && _text[paraEnd - 1] == '\r')
+    {
+        return paraEnd - 1;
+    }
+    return paraEnd;
+}
+
+// Returns the end of the line that starts at start and sets next to where
+// the following line begins. Breaks at the last space that still fits,
+// or mid-word when there is none; always takes at least one codepoint.
+size_t LineBreaker::breakLine(size_t start, size_t end, size_t &next) const
+{
+    size_t cols = 0;
+    size_t pos = start;
+    size_t lastSpace = noCursor;
+    while (pos < end)
+    {
+        uint32_t cp;
+        size_t used = utf8Decode(_text + pos, end - pos, cp);
+        if (!used)
+        {
+            used = end - pos;
+            cp = utf8Invalid;
+        }
+        size_t width = printerColumns(cp);
+        if (cols + width > _maxColumns && pos > start)
+        {
+            if (_text[pos] == ' ')
+            {
+                next = pos + 1;
+                return pos;
+            }
+            if (lastSpace != noCursor && lastSpace > start)
+            {
+                next = lastSpace + 1;
+                return lastSpace;
+            }
+            next = pos;
+            return pos;
+        }
+        if (_text[pos] == ' ')
+        {
+            lastSpace = pos;
+        }
+        cols += width;
+        pos += used;
+    }
+    next = end;
+    return end;
+}
+
+bool LineBreaker::next(TextSpan &line)
+{
+    if (_fwdPos >= _len)
+    {
+        return false;
+    }
+    if (!_fwdInPara)
+    {
+        const uint8_t *nl = static_cast<const uint8_t *>(memchr(_text + _fwdPos, '\n', _len - _fwdPos));
+        _fwdParaEnd = nl ? (size_t)(nl - _text) : _len;
+        _fwdInPara = true;
+    }
+
+    size_t end = contentEnd(_fwdPos, _fwdParaEnd);
+    size_t next;
+    size_t lineEnd = breakLine(_fwdPos, end, next);
+    line.data = _text + _fwdPos;
+    line.len = lineEnd - _fwdPos;
+
+    if (next >= end)
+    {
+        _fwdPos = _fwdParaEnd + 1;
+        _fwdInPara = false;
+    }
+    else
+    {
+        _fwdPos = next;
+    }
+    return true;
+}
+
+bool LineBreaker::prev(TextSpan &line)
+{
+    if (_revDone)
+    {
+        return false;
+    }
+
+    size_t paraStart = _revParaEnd;
+    while (paraStart > 0 && _text[paraStart - 1] != '\n')
+    {
+        paraStart--;
+    }
+    size_t end = contentEnd(paraStart, _revParaEnd);
+
+    // Greedy wrapping is defined front to back, so re-walk the paragraph to
+    // the last line that starts before the one handed out previously.
+    size_t start = paraStart;
+    size_t lineEnd;
+    while (true)
+    {
+        size_t next;
+        lineEnd = breakLine(start, end, next);
+        if (next >= end || next >= _revCursor)
+        {
+            break;
+        }
+        start = next;
+    }
+
+    line.data = _text + start;
+    line.len = lineEnd - start;
+
+    if (start == paraStart)
+    {
+        _revCursor = noCursor;
+        if (paraStart == 0)
+        {
+            _revDone = true;
+        }
+        else
+        {
+            _revParaEnd = paraStart - 1;
+        }
+    }
+    else
+    {
+        _revCursor = start;
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct TextSpan
+{
+    const uint8_t *data;
+    size_t len;
+};
+
+// Word-wraps UTF-8 text into spans over the original buffer without copying.
+// Widths are measured in printer columns after transcoding, and breaks only
+// fall on codepoint boundaries. Lines can be walked forward with next() or
+// from the last line backwards with prev(); the two directions are
+// independent and neither allocates.
+class LineBreaker
+{
+public:
+    LineBreaker(const uint8_t *text, size_t len, size_t maxColumns);
+
+    bool next(TextSpan &line);
+    bool prev(TextSpan &line);
+    void rewind();
+
+private:
+    const uint8_t *_text;
+    size_t _len;
+    size_t _maxColumns;
+
+    size_t _fwdPos;
+    size_t _fwdParaEnd;
+    bool _fwdInPara;
+
+    size_t _revParaEnd;
+    size_t _revCursor;
+    bool _revDone;
+
+    size_t contentEnd(size_t paraStart, size_t paraEnd) const;
+    size_t breakLine(size_t start, size_t end, size_t &next) const;
+};
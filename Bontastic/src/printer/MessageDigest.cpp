@@ -0,0 +1,139 @@
+#include "MessageDigest.h"
+#include "DeviceStats.h"
+#include "MeshtasticBLELogger.h"
+#include "PrintHelpers.h"
+#include "PrinterControl.h"
+#include <string.h>
+
+// Size limits; reaching either prints the digest early.
+static const uint8_t digestMaxMessages = 12;
+static const size_t digestMaxBytes = 2048;
+
+struct PendingMessage
+{
+    uint16_t offset;
+    uint16_t size;
+    uint32_t timestamp;
+    char sender[40];
+};
+
+static PendingMessage pending[digestMaxMessages];
+static uint8_t pendingCount;
+static uint8_t pool[digestMaxBytes];
+static size_t poolUsed;
+static uint32_t firstQueuedMs;
+static DigestPrintedHandler printedHandler;
+
+static uint32_t digestsPrinted;
+static uint32_t digestedMessages;
+static uint32_t urgentMessages;
+
+static void digestStatsProvider(std::string &out)
+{
+    statsAppend(out, "digest_window_s", getPrinterSettings().digestWindow);
+    statsAppend(out, "digests", digestsPrinted);
+    statsAppend(out, "digested_messages", digestedMessages);
+    statsAppend(out, "urgent_messages", urgentMessages);
+}
+
+void digestSetup(DigestPrintedHandler onPrinted)
+{
+    printedHandler = onPrinted;
+    statsRegisterProvider(digestStatsProvider);
+}
+
+// A job sent while the paper is out is lost, so it does not count.
+static void reportPrinted(uint32_t timestamp)
+{
+    if (printedHandler && !printerPaperOut())
+    {
+        printedHandler(timestamp);
+    }
+}
+
+void digestFlush()
+{
+    if (!pendingCount)
+    {
+        return;
+    }
+    if (pendingCount == 1)
+    {
+        const PendingMessage &m = pending[0];
+        printTextMessage(pool + m.offset, m.size, m.sender, m.timestamp);
+        reportPrinted(m.timestamp);
+    }
+    else
+    {
+        TextMessage messages[digestMaxMessages];
+        for (uint8_t i = 0; i < pendingCount; i++)
+        {
+            const PendingMessage &m = pending[i];
+            messages[i] = {pool + m.offset, m.size, m.sender, m.timestamp};
+        }
+        printTextDigest(messages, pendingCount);
+        for (uint8_t i = 0; i < pendingCount; i++)
+        {
+            reportPrinted(pending[i].timestamp);
+        }
+        digestsPrinted++;
+        digestedMessages += pendingCount;
+    }
+    pendingCount = 0;
+    poolUsed = 0;
+}
+
+void digestQueueText(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp, bool urgent)
+{
+    if (!data || !size)
+    {
+        return;
+    }
+    uint8_t window = getPrinterSettings().digestWindow;
+    if (urgent || !window || size > digestMaxBytes)
+    {
+        if (urgent)
+        {
+            urgentMessages++;
+        }
+        digestFlush();
+        printTextMessage(data, size, sender, timestamp);
+        reportPrinted(timestamp);
+        return;
+    }
+
+    if (poolUsed + size > digestMaxBytes)
+    {
+        digestFlush();
+    }
+    if (!pendingCount)
+    {
+        firstQueuedMs = millis();
+    }
+    PendingMessage &m = pending[pendingCount++];
+    m.offset = (uint16_t)poolUsed;
+    m.size = (uint16_t)size;
+    m.timestamp = timestamp;
+    strlcpy(m.sender, sender ? sender : "", sizeof(m.sender));
+    memcpy(pool + poolUsed, data, size);
+    poolUsed += size;
+    bleLogf("DIGEST queued %u", (unsigned)pendingCount);
+
+    if (pendingCount >= digestMaxMessages)
+    {
+        digestFlush();
+    }
+}
+
+void digestLoop()
+{
+    if (!pendingCount)
+    {
+        return;
+    }
+    uint32_t windowMs = (uint32_t)getPrinterSettings().digestWindow * 1000;
+    if (millis() - firstQueuedMs >= windowMs)
+    {
+        digestFlush();
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Told the timestamp of each message that reaches paper.
+typedef void (*DigestPrintedHandler)(uint32_t timestamp);
+
+// Collects text messages that arrive within the digest window (the
+// digestWindow setting, in seconds) and prints them as one job. Urgent
+// messages such as DMs and alerts print at once, after anything already
+// queued so the paper stays in arrival order. A window of 0 prints every
+// message as it arrives.
+void digestSetup(DigestPrintedHandler onPrinted);
+void digestQueueText(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp, bool urgent);
+void digestLoop();
+void digestFlush();
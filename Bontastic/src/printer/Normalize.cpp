@@ -0,0 +1,94 @@
+#include "Normalize.h"
+#include "TextTranscoder.h"
+#include "assets/normalize.h"
+
+bool isCombiningMark(uint32_t cp)
+{
+    return (cp >= 0x0300 && cp <= 0x036F) || (cp >= 0x1AB0 && cp <= 0x1AFF) ||
+           (cp >= 0x1DC0 && cp <= 0x1DFF) || (cp >= 0x20D0 && cp <= 0x20FF) ||
+           (cp >= 0xFE20 && cp <= 0xFE2F);
+}
+
+uint32_t composePair(uint32_t base, uint32_t mark)
+{
+    if (base >= 0x0500 || mark < 0x0300 || mark > 0x036F)
+    {
+        return 0;
+    }
+    uint32_t key = (base << 7) | (mark - 0x0300);
+    int lo = 0;
+    int hi = normalize_compose_count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint32_t v = normalize_compose_keys[mid];
+        if (v == key)
+        {
+            return normalize_compose_values[mid];
+        }
+        if (v < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+bool foldCodepoint(uint32_t cp, const char *&text, size_t &len)
+{
+    if (cp < 0x00A0 || cp > 0xFFFF)
+    {
+        return false;
+    }
+    int lo = 0;
+    int hi = normalize_fold_count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint16_t v = normalize_fold_codepoints[mid];
+        if (v == cp)
+        {
+            text = normalize_fold_pool + normalize_fold_offsets[mid];
+            len = normalize_fold_offsets[mid + 1] - normalize_fold_offsets[mid];
+            return true;
+        }
+        if (v < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return false;
+}
+
+size_t utf8DecodeComposed(const uint8_t *p, size_t len, uint32_t &cp)
+{
+    size_t used = utf8Decode(p, len, cp);
+    if (!used || cp == utf8Invalid)
+    {
+        return used;
+    }
+    while (used < len)
+    {
+        uint32_t mark;
+        size_t n = utf8Decode(p + used, len - used, mark);
+        if (!n || !isCombiningMark(mark))
+        {
+            break;
+        }
+        uint32_t composed = composePair(cp, mark);
+        if (composed)
+        {
+            cp = composed;
+        }
+        used += n;
+    }
+    return used;
+}
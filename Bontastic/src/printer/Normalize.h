@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Combining marks (U+0300-U+036F and the supplement/extension blocks). They
+// either compose with the preceding letter or are dropped.
+bool isCombiningMark(uint32_t cp);
+
+// Precomposed form of base followed by mark (e.g. e + U+0301 -> U+00E9), or 0.
+uint32_t composePair(uint32_t base, uint32_t mark);
+
+// ASCII stand-in for typographic punctuation and spacing (smart quotes,
+// dashes, ellipsis, NBSP). len is 0 for invisible characters such as ZWJ
+// or variation selectors.
+bool foldCodepoint(uint32_t cp, const char *&text, size_t &len);
+
+// Decodes one codepoint like utf8Decode and folds any combining marks that
+// follow into it, so callers that see a whole line at once get the same
+// characters the streaming transcoder prints.
+size_t utf8DecodeComposed(const uint8_t *p, size_t len, uint32_t &cp);
@@ -4,13 +4,38 @@
 #include "assets/bontastic.h"
 #include "src/printer/assets/congresslogo.h"
 #include "MeshtasticBLELogger.h"
-#include "EmojiTable.h"
+#include "TextTranscoder.h"
+#include "LineBreaker.h"
+#include "GlyphRaster.h"
+#include "Gb2312.h"
+#include "EmojiSprites.h"
+#include "CodePages.h"
+#include "PrintJob.h"
+#include "DeviceStats.h"
+#include "Normalize.h"
 #include <time.h>
-#include <vector>
 #include <sstream>
 
 Bontastic_Thermal printer(&Serial);
 
+// Style the text helpers lay out for; the condensed layout points this at a
+// font B copy of the settings while it prints.
+static const PrinterSettings *textStyle;
+
+// Condensed layout: font B at a tight line height, sender and time sharing
+// the first body line, and one tear-off feed after a burst instead of two
+// lines after every message.
+static const uint8_t condensedLineHeight = 20;
+static const uint32_t tearOffDelayMs = 20000;
+static const uint8_t tearOffLines = 3;
+// Sender of the last condensed line, so a run from one sender names it once.
+static char condensedSender[64];
+static bool tearOffPending;
+static uint32_t lastCondensedMs;
+
+static uint32_t messagesPrinted;
+static uint32_t linesPrinted;
+
 static uint8_t reverseBits(uint8_t b)
 {
     b = (uint8_t)((b & 0xF0) >> 4) | (uint8_t)((b & 0x0F) << 4);
@@ -52,15 +77,20 @@ void gsV0WithUpsideDown(uint16_t widthBytes, uint16_t height, const uint8_t *dat
 void updatePrinterPins(int rx, int tx)
 {
     Serial.end();
-    Serial.begin(9600, SERIAL_8N1, rx, tx);
+    Serial.setTxBufferSize(printerTxBufferBytes);
+    Serial.begin(printerBaud, SERIAL_8N1, rx, tx);
     printer.begin();
+    emojiSlotsReset();
     applyPrinterSettings();
 }
 
+static void printStatsProvider(std::string &out);
+
 void printerSetup()
 {
     const PrinterSettings &settings = getPrinterSettings();
     updatePrinterPins(settings.printerRxPin, settings.printerTxPin);
+    statsRegisterProvider(printStatsProvider);
 }
 
 void printStartupLogo()
@@ -72,109 +102,48 @@ void printStartupLogo()
     printer.feed(2);
 }
 
-std::string processTextForPrinter(const std::string &utf8)
+// Print sink that appends to a std::string, for callers that still want the
+// transcoded text as a value.
+class StringPrint : public Print
 {
-    std::string result;
-    result.reserve(utf8.size());
-    size_t i = 0;
-    while (i < utf8.size())
-    {
-        uint8_t c = utf8[i];
-        if (c < 0x80)
-        {
-            result += (char)c;
-            i++;
-            continue;
-        }
+public:
+    explicit StringPrint(std::string &s) : _s(s) {}
 
-        uint32_t cp = 0;
-        size_t next_i = i;
-
-        if ((c & 0xE0) == 0xC0) // 2-byte
-        {
-            if (i + 1 < utf8.size())
-            {
-                cp = ((c & 0x1F) << 6) | (utf8[i + 1] & 0x3F);
-                next_i += 2;
-            }
-            else
-            {
-                i++;
-                continue;
-            }
-        }
-        else if ((c & 0xF0) == 0xE0) // 3-byte
-        {
-            if (i + 2 < utf8.size())
-            {
-                cp = ((c & 0x0F) << 12) | ((utf8[i + 1] & 0x3F) << 6) | (utf8[i + 2] & 0x3F);
-                next_i += 3;
-            }
-            else
-            {
-                i++;
-                continue;
-            }
-        }
-        else if ((c & 0xF8) == 0xF0) // 4-byte
-        {
-            if (i + 3 < utf8.size())
-            {
-                cp = ((c & 0x07) << 18) | ((utf8[i + 1] & 0x3F) << 12) | ((utf8[i + 2] & 0x3F) << 6) | (utf8[i + 3] & 0x3F);
-                next_i += 4;
-            }
-            else
-            {
-                i++;
-                continue;
-            }
-        }
-        else
-        {
-            i++;
-            continue;
-        }
+    size_t write(uint8_t c) override
+    {
+        _s += (char)c;
+        return 1;
+    }
 
-        // Check if it's a printable ISO-8859-1 char (U+0080 to U+00FF)
-        if (cp >= 0x80 && cp <= 0xFF)
-        {
-            result += (char)cp;
-            i = next_i;
-            continue;
-        }
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        _s.append(reinterpret_cast<const char *>(buffer), size);
+        return size;
+    }
 
-        // Check emoji map
-        bool found = false;
-        for (const auto &entry : emojiTable)
-        {
-            if (entry.codepoint == cp)
-            {
-                result += entry.shortcode;
-                found = true;
-                break;
-            }
-        }
+private:
+    std::string &_s;
+};
 
-        if (!found)
-        {
-            // If it's a high codepoint (likely emoji or symbol), maybe print [?]
-            if (cp > 0xFF)
-            {
-                result += "[?]";
-            }
-            else
-            {
-                result += '?';
-            }
-        }
-        i = next_i;
-    }
+std::string processTextForPrinter(const std::string &utf8)
+{
+    std::string result;
+    result.reserve(utf8.size());
+    StringPrint sink(result);
+    TextTranscoder transcoder(sink);
+    transcoder.write(reinterpret_cast<const uint8_t *>(utf8.data()), utf8.size());
+    transcoder.finish();
     return result;
 }
 
-static int getCharsPerLine()
+const PrinterSettings &printerTextStyle()
 {
-    const PrinterSettings &settings = getPrinterSettings();
+    return textStyle ? *textStyle : getPrinterSettings();
+}
+
+int printerCharsPerLine()
+{
+    const PrinterSettings &settings = printerTextStyle();
     // Standard 58mm Thermal Printer (384 dots width)
     // Font A: 12x24 dots -> 384 / 12 = 32 characters
     // Font B: 9x17 dots  -> 384 / 9  = 42.66 -> 42 characters
@@ -192,78 +161,159 @@ static int getCharsPerLine()
     return baseChars;
 }
 
-static std::vector<std::string> wrapText(const std::string &text, size_t maxWidth)
+static bool isNativeCjk(uint32_t cp)
 {
-    std::vector<std::string> lines;
-    size_t start = 0;
-    size_t len = text.length();
+    return !printerHasGlyph(cp) && gb2312Code(cp);
+}
 
-    while (start < len)
+// Prints one run of a line in text mode, or as a raster band when it
+// needs glyphs the printer lacks.
+static void printLineRun(const uint8_t *utf8, size_t len)
+{
+    if (rasterNeeded(utf8, len))
     {
-        size_t end = text.find('\n', start);
-        if (end == std::string::npos)
-            end = len;
+        printRasterLine(utf8, len);
+        return;
+    }
+    TextTranscoder transcoder(printer);
+    transcoder.write(utf8, len);
+    transcoder.finish();
+    printer.println();
+}
 
-        std::string line = text.substr(start, end - start);
-        if (!line.empty() && line.back() == '\r')
-            line.pop_back();
+// Prints one wrapped line and returns the rows it took. The raster font
+// has no CJK, so a line that needs a band and also holds GB2312 text is
+// split into CJK and non-CJK runs, each on its own row: the CJK runs print
+// in the printer's Chinese mode and the others as bands.
+static size_t printStyledLine(const TextSpan &line, bool upsideDown)
+{
+    if (!rasterNeeded(line.data, line.len))
+    {
+        printLineRun(line.data, line.len);
+        return 1;
+    }
 
-        if (line.empty())
+    // A line is at most 42 columns, so it has fewer runs than this.
+    static const uint8_t maxRuns = 48;
+    uint16_t runEnds[maxRuns];
+    uint8_t runs = 0;
+    bool runCjk = false;
+    size_t i = 0;
+    while (i < line.len)
+    {
+        uint32_t cp;
+        size_t used = utf8DecodeComposed(line.data + i, line.len - i, cp);
+        if (!used)
         {
-            lines.push_back("");
-            start = end + 1;
-            continue;
+            i = line.len;
+            break;
         }
-
-        size_t lineStart = 0;
-        while (lineStart < line.length())
+        // Spaces stay with the run they follow.
+        bool cjk = cp != ' ' && isNativeCjk(cp);
+        if (i && cp != ' ' && cjk != runCjk && runs + 1 < maxRuns)
         {
-            if (line.length() - lineStart <= maxWidth)
-            {
-                lines.push_back(line.substr(lineStart));
-                break;
-            }
-
-            size_t breakPoint = line.rfind(' ', lineStart + maxWidth);
-            if (breakPoint == std::string::npos || breakPoint < lineStart)
-            {
-                breakPoint = lineStart + maxWidth;
-            }
-
-            lines.push_back(line.substr(lineStart, breakPoint - lineStart));
-            lineStart = breakPoint;
-            if (lineStart < line.length() && line[lineStart] == ' ')
-            {
-                lineStart++;
-            }
+            runEnds[runs++] = (uint16_t)i;
         }
+        if (cp != ' ')
+        {
+            runCjk = cjk;
+        }
+        i += used;
+    }
+    runEnds[runs++] = (uint16_t)line.len;
 
-        start = end + 1;
+    for (uint8_t r = 0; r < runs; r++)
+    {
+        // Upside down the printer flips each row, so the runs go out last
+        // to first like the lines do.
+        uint8_t run = upsideDown ? runs - 1 - r : r;
+        size_t start = run ? runEnds[run - 1] : 0;
+        printLineRun(line.data + start, runEnds[run] - start);
     }
-    return lines;
+    return runs;
 }
 
-void printStyledText(const std::string &text)
+// Lines the printer's own character wrap produces for the text.
+static size_t countWrappedLines(const uint8_t *utf8, size_t len, size_t maxColumns)
 {
-    bool upsideDown = (getPrinterSettings().decorations & 0x10) != 0;
-    if (upsideDown)
+    size_t lines = 1;
+    size_t column = 0;
+    size_t i = 0;
+    while (i < len)
     {
-        std::vector<std::string> lines = wrapText(text, getCharsPerLine());
-        for (auto it = lines.rbegin(); it != lines.rend(); ++it)
+        uint32_t cp;
+        size_t used = utf8DecodeComposed(utf8 + i, len - i, cp);
+        if (!used)
         {
-            printer.println(it->c_str());
+            break;
         }
+        i += used;
+        if (cp == '\n')
+        {
+            lines++;
+            column = 0;
+            continue;
+        }
+        size_t width = printerColumns(cp);
+        if (column + width > maxColumns)
+        {
+            lines++;
+            column = 0;
+        }
+        column += width;
     }
-    else
+    return lines;
+}
+
+static size_t printStyledRun(const uint8_t *utf8, size_t len)
+{
+    bool upsideDown = (printerTextStyle().decorations & 0x10) != 0;
+    if (!upsideDown && !rasterNeeded(utf8, len))
+    {
+        TextTranscoder transcoder(printer);
+        transcoder.write(utf8, len);
+        transcoder.finish();
+        printer.println();
+        return countWrappedLines(utf8, len, printerCharsPerLine());
+    }
+
+    // Wrap ourselves so lines the printer cannot render natively can go out
+    // as raster bands while the rest stays in text mode. The printer flips
+    // each line in place, so upside-down output walks the lines last to
+    // first to keep the message readable from the other side.
+    LineBreaker lines(utf8, len, printerCharsPerLine());
+    TextSpan line;
+    size_t count = 0;
+    while (upsideDown ? lines.prev(line) : lines.next(line))
     {
-        printer.println(text.c_str());
+        count += printStyledLine(line, upsideDown);
     }
+    return count;
 }
 
-void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp)
+size_t printStyledText(const uint8_t *utf8, size_t len)
 {
-    bleLogf("TEXT %u bytes", (unsigned)size);
+    // Switch to the code page that covers the message best (e.g. CP1251
+    // for Cyrillic) so it prints as text, then restore the configured one.
+    uint8_t configured = getPrinterSettings().codePage;
+    uint8_t page = bestCodePage(utf8, len, configured);
+    if (page != configured)
+    {
+        bleLogf("TEXT code page %u", page);
+        printer.setCodePage(page);
+        setActiveCodePage(page);
+    }
+    size_t lines = printStyledRun(utf8, len);
+    if (page != configured)
+    {
+        printer.setCodePage(configured);
+        setActiveCodePage(configured);
+    }
+    return lines;
+}
 
+static size_t renderTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp)
+{
     // Format time
     time_t t = (time_t)timestamp;
     struct tm *tm = localtime(&t);
@@ -286,11 +336,178 @@ void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint
     printer.print(F("Time: "));
     printer.println(timeBuf);
 
-    std::string utf8((const char *)data, size);
-    std::string processed = processTextForPrinter(utf8);
+    size_t lines = printStyledText(data, size);
+    printer.feed(2);
+    return 3 + lines + 2;
+}
+
+static void beginCondensedStyle(PrinterSettings &style)
+{
+    style = getPrinterSettings();
+    style.font = 1;
+    style.size = 0;
+    style.decorations &= (uint8_t)~0x08;
+    style.lineHeight = condensedLineHeight;
+    textStyle = &style;
+    printer.setSize('S');
+    printer.setFont('B');
+    printer.doubleWidthOff();
+    printer.setLineHeight(condensedLineHeight);
+}
 
-    printStyledText(processed);
+static void endCondensedStyle()
+{
+    textStyle = nullptr;
+    applyPrinterSettings();
+}
+
+static void formatClock(char *buf, size_t len, uint32_t timestamp)
+{
+    time_t t = (time_t)timestamp;
+    struct tm *tm = localtime(&t);
+    strftime(buf, len, "%H:%M", tm);
+}
+
+// "12:04 Alice: body", or just "12:05 body" while the same sender keeps
+// talking. The prefix goes through the styled path with the body so it
+// wraps with it and a UTF-8 sender name prints correctly. Both are put
+// together on the stack; a body too long for that prints after the prefix
+// as a run of its own.
+static size_t printCondensedLine(const TextMessage &message)
+{
+    char line[320];
+    formatClock(line, sizeof(line), message.timestamp);
+    size_t len = strlen(line);
+    line[len++] = ' ';
+    const char *name = message.sender ? message.sender : "";
+    if (strcmp(condensedSender, name) != 0)
+    {
+        strlcpy(condensedSender, name, sizeof(condensedSender));
+        len += snprintf(line + len, sizeof(line) - len, "%s: ", name);
+        len = len < sizeof(line) ? len : sizeof(line) - 1;
+    }
+    if (len + message.size <= sizeof(line))
+    {
+        memcpy(line + len, message.data, message.size);
+        return printStyledText(reinterpret_cast<const uint8_t *>(line), len + message.size);
+    }
+    size_t lines = printStyledText(reinterpret_cast<const uint8_t *>(line), len);
+    return lines + printStyledText(message.data, message.size);
+}
+
+static size_t renderCondensedMessage(const TextMessage &message)
+{
+    PrinterSettings style;
+    beginCondensedStyle(style);
+    size_t lines = printCondensedLine(message);
+    endCondensedStyle();
+    tearOffPending = true;
+    lastCondensedMs = millis();
+    return lines;
+}
+
+static void printStatsProvider(std::string &out)
+{
+    statsAppend(out, "layout", getPrinterSettings().layout ? "condensed" : "classic");
+    statsAppend(out, "messages", messagesPrinted);
+    statsAppend(out, "lines", linesPrinted);
+    char perMessage[16];
+    uint32_t hundredths = messagesPrinted ? (linesPrinted * 100 + messagesPrinted / 2) / messagesPrinted : 0;
+    snprintf(perMessage, sizeof(perMessage), "%lu.%02lu", (unsigned long)(hundredths / 100), (unsigned long)(hundredths % 100));
+    statsAppend(out, "lines_per_message", perMessage);
+}
+
+void printerIdleLoop()
+{
+    if (tearOffPending && millis() - lastCondensedMs >= tearOffDelayMs)
+    {
+        tearOffPending = false;
+        condensedSender[0] = 0;
+        printer.feed(tearOffLines);
+        linesPrinted += tearOffLines;
+    }
+}
+
+void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp)
+{
+    // Render the whole message before touching the UART, then send it in
+    // one write and keep it for REPRINT. Header, styling and feeds add
+    // well under 128 bytes to the text itself.
+    PrintJob &job = lastPrintJob();
+    beginPrintJob(job, size + 128);
+    size_t lines;
+    if (getPrinterSettings().layout == 1)
+    {
+        TextMessage message = {data, size, sender, timestamp};
+        lines = renderCondensedMessage(message);
+    }
+    else
+    {
+        tearOffPending = false;
+        condensedSender[0] = 0;
+        lines = renderTextMessage(data, size, sender, timestamp);
+    }
+    endPrintJob();
+    messagesPrinted++;
+    linesPrinted += lines;
+    bleLogf("TEXT %u bytes, job %u bytes, ~%lu ms", (unsigned)size, (unsigned)job.size(), (unsigned long)job.transferMs());
+    sendPrintJob(job);
+    statsBootMark("print");
+    statsRefresh(true);
+}
+
+void printTextDigest(const TextMessage *messages, size_t count)
+{
+    if (!messages || !count)
+    {
+        return;
+    }
+    size_t textBytes = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        textBytes += messages[i].size;
+    }
+
+    PrintJob &job = lastPrintJob();
+    beginPrintJob(job, textBytes + 64 * count + 64);
+
+    // One header for the burst, then a compact line per message.
+    char first[8];
+    char last[8];
+    formatClock(first, sizeof(first), messages[0].timestamp);
+    formatClock(last, sizeof(last), messages[count - 1].timestamp);
+    printer.println(F("----------------"));
+    printer.print((unsigned)count);
+    printer.print(F(" messages "));
+    printer.print(first);
+    if (strcmp(first, last) != 0)
+    {
+        printer.print('-');
+        printer.print(last);
+    }
+    printer.println();
+    size_t lines = 2;
+
+    PrinterSettings style;
+    beginCondensedStyle(style);
+    condensedSender[0] = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        lines += printCondensedLine(messages[i]);
+    }
+    endCondensedStyle();
+    condensedSender[0] = 0;
+    tearOffPending = false;
     printer.feed(2);
+    lines += 2;
+    endPrintJob();
+
+    messagesPrinted += count;
+    linesPrinted += lines;
+    bleLogf("DIGEST %u messages, job %u bytes, ~%lu ms", (unsigned)count, (unsigned)job.size(), (unsigned long)job.transferMs());
+    sendPrintJob(job);
+    statsBootMark("print");
+    statsRefresh(true);
 }
 
 void printPosition(double lat, double lon, int32_t alt)
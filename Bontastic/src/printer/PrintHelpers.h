@@ -3,7 +3,25 @@
 #include <Arduino.h>
 #include <string>
 
+struct PrinterSettings;
+
+static const uint32_t printerBaud = 9600;
+// UART transmit buffer; large enough for the startup logo so printing it
+// returns at once and the UART drains while the BLE link comes up.
+static const size_t printerTxBufferBytes = 10 * 1024;
+
+struct TextMessage
+{
+    const uint8_t *data;
+    size_t size;
+    const char *sender;
+    uint32_t timestamp;
+};
+
 void printTextMessage(const uint8_t *data, size_t size, const char *sender, uint32_t timestamp);
+// Prints a burst of messages as one job: a shared header and a compact
+// line per message.
+void printTextDigest(const TextMessage *messages, size_t count);
 
 std::string processTextForPrinter(const std::string &utf8);
 void printPosition(double lat, double lon, int32_t alt);
@@ -14,5 +32,12 @@ void printerSetup();
 void printStartupLogo();
 void updatePrinterPins(int rx, int tx);
 std::string utf8ToIso88591(const std::string &utf8);
-void printStyledText(const std::string &text);
+// Prints UTF-8 text in the current style and returns the lines it took.
+size_t printStyledText(const uint8_t *utf8, size_t len);
+int printerCharsPerLine();
+// Settings the text helpers lay out for: the configured ones, or the
+// condensed layout's font B variant while a condensed message prints.
+const PrinterSettings &printerTextStyle();
+// Emits the tear-off feed once a burst of condensed messages goes quiet.
+void printerIdleLoop();
 void gsV0WithUpsideDown(uint16_t widthBytes, uint16_t height, const uint8_t *data, size_t len, bool upsideDown);
@@ -0,0 +1,95 @@
+#include "PrintJob.h"
+#include "Bontastic_Thermal.h"
+#include "EmojiSprites.h"
+#include "MeshtasticBLELogger.h"
+#include "PrintHelpers.h"
+
+extern Bontastic_Thermal printer;
+
+static PrintJob lastJob;
+static PrintJob *openJob;
+static Stream *jobUart;
+
+void PrintJob::clear()
+{
+    _bytes.clear();
+}
+
+void PrintJob::reserve(size_t len)
+{
+    // Only grows: the buffer keeps the capacity of the largest job so far,
+    // e.g. one with raster bands, instead of shrinking back to the hint.
+    if (len > _bytes.capacity())
+    {
+        _bytes.reserve(len);
+    }
+}
+
+uint32_t PrintJob::transferMs() const
+{
+    // 8N1: ten bit times per byte
+    return (uint32_t)(((uint64_t)_bytes.size() * 10 * 1000) / printerBaud);
+}
+
+size_t PrintJob::write(uint8_t c)
+{
+    _bytes += (char)c;
+    return 1;
+}
+
+size_t PrintJob::write(const uint8_t *buffer, size_t size)
+{
+    _bytes.append(reinterpret_cast<const char *>(buffer), size);
+    return size;
+}
+
+void beginPrintJob(PrintJob &job, size_t sizeHint)
+{
+    job.clear();
+    job.reserve(sizeHint);
+    emojiSlotsSave(job.slotsBefore);
+    openJob = &job;
+    jobUart = printer.stream();
+    printer.setStream(&job);
+}
+
+void endPrintJob()
+{
+    printer.setStream(jobUart);
+    jobUart = nullptr;
+    emojiSlotsSave(openJob->slotsAfter);
+    openJob = nullptr;
+}
+
+void sendPrintJob(const PrintJob &job)
+{
+    Stream *uart = printer.stream();
+    if (!uart || !job.size())
+    {
+        return;
+    }
+    // Bypass the printer's '\r' filtering: the job is already filtered and
+    // raster data may legitimately contain 0x0D.
+    uart->write(job.data(), job.size());
+}
+
+PrintJob &lastPrintJob()
+{
+    return lastJob;
+}
+
+bool reprintLastJob()
+{
+    if (!lastJob.size())
+    {
+        bleLog("REPRINT nothing to print");
+        return false;
+    }
+    // Slots other jobs have reused since get the job's sprites back first.
+    size_t restored = emojiSlotsRestore(printer, lastJob.slotsBefore);
+    bleLogf("REPRINT %u bytes, %u restoring sprites, ~%lu ms", (unsigned)lastJob.size(), (unsigned)restored,
+            (unsigned long)lastJob.transferMs());
+    sendPrintJob(lastJob);
+    emojiSlotsAdopt(lastJob.slotsAfter);
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+#include "EmojiSprites.h"
+#include <string>
+
+// Printer bytes rendered ahead of time. While a job is open the global
+// printer writes into it instead of the UART, so the job holds exactly the
+// bytes a direct print would have sent. It can then go out in one write,
+// be sized and timed before any I/O, and be sent again later.
+class PrintJob : public Stream
+{
+public:
+    void clear();
+    void reserve(size_t len);
+
+    const uint8_t *data() const { return reinterpret_cast<const uint8_t *>(_bytes.data()); }
+    size_t size() const { return _bytes.size(); }
+
+    // Time the bytes take on the printer UART.
+    uint32_t transferMs() const;
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+
+    // Sprite slots as the job found and left them; see emojiSlotsSave().
+    uint8_t slotsBefore[emojiSlotCount];
+    uint8_t slotsAfter[emojiSlotCount];
+
+private:
+    std::string _bytes;
+};
+
+// Redirects the printer into job (cleared and pre-sized to sizeHint) until
+// endPrintJob(). Sprites stay in their slots across jobs; the job records
+// the slots it was rendered against so a replay can restore them first.
+void beginPrintJob(PrintJob &job, size_t sizeHint);
+void endPrintJob();
+
+void sendPrintJob(const PrintJob &job);
+
+// The most recent message job, kept for reprinting. Jobs and the sprite
+// slots belong to the loop task; BLE callbacks ask printerControlLoop() to
+// reprint instead.
+PrintJob &lastPrintJob();
+bool reprintLastJob();
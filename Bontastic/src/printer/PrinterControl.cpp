@@ -3,10 +3,15 @@
 #include <NimBLEAdvertising.h>
 #include <NimBLEDevice.h>
 #include <Preferences.h>
+#include <atomic>
 #include <string>
 #include "PrintHelpers.h"
 #include "Bontastic_Thermal.h"
 #include "MeshtasticBLELogger.h"
+#include "CodePages.h"
+#include "PrintJob.h"
+#include "EmojiSprites.h"
+#include "DeviceStats.h"
 
 extern const char *localDeviceName;
 extern Bontastic_Thermal printer;
@@ -33,7 +38,10 @@ static const char *fieldUuids[] = {
     "5a1a0012-8f19-4a86-9a9e-7b4f7f9b0002",
     "5a1a0013-8f19-4a86-9a9e-7b4f7f9b0002",
     "5a1a0014-8f19-4a86-9a9e-7b4f7f9b0002",
-    "5a1a0019-8f19-4a86-9a9e-7b4f7f9b0002"};
+    "5a1a0019-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a001a-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a001b-8f19-4a86-9a9e-7b4f7f9b0002",
+    "5a1a001d-8f19-4a86-9a9e-7b4f7f9b0002"};
 
 enum SettingField : uint8_t
 {
@@ -57,6 +65,9 @@ enum SettingField : uint8_t
     PrinterTxPin,
     PrintQr,
     PrinterErrorPin,
+    Reprint,
+    Layout,
+    DigestWindow,
     FieldCount
 };
 
@@ -66,6 +77,7 @@ static const char *meshLinkUuid = "5a1a0015-8f19-4a86-9a9e-7b4f7f9b0002";
 static const char *bitmapUuid = "5a1a0016-8f19-4a86-9a9e-7b4f7f9b0002";
 static const char *logUuid = "5a1a0017-8f19-4a86-9a9e-7b4f7f9b0002";
 static const char *printerStatusUuid = "5a1a0018-8f19-4a86-9a9e-7b4f7f9b0002";
+static const char *statsUuid = "5a1a001c-8f19-4a86-9a9e-7b4f7f9b0002";
 
 static NimBLEServer *printerServer;
 static NimBLECharacteristic *characteristics[FieldCount];
@@ -73,9 +85,10 @@ static NimBLECharacteristic *meshLinkCharacteristic;
 static NimBLECharacteristic *bitmapCharacteristic;
 static NimBLECharacteristic *logCharacteristic;
 static NimBLECharacteristic *printerStatusCharacteristic;
+static NimBLECharacteristic *statsCharacteristic;
 static bool lastMeshLink;
 static bool lastPrinterErrorState = false;
-static const PrinterSettings defaultSettings{11, 120, 40, 10, 2, 30, 0, 0, 0, 0, 0, 2, 23, "MO1_1dfd", "123456", 1, 2, 22};
+static const PrinterSettings defaultSettings{11, 120, 40, 10, 2, 30, 0, 0, 0, 0, 0, 2, 23, "MO1_1dfd", "123456", 1, 2, 22, 0, 0};
 static PrinterSettings printerSettings = defaultSettings;
 static Preferences printerPrefs;
 static bool prefsReady;
@@ -88,6 +101,29 @@ static const uint16_t bitmapWidth = 384;
 static uint8_t bitmapHeader[8];
 static uint8_t bitmapHeaderReceived;
 static uint32_t bitmapLastLog;
+// Set by the NimBLE task once the whole image is in; loop() prints it and
+// clears the flag, and chunks are refused until then.
+static std::atomic<bool> bitmapReady;
+
+// Writes arrive on the NimBLE host task while loop() may be rendering a
+// message into a print job through the same printer, so anything that
+// prints or changes printer state is left to printerControlLoop(). Settings
+// only need their field applied, so repeated writes to one field coalesce;
+// text and QR payloads wait in a small queue.
+static std::atomic<uint32_t> pendingFields; // one bit per SettingField
+static const uint8_t printQueueSize = 4;     // power of two
+static const size_t printQueueBytes = 512;   // largest attribute value
+
+struct PrintRequest
+{
+    uint8_t field;
+    uint16_t len;
+    uint8_t data[printQueueBytes];
+};
+
+static PrintRequest printQueue[printQueueSize];
+static std::atomic<uint8_t> printQueueHead; // next slot to write, NimBLE task only
+static std::atomic<uint8_t> printQueueTail; // next slot to read, loop() only
 
 static void handleBitmapChunk(const uint8_t *data, size_t len)
 {
@@ -95,6 +131,11 @@ static void handleBitmapChunk(const uint8_t *data, size_t len)
     {
         return;
     }
+    if (bitmapReady)
+    {
+        bleLog("BMP busy");
+        return;
+    }
 
     if (bitmapExpected != 0 && len >= 2 && data[0] == 0x42 && data[1] == 0x4d)
     {
@@ -148,19 +189,26 @@ static void handleBitmapChunk(const uint8_t *data, size_t len)
 
     if (bitmapReceived == bitmapExpected)
     {
-        bleLog("BMP print");
-        bool upsideDown = (printerSettings.decorations & 0x10) != 0;
-        gsV0WithUpsideDown(bitmapWidth / 8, bitmapHeight,
-                           reinterpret_cast<const uint8_t *>(bitmapBuffer.data()), bitmapBuffer.size(), upsideDown);
-        printer.feed(2);
-        bleLog("BMP done");
-        bitmapExpected = 0;
-        bitmapReceived = 0;
-        bitmapHeaderReceived = 0;
-        bitmapBuffer.clear();
+        bitmapReady = true;
     }
 }
 
+// loop(): prints the image the NimBLE task finished receiving.
+static void printBitmap()
+{
+    bleLog("BMP print");
+    bool upsideDown = (printerSettings.decorations & 0x10) != 0;
+    gsV0WithUpsideDown(bitmapWidth / 8, bitmapHeight,
+                       reinterpret_cast<const uint8_t *>(bitmapBuffer.data()), bitmapBuffer.size(), upsideDown);
+    printer.feed(2);
+    bleLog("BMP done");
+    bitmapExpected = 0;
+    bitmapReceived = 0;
+    bitmapHeaderReceived = 0;
+    bitmapBuffer.clear();
+    bitmapReady = false;
+}
+
 static void syncMeshLink(bool notify)
 {
     if (!meshLinkCharacteristic)
@@ -218,6 +266,12 @@ static const char *fieldLabel(uint8_t field)
         return "PRINT_QR";
     case PrinterErrorPin:
         return "PRINTER_ERR";
+    case Reprint:
+        return "REPRINT";
+    case Layout:
+        return "LAYOUT";
+    case DigestWindow:
+        return "DIGEST_WINDOW";
     default:
         return nullptr;
     }
@@ -243,7 +297,10 @@ static const char *fieldKeys[] = {
     "printerRxPin",
     "printerTxPin",
     nullptr,
-    "printerErrPin"};
+    "printerErrPin",
+    nullptr,
+    "layout",
+    "digestWindow"};
 
 static void *fieldSlot(uint8_t field);
 
@@ -354,8 +411,13 @@ static void *fieldSlot(uint8_t field)
         return &printerSettings.printerTxPin;
     case PrinterErrorPin:
         return &printerSettings.printerErrorPin;
+    case Layout:
+        return &printerSettings.layout;
+    case DigestWindow:
+        return &printerSettings.digestWindow;
     case PrintText:
     case PrintQr:
+    case Reprint:
         return nullptr;
     default:
         return nullptr;
@@ -392,12 +454,17 @@ static uint16_t clampField(uint8_t field, int value)
         return constrain(value, 0, 15);
     case CodePage:
         return constrain(value, 0, 47);
+    case Layout:
+        return constrain(value, 0, 1);
+    case DigestWindow:
+        return constrain(value, 0, 120);
     case PrinterRxPin:
     case PrinterTxPin:
     case PrinterErrorPin:
         return constrain(value, 0, 40);
     case PrintText:
     case PrintQr:
+    case Reprint:
         return 0;
     default:
         return value < 0 ? 0 : value;
@@ -465,7 +532,15 @@ static void applyPrinterConfig()
     printer.setLineHeight(printerSettings.lineHeight);
     printer.setCharset(printerSettings.charset);
     printer.setCodePage(printerSettings.codePage);
+    setActiveCodePage(printerSettings.codePage);
     printer.setFont(printerSettings.font ? 'B' : 'A');
+    // Sprites are defined for one font; a changed font setting starts over.
+    static uint8_t appliedFont = printerSettings.font;
+    if (printerSettings.font != appliedFont)
+    {
+        appliedFont = printerSettings.font;
+        emojiSlotsReset();
+    }
     printer.setSize(printerSettings.size == 0 ? 'S' : (printerSettings.size == 1 ? 'M' : 'L'));
     printer.justify(printerSettings.justify == 0 ? 'L' : (printerSettings.justify == 1 ? 'C' : 'R'));
     bool bold = printerSettings.decorations & 0x01;
@@ -533,27 +608,42 @@ static void applyFeed()
     syncField(Feed, true);
 }
 
+static void markPending(uint8_t field)
+{
+    pendingFields.fetch_or(1u << field);
+}
+
+static void queuePrint(uint8_t field, const std::string &payload)
+{
+    uint8_t head = printQueueHead.load(std::memory_order_relaxed);
+    if ((uint8_t)(head - printQueueTail.load(std::memory_order_acquire)) >= printQueueSize)
+    {
+        bleLogf("%s dropped, printer busy", fieldLabel(field));
+        return;
+    }
+    PrintRequest &request = printQueue[head % printQueueSize];
+    request.field = field;
+    request.len = payload.size() < printQueueBytes ? payload.size() : printQueueBytes;
+    memcpy(request.data, payload.data(), request.len);
+    printQueueHead.store(head + 1, std::memory_order_release);
+}
+
+// NimBLE host task: stores the setting and leaves the printer to
+// printerControlLoop().
 static void handleWrite(uint8_t field, const std::string &payload)
 {
     if (payload.empty())
     {
         return;
     }
-    if (field == PrintText)
+    if (field == PrintText || field == PrintQr)
     {
-        std::string processed = processTextForPrinter(payload);
-        printStyledText(processed);
-        printer.feed(2);
+        queuePrint(field, payload);
         return;
     }
-    if (field == PrintQr)
+    if (field == Reprint)
     {
-        printer.qrSelectModel(2);
-        printer.qrSetModuleSize(4);
-        printer.qrSetErrorCorrection(48);
-        printer.qrStoreData(reinterpret_cast<const uint8_t *>(payload.data()), payload.size());
-        printer.qrPrint();
-        printer.feed(2);
+        markPending(field);
         return;
     }
     if (field == MeshName || field == MeshPin)
@@ -563,7 +653,7 @@ static void handleWrite(uint8_t field, const std::string &payload)
         strlcpy(slot, payload.c_str(), maxLen);
         syncField(field, true);
         persistField(field);
-        logField(field, 0);
+        markPending(field);
         return;
     }
 
@@ -572,8 +662,7 @@ static void handleWrite(uint8_t field, const std::string &payload)
     if (field == Feed)
     {
         printerSettings.feedRows = static_cast<uint8_t>(clamped);
-        logField(field, clamped);
-        applyFeed();
+        markPending(field);
         return;
     }
     uint8_t *slot = (uint8_t *)fieldSlot(field);
@@ -588,20 +677,73 @@ static void handleWrite(uint8_t field, const std::string &payload)
     }
     *slot = static_cast<uint8_t>(clamped);
     syncField(field, true);
-    if (field == PrinterRxPin || field == PrinterTxPin)
+    persistField(field);
+    markPending(field);
+}
+
+static void printRequest(const PrintRequest &request)
+{
+    if (request.field == PrintText)
+    {
+        printStyledText(request.data, request.len);
+        printer.feed(2);
+        return;
+    }
+    printer.qrSelectModel(2);
+    printer.qrSetModuleSize(4);
+    printer.qrSetErrorCorrection(48);
+    printer.qrStoreData(request.data, request.len);
+    printer.qrPrint();
+    printer.feed(2);
+}
+
+// loop(): applies the settings written since the last call, then prints
+// what was queued, in arrival order, and a requested reprint last.
+static void runPendingWrites()
+{
+    uint32_t fields = pendingFields.exchange(0);
+    if (fields & (1u << PrinterRxPin | 1u << PrinterTxPin))
     {
         updatePrinterPins(printerSettings.printerRxPin, printerSettings.printerTxPin);
     }
-    else if (field == PrinterErrorPin)
+    if (fields & (1u << PrinterErrorPin))
     {
         pinMode(printerSettings.printerErrorPin, INPUT);
     }
-    else
+    const uint32_t notPrinterConfig = 1u << Feed | 1u << Reprint | 1u << MeshName | 1u << MeshPin | 1u << PrinterRxPin |
+                                 1u << PrinterTxPin | 1u << PrinterErrorPin;
+    if (fields & ~notPrinterConfig)
     {
         applyPrinterConfig();
     }
-    persistField(field);
-    logField(field, clamped);
+    for (uint8_t field = 0; field < FieldCount; ++field)
+    {
+        if (!(fields & (1u << field)) || field == Feed || field == Reprint)
+        {
+            continue;
+        }
+        uint8_t *slot = (uint8_t *)fieldSlot(field);
+        logField(field, field == MeshName || field == MeshPin ? 0 : *slot);
+    }
+    if (fields & (1u << Feed))
+    {
+        logField(Feed, printerSettings.feedRows);
+        applyFeed();
+    }
+
+    while (printQueueHead.load(std::memory_order_acquire) != printQueueTail.load(std::memory_order_relaxed))
+    {
+        printRequest(printQueue[printQueueTail.load(std::memory_order_relaxed) % printQueueSize]);
+        printQueueTail.fetch_add(1, std::memory_order_release);
+    }
+    if (fields & (1u << Reprint))
+    {
+        reprintLastJob();
+    }
+    if (bitmapReady)
+    {
+        printBitmap();
+    }
 }
 
 class SettingCallbacks : public NimBLECharacteristicCallbacks
@@ -654,6 +796,27 @@ class BitmapCallbacks : public NimBLECharacteristicCallbacks
 
 static BitmapCallbacks bitmapCallbacks;
 
+class StatsCallbacks : public NimBLECharacteristicCallbacks
+{
+    void onRead(NimBLECharacteristic *, NimBLEConnInfo &) override
+    {
+        // Serves the page loop() built last and asks for a fresh one.
+        statsRequestRefresh();
+    }
+
+    void onWrite(NimBLECharacteristic *c, NimBLEConnInfo &) override
+    {
+        statsSelectPage((uint8_t)atoi(c->getValue().c_str()));
+    }
+
+    void onSubscribe(NimBLECharacteristic *, NimBLEConnInfo &connInfo, uint16_t subValue) override
+    {
+        statsSetSubscribed(connInfo.getConnHandle(), subValue != 0);
+    }
+};
+
+static StatsCallbacks statsCallbacks;
+
 void setupPrinterControl()
 {
     if (printerServer)
@@ -667,7 +830,7 @@ void setupPrinterControl()
     NimBLEService *service = printerServer->createService(serviceUuid);
     for (uint8_t i = 0; i < FieldCount; ++i)
     {
-        if (i == PrintText || i == PrintQr)
+        if (i == PrintText || i == PrintQr || i == Reprint)
         {
             characteristics[i] = service->createCharacteristic(fieldUuids[i], NIMBLE_PROPERTY::WRITE);
         }
@@ -691,6 +854,10 @@ void setupPrinterControl()
     printerStatusCharacteristic = service->createCharacteristic(printerStatusUuid, NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY);
     printerStatusCharacteristic->setValue(lastPrinterErrorState ? "1" : "0");
 
+    statsCharacteristic = service->createCharacteristic(statsUuid, NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::NOTIFY);
+    statsCharacteristic->setCallbacks(&statsCallbacks);
+    statsAttachCharacteristic(statsCharacteristic);
+
     service->start();
     loadSettings();
     pinMode(printerSettings.printerErrorPin, INPUT);
@@ -716,6 +883,9 @@ void setupPrinterControl()
 
 void printerControlLoop()
 {
+    runPendingWrites();
+    statsLoop();
+
     bool linked = meshtasticConnected;
     if (linked != lastMeshLink)
     {
@@ -745,3 +915,8 @@ const PrinterSettings &getPrinterSettings()
 {
     return printerSettings;
 }
+
+bool printerPaperOut()
+{
+    return lastPrinterErrorState;
+}
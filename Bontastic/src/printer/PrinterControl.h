@@ -17,16 +17,22 @@ struct PrinterSettings
     uint8_t feedRows;
     uint8_t charset;
     uint8_t codePage;
-    char meshName[32];
+    char meshName[64]; // comma-separated, one name per radio
     char meshPin[16];
     uint8_t printerRxPin;
     uint8_t printerTxPin;
     uint8_t printerErrorPin;
+    uint8_t layout;
+    uint8_t digestWindow;
 };
 
 void sendMeshtasticNotification(const char *message);
 
 void setupPrinterControl();
+// Applies settings and runs the prints written over BLE; the callbacks only
+// record them, since loop() owns the printer.
 void printerControlLoop();
 const PrinterSettings &getPrinterSettings();
+// True while the printer's error line reports no paper.
+bool printerPaperOut();
 void applyPrinterSettings();
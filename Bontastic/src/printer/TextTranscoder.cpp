@@ -0,0 +1,388 @@
+#include "TextTranscoder.h"
+#include "EmojiTable.h"
+#include "GlyphRaster.h"
+#include "EmojiSprites.h"
+#include "Bontastic_Thermal.h"
+#include "CodePages.h"
+#include "Gb2312.h"
+#include "Normalize.h"
+#include <string.h>
+
+size_t utf8Decode(const uint8_t *p, size_t len, uint32_t &cp)
+{
+    uint8_t c = p[0];
+    if (c < 0x80)
+    {
+        cp = c;
+        return 1;
+    }
+
+    // Lead byte decides the length and the allowed range of the first
+    // continuation byte (Unicode table 3-7), which rules out overlong forms,
+    // surrogates and anything above U+10FFFF.
+    size_t need;
+    uint32_t v;
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF)
+    {
+        need = 1;
+        v = c & 0x1F;
+    }
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        need = 2;
+        v = c & 0x0F;
+        if (c == 0xE0)
+            lo = 0xA0;
+        else if (c == 0xED)
+            hi = 0x9F;
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        need = 3;
+        v = c & 0x07;
+        if (c == 0xF0)
+            lo = 0x90;
+        else if (c == 0xF4)
+            hi = 0x8F;
+    }
+    else
+    {
+        cp = utf8Invalid;
+        return 1;
+    }
+
+    for (size_t i = 1; i <= need; i++)
+    {
+        if (i >= len)
+        {
+            return 0;
+        }
+        uint8_t b = p[i];
+        if (b < lo || b > hi)
+        {
+            cp = utf8Invalid;
+            return i;
+        }
+        v = (v << 6) | (b & 0x3F);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    cp = v;
+    return need + 1;
+}
+
+static size_t asciiRunLength(const uint8_t *p, size_t len)
+{
+    size_t n = 0;
+    while (n + sizeof(uint32_t) <= len)
+    {
+        uint32_t w;
+        memcpy(&w, p + n, sizeof(w));
+        if (w & 0x80808080u)
+        {
+            break;
+        }
+        n += sizeof(w);
+    }
+    while (n < len && p[n] < 0x80)
+    {
+        n++;
+    }
+    return n;
+}
+
+// Binary search over the generated, plane-split emoji table. Returns the entry
+// index or -1 when the codepoint has no shortcode.
+static int findEmoji(uint32_t cp)
+{
+    if (cp > 0x1FFFF)
+    {
+        return -1;
+    }
+    int lo = (cp > 0xFFFF) ? emojiBmpCount : 0;
+    int hi = (cp > 0xFFFF) ? emojiCount : emojiBmpCount;
+    uint16_t key = (uint16_t)(cp & 0xFFFF);
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint16_t v = emojiCodepoints[mid];
+        if (v == key)
+        {
+            return mid;
+        }
+        if (v < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return -1;
+}
+
+bool printerHasGlyph(uint32_t cp)
+{
+    return codePageByte(cp) != 0;
+}
+
+bool emojiShortcode(uint32_t cp, const char *&name, size_t &len)
+{
+    int emoji = findEmoji(cp);
+    if (emoji < 0)
+    {
+        return false;
+    }
+    name = emojiShortcodePool + emojiShortcodeOffsets[emoji];
+    len = emojiShortcodeOffsets[emoji + 1] - emojiShortcodeOffsets[emoji];
+    return true;
+}
+
+size_t printerColumns(uint32_t cp)
+{
+    if (cp == utf8Invalid || printerHasGlyph(cp))
+    {
+        return 1;
+    }
+    if (isCombiningMark(cp))
+    {
+        return 0;
+    }
+    const char *text;
+    size_t textLen;
+    if (foldCodepoint(cp, text, textLen))
+    {
+        return textLen;
+    }
+    if (emojiSpriteAvailable(cp))
+    {
+        return 1;
+    }
+    if (gb2312Code(cp))
+    {
+        return 2;
+    }
+    const char *name;
+    size_t len;
+    if (emojiShortcode(cp, name, len))
+    {
+        return len + 2;
+    }
+    uint8_t width = rasterGlyphWidth(cp);
+    if (width)
+    {
+        return width / 8;
+    }
+    return 3;
+}
+
+TextTranscoder::TextTranscoder(Print &out)
+    : _out(out), _printer(nullptr), _written(0), _carryLen(0), _chinese(false), _hasPending(false), _pending(0)
+{
+}
+
+TextTranscoder::TextTranscoder(Bontastic_Thermal &printer)
+    : _out(printer), _printer(&printer), _written(0), _carryLen(0), _chinese(false), _hasPending(false), _pending(0)
+{
+}
+
+void TextTranscoder::write(const uint8_t *data, size_t len)
+{
+    if (!data)
+    {
+        return;
+    }
+
+    // Finish a sequence that was split across write() calls. The carried
+    // bytes are a valid prefix, so a rejection can only be caused by the
+    // byte just added, which then starts the next sequence.
+    while (_carryLen && len)
+    {
+        _carry[_carryLen++] = *data++;
+        len--;
+        uint32_t cp;
+        size_t used = utf8Decode(_carry, _carryLen, cp);
+        if (!used)
+        {
+            continue;
+        }
+        if (used < _carryLen)
+        {
+            data--;
+            len++;
+        }
+        _carryLen = 0;
+        writeCodepoint(cp);
+    }
+
+    size_t i = 0;
+    while (i < len)
+    {
+        size_t run = asciiRunLength(data + i, len - i);
+        if (run)
+        {
+            // The last letter of the run is held back in case a combining
+            // mark follows it.
+            flushPending();
+            if (run > 1)
+            {
+                emit(reinterpret_cast<const char *>(data + i), run - 1);
+            }
+            _pending = data[i + run - 1];
+            _hasPending = true;
+            i += run;
+            continue;
+        }
+
+        uint32_t cp;
+        size_t used = utf8Decode(data + i, len - i, cp);
+        if (!used)
+        {
+            _carryLen = (uint8_t)(len - i);
+            memcpy(_carry, data + i, _carryLen);
+            return;
+        }
+        writeCodepoint(cp);
+        i += used;
+    }
+}
+
+void TextTranscoder::finish()
+{
+    if (_carryLen)
+    {
+        _carryLen = 0;
+        writeCodepoint(utf8Invalid);
+    }
+    flushPending();
+    setChinese(false);
+}
+
+// Combining marks are merged into the held-back base letter when a
+// precomposed form exists and dropped otherwise, so "e" + U+0301 prints as
+// the code page's "é" instead of "e?".
+void TextTranscoder::writeCodepoint(uint32_t cp)
+{
+    if (isCombiningMark(cp))
+    {
+        if (_hasPending)
+        {
+            uint32_t composed = composePair(_pending, cp);
+            if (composed)
+            {
+                _pending = composed;
+            }
+        }
+        return;
+    }
+    flushPending();
+    _pending = cp;
+    _hasPending = true;
+}
+
+void TextTranscoder::flushPending()
+{
+    if (_hasPending)
+    {
+        _hasPending = false;
+        writeMapped(_pending);
+    }
+}
+
+// ASCII prints the same in and out of Chinese mode, so the mode is only
+// left for bytes that would otherwise pair up into a GB2312 code.
+void TextTranscoder::setChinese(bool on)
+{
+    if (on == _chinese)
+    {
+        return;
+    }
+    if (on)
+    {
+        _printer->chineseModeOn();
+    }
+    else
+    {
+        _printer->chineseModeOff();
+    }
+    _chinese = on;
+    _written += 2;
+}
+
+void TextTranscoder::writeMapped(uint32_t cp)
+{
+    if (cp == utf8Invalid)
+    {
+        emit('?');
+        return;
+    }
+
+    if (cp < 0x80)
+    {
+        emit((char)cp);
+        return;
+    }
+
+    // Character of the active code page
+    uint8_t b = codePageByte(cp);
+    if (b)
+    {
+        if (b >= 0x80)
+        {
+            setChinese(false);
+        }
+        emit((char)b);
+        return;
+    }
+
+    // Typographic punctuation the page lacks, before GB2312 would turn it
+    // into a full-width glyph
+    const char *text;
+    size_t textLen;
+    if (foldCodepoint(cp, text, textLen))
+    {
+        emit(text, textLen);
+        return;
+    }
+
+    if (_printer && emojiSpriteAvailable(cp))
+    {
+        setChinese(false);
+        _written += printEmojiSprite(*_printer, cp);
+        return;
+    }
+
+    uint16_t gb = _printer ? gb2312Code(cp) : 0;
+    if (gb)
+    {
+        setChinese(true);
+        emit((char)(gb >> 8));
+        emit((char)(gb & 0xFF));
+        return;
+    }
+
+    const char *name;
+    size_t len;
+    if (emojiShortcode(cp, name, len))
+    {
+        emit(':');
+        emit(name, len);
+        emit(':');
+        return;
+    }
+
+    emit("[?]", 3);
+}
+
+void TextTranscoder::emit(const char *data, size_t len)
+{
+    _written += _out.write(reinterpret_cast<const uint8_t *>(data), len);
+}
+
+void TextTranscoder::emit(char c)
+{
+    _written += _out.write((uint8_t)c);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+
+class Bontastic_Thermal;
+
+// Decodes one strict UTF-8 sequence from p. Returns the number of bytes
+// consumed and sets cp, or returns 0 when p holds a valid but incomplete
+// prefix (more input needed). Overlong forms, surrogates, values above
+// U+10FFFF and stray continuation bytes are rejected: cp is set to
+// utf8Invalid and the maximal invalid subpart is consumed.
+static const uint32_t utf8Invalid = 0xFFFFFFFF;
+size_t utf8Decode(const uint8_t *p, size_t len, uint32_t &cp);
+
+// True when the printer's current code page holds cp as a single character.
+bool printerHasGlyph(uint32_t cp);
+
+// Shortcode for an emoji codepoint, without the colons.
+bool emojiShortcode(uint32_t cp, const char *&name, size_t &len);
+
+// Number of printer columns cp takes, in text mode or, for codepoints only
+// the raster font covers, in a raster line. GB2312 characters take two.
+size_t printerColumns(uint32_t cp);
+
+// Streams UTF-8 text into printer bytes without building intermediate
+// strings. Pure ASCII runs are checked a word at a time and handed to the
+// output in bulk; everything else is normalized (combining marks composed,
+// punctuation folded) and goes through the codepoint mapping.
+class TextTranscoder
+{
+public:
+    explicit TextTranscoder(Print &out);
+    // Writing to the printer itself also allows inline emoji sprites and
+    // CJK through the printer's GB2312 mode.
+    explicit TextTranscoder(Bontastic_Thermal &printer);
+
+    void write(const uint8_t *data, size_t len);
+    void finish();
+
+    size_t bytesWritten() const { return _written; }
+
+private:
+    Print &_out;
+    Bontastic_Thermal *_printer;
+    size_t _written;
+    uint8_t _carry[4];
+    uint8_t _carryLen;
+    bool _chinese;
+    bool _hasPending;
+    uint32_t _pending;
+
+    void writeCodepoint(uint32_t cp);
+    void flushPending();
+    void writeMapped(uint32_t cp);
+    void setChinese(bool on);
+    void emit(const char *data, size_t len);
+    void emit(char c);
+};
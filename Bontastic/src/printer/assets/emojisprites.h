@@ -0,0 +1,117 @@
+#ifndef _emojisprites_h_
+#define _emojisprites_h_
+
+// Generated by tools/gen_emoji_sprites.py from tools/emoji_sprites.txt - do not edit.
+
+#define emojisprites_count 29
+#define emojisprites_width 12
+#define emojisprites_bytes 36
+
+static const uint32_t PROGMEM emojisprites_codepoints[] = {
+    0x02600, 0x026A1, 0x02705, 0x02714, 0x02716, 0x0274C, 0x02764, 0x02B50,
+    0x1F31F, 0x1F44D, 0x1F44E, 0x1F4CD, 0x1F50B, 0x1F525, 0x1F600, 0x1F601,
+    0x1F602, 0x1F603, 0x1F604, 0x1F609, 0x1F60A, 0x1F60D, 0x1F60E, 0x1F610,
+    0x1F614, 0x1F61E, 0x1F622, 0x1F62E, 0x1F642,
+};
+
+static const uint8_t PROGMEM emojisprites_index[] = {
+    18, 19, 16, 16, 17, 17, 12, 15, 15, 13, 14, 21, 20, 22, 0, 1,
+    2, 0, 1, 5, 4, 6, 7, 8, 10, 10, 9, 11, 3,
+};
+
+static const uint8_t PROGMEM emojisprites_data[] = {
+    // U+1F600
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x6A, 0x80,
+    0x02, 0x69, 0x40, 0x02, 0x09, 0x40, 0x02, 0x09, 0x40, 0x02, 0x69, 0x40,
+    0x01, 0x6A, 0x80, 0x01, 0x0C, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F604
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x2C, 0x80, 0x01, 0x4A, 0x80,
+    0x02, 0x29, 0x40, 0x02, 0x09, 0x40, 0x02, 0x09, 0x40, 0x02, 0x29, 0x40,
+    0x01, 0x4A, 0x80, 0x01, 0x2C, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F602
+    0x00, 0x7E, 0x00, 0x00, 0xB9, 0x00, 0x01, 0x44, 0x80, 0x01, 0x4A, 0x80,
+    0x02, 0x29, 0x40, 0x02, 0x09, 0x40, 0x02, 0x09, 0x40, 0x02, 0x29, 0x40,
+    0x01, 0x4A, 0x80, 0x01, 0x44, 0x80, 0x00, 0xB9, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F642
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x04, 0x80, 0x01, 0x62, 0x80,
+    0x02, 0x61, 0x40, 0x02, 0x01, 0x40, 0x02, 0x01, 0x40, 0x02, 0x61, 0x40,
+    0x01, 0x62, 0x80, 0x01, 0x04, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F60A
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x24, 0x80, 0x01, 0x42, 0x80,
+    0x02, 0x21, 0x40, 0x02, 0x01, 0x40, 0x02, 0x01, 0x40, 0x02, 0x21, 0x40,
+    0x01, 0x42, 0x80, 0x01, 0x24, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F609
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x04, 0x80, 0x01, 0x62, 0x80,
+    0x02, 0x61, 0x40, 0x02, 0x01, 0x40, 0x02, 0x01, 0x40, 0x02, 0x21, 0x40,
+    0x01, 0x22, 0x80, 0x01, 0x24, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F60D
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x6C, 0x80, 0x01, 0x3A, 0x80,
+    0x02, 0x69, 0x40, 0x02, 0x09, 0x40, 0x02, 0x09, 0x40, 0x02, 0x69, 0x40,
+    0x01, 0x3A, 0x80, 0x01, 0x6C, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F60E
+    0x00, 0x7E, 0x00, 0x00, 0xC1, 0x00, 0x01, 0x64, 0x80, 0x01, 0x72, 0x80,
+    0x02, 0x61, 0x40, 0x02, 0x41, 0x40, 0x02, 0x41, 0x40, 0x02, 0x61, 0x40,
+    0x01, 0x72, 0x80, 0x01, 0x64, 0x80, 0x00, 0xC1, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F610
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x00, 0x80, 0x01, 0x64, 0x80,
+    0x02, 0x64, 0x40, 0x02, 0x04, 0x40, 0x02, 0x04, 0x40, 0x02, 0x64, 0x40,
+    0x01, 0x64, 0x80, 0x01, 0x00, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F622
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x18, 0x80, 0x01, 0x61, 0x80,
+    0x02, 0x62, 0x40, 0x02, 0x02, 0x40, 0x02, 0x02, 0x40, 0x02, 0x62, 0x40,
+    0x01, 0x61, 0x80, 0x01, 0x00, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F61E
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x20, 0x80, 0x01, 0x22, 0x80,
+    0x02, 0x04, 0x40, 0x02, 0x04, 0x40, 0x02, 0x04, 0x40, 0x02, 0x04, 0x40,
+    0x01, 0x22, 0x80, 0x01, 0x20, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+1F62E
+    0x00, 0x7E, 0x00, 0x00, 0x81, 0x00, 0x01, 0x00, 0x80, 0x01, 0x60, 0x80,
+    0x02, 0x66, 0x40, 0x02, 0x09, 0x40, 0x02, 0x09, 0x40, 0x02, 0x66, 0x40,
+    0x01, 0x60, 0x80, 0x01, 0x00, 0x80, 0x00, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    // U+2764
+    0x00, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFE, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00,
+    0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x00,
+    // U+1F44D
+    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x70, 0x40,
+    0x01, 0xD5, 0x40, 0x03, 0x95, 0x40, 0x00, 0x15, 0x40, 0x00, 0x15, 0x40,
+    0x00, 0x1D, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+1F44E
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x02, 0x0E, 0x00,
+    0x02, 0xAB, 0x80, 0x02, 0xA9, 0xC0, 0x02, 0xA8, 0x00, 0x02, 0xA8, 0x00,
+    0x01, 0xB8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+2B50
+    0x00, 0x20, 0x00, 0x00, 0x30, 0x40, 0x00, 0x39, 0x80, 0x00, 0x3F, 0x80,
+    0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x3F, 0x80, 0x00, 0x39, 0x80, 0x00, 0x30, 0x40, 0x00, 0x20, 0x00,
+    // U+2705
+    0x00, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x80, 0x00,
+    // U+274C
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0xC6, 0x00,
+    0x00, 0x6C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x6C, 0x00,
+    0x00, 0xC6, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    // U+2600
+    0x00, 0x18, 0x00, 0x01, 0x18, 0x80, 0x00, 0x81, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0x7E, 0x00, 0x03, 0x7E, 0xC0, 0x03, 0x7E, 0xC0, 0x00, 0x7E, 0x00,
+    0x00, 0x3C, 0x00, 0x00, 0x81, 0x00, 0x01, 0x18, 0x80, 0x00, 0x18, 0x00,
+    // U+26A1
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x66, 0x00, 0x00, 0xEC, 0x00, 0x01, 0xB8, 0x00, 0x03, 0x30, 0x00,
+    0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+1F50B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x1F, 0x80,
+    0x03, 0x1F, 0x80, 0x03, 0x1F, 0x80, 0x03, 0x1F, 0x80, 0x03, 0x1F, 0x80,
+    0x01, 0x1F, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // U+1F4CD
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00,
+    0x03, 0x1C, 0x00, 0x03, 0x1F, 0x80, 0x03, 0x1F, 0x80, 0x03, 0x1C, 0x00,
+    0x03, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    // U+1F525
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80,
+    0x00, 0xF8, 0xC0, 0x03, 0xF1, 0xC0, 0x01, 0xE3, 0xC0, 0x00, 0x31, 0xC0,
+    0x00, 0x78, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
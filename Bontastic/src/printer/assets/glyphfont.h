@@ -0,0 +1,1442 @@
+#ifndef _glyphfont_h_
+#define _glyphfont_h_
+
+// Generated by tools/gen_glyph_font.py from DejaVuSansMono.ttf - do not edit.
+
+#define glyphfont_count 1720
+#define glyphfont_height 16
+
+typedef uint16_t glyphfont_offset_t;
+
+static const uint16_t PROGMEM glyphfont_codepoints[] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+    0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B,
+    0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC,
+    0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8,
+    0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4,
+    0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0,
+    0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC,
+    0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8,
+    0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4,
+    0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100,
+    0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C,
+    0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118,
+    0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124,
+    0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130,
+    0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C,
+    0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148,
+    0x0149, 0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154,
+    0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160,
+    0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x016B, 0x016C,
+    0x016D, 0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178,
+    0x0179, 0x017A, 0x017B, 0x017C, 0x017D, 0x017E, 0x017F, 0x0180, 0x0181, 0x0182, 0x0183, 0x0184,
+    0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018A, 0x018B, 0x018C, 0x018D, 0x018E, 0x018F, 0x0190,
+    0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0199, 0x019A, 0x019B, 0x019C,
+    0x019D, 0x019E, 0x019F, 0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A8,
+    0x01A9, 0x01AA, 0x01AB, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0, 0x01B1, 0x01B2, 0x01B3, 0x01B4,
+    0x01B5, 0x01B6, 0x01B7, 0x01B8, 0x01B9, 0x01BA, 0x01BB, 0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x01C0,
+    0x01C1, 0x01C2, 0x01C3, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 0x01D5,
+    0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DD, 0x01DE, 0x01DF, 0x01E0, 0x01E1,
+    0x01E2, 0x01E3, 0x01E6, 0x01E7, 0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EE, 0x01EF,
+    0x01F0, 0x01F4, 0x01F5, 0x01F6, 0x01F8, 0x01F9, 0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200, 0x0201,
+    0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B, 0x020C, 0x020D,
+    0x020E, 0x020F, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218, 0x0219,
+    0x021A, 0x021B, 0x021C, 0x021D, 0x021E, 0x021F, 0x0220, 0x0221, 0x0224, 0x0225, 0x0226, 0x0227,
+    0x0228, 0x0229, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233,
+    0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D, 0x023E, 0x023F,
+    0x0240, 0x0241, 0x0243, 0x0244, 0x0245, 0x024C, 0x024D, 0x0374, 0x0375, 0x0376, 0x0377, 0x037A,
+    0x037B, 0x037C, 0x037D, 0x037E, 0x037F, 0x0384, 0x0385, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A,
+    0x038C, 0x038E, 0x038F, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398,
+    0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5,
+    0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03B0, 0x03B1,
+    0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD,
+    0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9,
+    0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03D0, 0x03D1, 0x03D2, 0x03D3, 0x03D4, 0x03D5, 0x03D6,
+    0x03D7, 0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x03F0,
+    0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5, 0x03F6, 0x03F7, 0x03F8, 0x03F9, 0x03FA, 0x03FB, 0x03FC,
+    0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408,
+    0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414,
+    0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x0420,
+    0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C,
+    0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438,
+    0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444,
+    0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0450,
+    0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C,
+    0x045D, 0x045E, 0x045F, 0x0462, 0x0463, 0x0472, 0x0473, 0x0490, 0x0491, 0x0492, 0x0493, 0x0494,
+    0x0495, 0x0496, 0x0497, 0x0498, 0x0499, 0x049A, 0x049B, 0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04AA,
+    0x04AB, 0x04AC, 0x04AD, 0x04AE, 0x04AF, 0x04B0, 0x04B1, 0x04B2, 0x04B3, 0x04BA, 0x04BB, 0x04C0,
+    0x04C1, 0x04C2, 0x04C3, 0x04C4, 0x04C7, 0x04C8, 0x04CB, 0x04CC, 0x04CF, 0x04D0, 0x04D1, 0x04D2,
+    0x04D3, 0x04D4, 0x04D5, 0x04D6, 0x04D7, 0x04D8, 0x04D9, 0x04DA, 0x04DB, 0x04DC, 0x04DD, 0x04DE,
+    0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x04E3, 0x04E4, 0x04E5, 0x04E6, 0x04E7, 0x04E8, 0x04E9, 0x04EA,
+    0x04EB, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1, 0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6,
+    0x04F7, 0x04F8, 0x04F9, 0x2010, 0x2011, 0x2012, 0x2013, 0x2014, 0x2015, 0x2016, 0x2017, 0x2018,
+    0x2019, 0x201A, 0x201B, 0x201C, 0x201D, 0x201E, 0x201F, 0x2020, 0x2021, 0x2022, 0x2023, 0x2026,
+    0x202F, 0x2030, 0x2031, 0x2032, 0x2033, 0x2034, 0x2035, 0x2036, 0x2037, 0x2039, 0x203A, 0x203C,
+    0x203D, 0x203E, 0x203F, 0x2045, 0x2046, 0x2047, 0x2048, 0x2049, 0x204B, 0x20A0, 0x20A1, 0x20A2,
+    0x20A3, 0x20A4, 0x20A5, 0x20A6, 0x20A7, 0x20A8, 0x20A9, 0x20AA, 0x20AB, 0x20AC, 0x20AD, 0x20AE,
+    0x20AF, 0x20B0, 0x20B1, 0x20B2, 0x20B3, 0x20B4, 0x20B5, 0x20B8, 0x20B9, 0x20BA, 0x20BD, 0x2102,
+    0x2105, 0x210D, 0x210E, 0x210F, 0x2115, 0x2116, 0x2117, 0x2119, 0x211A, 0x211D, 0x2122, 0x2124,
+    0x2126, 0x212A, 0x212B, 0x212E, 0x2148, 0x2190, 0x2191, 0x2192, 0x2193, 0x2194, 0x2195, 0x2196,
+    0x2197, 0x2198, 0x2199, 0x219A, 0x219B, 0x219C, 0x219D, 0x219E, 0x219F, 0x21A0, 0x21A1, 0x21A2,
+    0x21A3, 0x21A4, 0x21A5, 0x21A6, 0x21A7, 0x21A8, 0x21A9, 0x21AA, 0x21AB, 0x21AC, 0x21AD, 0x21AE,
+    0x21AF, 0x21B0, 0x21B1, 0x21B2, 0x21B3, 0x21B4, 0x21B5, 0x21B6, 0x21B7, 0x21B8, 0x21B9, 0x21BA,
+    0x21BB, 0x21BC, 0x21BD, 0x21BE, 0x21BF, 0x21C0, 0x21C1, 0x21C2, 0x21C3, 0x21C4, 0x21C5, 0x21C6,
+    0x21C7, 0x21C8, 0x21C9, 0x21CA, 0x21CB, 0x21CC, 0x21CD, 0x21CE, 0x21CF, 0x21D0, 0x21D1, 0x21D2,
+    0x21D3, 0x21D4, 0x21D5, 0x21D6, 0x21D7, 0x21D8, 0x21D9, 0x21DA, 0x21DB, 0x21DC, 0x21DD, 0x21DE,
+    0x21DF, 0x21E0, 0x21E1, 0x21E2, 0x21E3, 0x21E4, 0x21E5, 0x21E6, 0x21E7, 0x21E8, 0x21E9, 0x21EA,
+    0x21EB, 0x21EC, 0x21ED, 0x21EE, 0x21EF, 0x21F0, 0x21F1, 0x21F2, 0x21F3, 0x21F4, 0x21F5, 0x21F6,
+    0x21F7, 0x21F8, 0x21F9, 0x21FA, 0x21FB, 0x21FC, 0x21FD, 0x21FE, 0x21FF, 0x2200, 0x2201, 0x2202,
+    0x2203, 0x2204, 0x2205, 0x2206, 0x2207, 0x2208, 0x2209, 0x220A, 0x220B, 0x220C, 0x220D, 0x220E,
+    0x220F, 0x2210, 0x2211, 0x2212, 0x2213, 0x2215, 0x2217, 0x2218, 0x2219, 0x221A, 0x221B, 0x221C,
+    0x221D, 0x221E, 0x221F, 0x2220, 0x2223, 0x2227, 0x2228, 0x2229, 0x222A, 0x222B, 0x222C, 0x222D,
+    0x2234, 0x2235, 0x2236, 0x2237, 0x2238, 0x2239, 0x223A, 0x223B, 0x223C, 0x223D, 0x2241, 0x2242,
+    0x2243, 0x2244, 0x2245, 0x2246, 0x2247, 0x2248, 0x2249, 0x224A, 0x224B, 0x224C, 0x224D, 0x224E,
+    0x224F, 0x2250, 0x2251, 0x2252, 0x2253, 0x2254, 0x2255, 0x2256, 0x2257, 0x2258, 0x2259, 0x225A,
+    0x225B, 0x225C, 0x225D, 0x225E, 0x225F, 0x2260, 0x2261, 0x2262, 0x2263, 0x2264, 0x2265, 0x2266,
+    0x2267, 0x2268, 0x2269, 0x226D, 0x226E, 0x226F, 0x2270, 0x2271, 0x2272, 0x2273, 0x2274, 0x2275,
+    0x2276, 0x2277, 0x2278, 0x2279, 0x227A, 0x227B, 0x227C, 0x227D, 0x227E, 0x227F, 0x2280, 0x2281,
+    0x2282, 0x2283, 0x2284, 0x2285, 0x2286, 0x2287, 0x2288, 0x2289, 0x228A, 0x228B, 0x228D, 0x228E,
+    0x228F, 0x2290, 0x2291, 0x2292, 0x2293, 0x2294, 0x2295, 0x2296, 0x2297, 0x2298, 0x2299, 0x229A,
+    0x229B, 0x229C, 0x229D, 0x229E, 0x229F, 0x22A0, 0x22A1, 0x22A2, 0x22A3, 0x22A4, 0x22A5, 0x22B2,
+    0x22B3, 0x22B4, 0x22B5, 0x22B8, 0x22C2, 0x22C3, 0x22C4, 0x22C5, 0x22C6, 0x22CD, 0x22CE, 0x22CF,
+    0x22D0, 0x22D1, 0x22DA, 0x22DB, 0x22DC, 0x22DD, 0x22DE, 0x22DF, 0x22E0, 0x22E1, 0x22E2, 0x22E3,
+    0x22E4, 0x22E5, 0x22E6, 0x22E7, 0x22E8, 0x22E9, 0x22EF, 0x2500, 0x2501, 0x2502, 0x2503, 0x2504,
+    0x2505, 0x2506, 0x2507, 0x2508, 0x2509, 0x250A, 0x250B, 0x250C, 0x250D, 0x250E, 0x250F, 0x2510,
+    0x2511, 0x2512, 0x2513, 0x2514, 0x2515, 0x2516, 0x2517, 0x2518, 0x2519, 0x251A, 0x251B, 0x251C,
+    0x251D, 0x251E, 0x251F, 0x2520, 0x2521, 0x2522, 0x2523, 0x2524, 0x2525, 0x2526, 0x2527, 0x2528,
+    0x2529, 0x252A, 0x252B, 0x252C, 0x252D, 0x252E, 0x252F, 0x2530, 0x2531, 0x2532, 0x2533, 0x2534,
+    0x2535, 0x2536, 0x2537, 0x2538, 0x2539, 0x253A, 0x253B, 0x253C, 0x253D, 0x253E, 0x253F, 0x2540,
+    0x2541, 0x2542, 0x2543, 0x2544, 0x2545, 0x2546, 0x2547, 0x2548, 0x2549, 0x254A, 0x254B, 0x254C,
+    0x254D, 0x254E, 0x254F, 0x2550, 0x2551, 0x2552, 0x2553, 0x2554, 0x2555, 0x2556, 0x2557, 0x2558,
+    0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E, 0x255F, 0x2560, 0x2561, 0x2562, 0x2563, 0x2564,
+    0x2565, 0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x256D, 0x256E, 0x256F, 0x2570,
+    0x2571, 0x2572, 0x2573, 0x2574, 0x2575, 0x2576, 0x2577, 0x2578, 0x2579, 0x257A, 0x257B, 0x257C,
+    0x257D, 0x257E, 0x257F, 0x2580, 0x2581, 0x2582, 0x2583, 0x2584, 0x2585, 0x2586, 0x2587, 0x2588,
+    0x2589, 0x258A, 0x258B, 0x258C, 0x258D, 0x258E, 0x258F, 0x2590, 0x2591, 0x2592, 0x2593, 0x2594,
+    0x2595, 0x2596, 0x2597, 0x2598, 0x2599, 0x259A, 0x259B, 0x259C, 0x259D, 0x259E, 0x259F, 0x25A0,
+    0x25A1, 0x25A2, 0x25A3, 0x25A4, 0x25A5, 0x25A6, 0x25A7, 0x25A8, 0x25A9, 0x25AA, 0x25AB, 0x25AC,
+    0x25AD, 0x25AE, 0x25AF, 0x25B0, 0x25B1, 0x25B2, 0x25B3, 0x25B4, 0x25B5, 0x25B6, 0x25B7, 0x25B8,
+    0x25B9, 0x25BA, 0x25BB, 0x25BC, 0x25BD, 0x25BE, 0x25BF, 0x25C0, 0x25C1, 0x25C2, 0x25C3, 0x25C4,
+    0x25C5, 0x25C6, 0x25C7, 0x25C8, 0x25C9, 0x25CA, 0x25CB, 0x25CC, 0x25CD, 0x25CE, 0x25CF, 0x25D0,
+    0x25D1, 0x25D2, 0x25D3, 0x25D4, 0x25D5, 0x25D6, 0x25D7, 0x25D8, 0x25D9, 0x25DA, 0x25DB, 0x25DC,
+    0x25DD, 0x25DE, 0x25DF, 0x25E0, 0x25E1, 0x25E2, 0x25E3, 0x25E4, 0x25E5, 0x25E6, 0x25E7, 0x25E8,
+    0x25E9, 0x25EA, 0x25EB, 0x25EC, 0x25ED, 0x25EE, 0x25EF, 0x25F0, 0x25F1, 0x25F2, 0x25F3, 0x25F4,
+    0x25F5, 0x25F6, 0x25F7, 0x25F8, 0x25F9, 0x25FA, 0x25FB, 0x25FC, 0x25FD, 0x25FE, 0x25FF, 0x2600,
+    0x2601, 0x2602, 0x2603, 0x2604, 0x2605, 0x2606, 0x2607, 0x2608, 0x2609, 0x260A, 0x260B, 0x260C,
+    0x260D, 0x260E, 0x260F, 0x2610, 0x2611, 0x2612, 0x2613, 0x2614, 0x2615, 0x2616, 0x2617, 0x2618,
+    0x2619, 0x261A, 0x261B, 0x261C, 0x261D, 0x261E, 0x261F, 0x2620, 0x2621, 0x2622, 0x2623, 0x2624,
+    0x2625, 0x2626, 0x2627, 0x2628, 0x2629, 0x262A, 0x262B, 0x262C, 0x262D, 0x262E, 0x262F, 0x2638,
+    0x2639, 0x263A, 0x263B, 0x263C, 0x263D, 0x263E, 0x263F, 0x2640, 0x2641, 0x2642, 0x2643, 0x2644,
+    0x2645, 0x2646, 0x2647, 0x2648, 0x2649, 0x264A, 0x264B, 0x264C, 0x264D, 0x264E, 0x264F, 0x2650,
+    0x2651, 0x2652, 0x2653, 0x2654, 0x2655, 0x2656, 0x2657, 0x2658, 0x2659, 0x265A, 0x265B, 0x265C,
+    0x265D, 0x265E, 0x265F, 0x2660, 0x2661, 0x2662, 0x2663, 0x2664, 0x2665, 0x2666, 0x2667, 0x2668,
+    0x2669, 0x266A, 0x266B, 0x266C, 0x266D, 0x266E, 0x266F, 0x2670, 0x2671, 0x2672, 0x2673, 0x2674,
+    0x2675, 0x2676, 0x2677, 0x2678, 0x2679, 0x267A, 0x267B, 0x267C, 0x267D, 0x267E, 0x267F, 0x2680,
+    0x2681, 0x2682, 0x2683, 0x2684, 0x2685, 0x2686, 0x2687, 0x2688, 0x2689, 0x268A, 0x268B, 0x2690,
+    0x2691, 0x2692, 0x2693, 0x2694, 0x2695, 0x2696, 0x2697, 0x2698, 0x2699, 0x269A, 0x269B, 0x269C,
+    0x26A0, 0x26A1, 0x26B0, 0x26B1, 0x2701, 0x2702, 0x2703, 0x2704, 0x2706, 0x2707, 0x2708, 0x2709,
+    0x270C, 0x270D, 0x270E, 0x270F, 0x2710, 0x2711, 0x2712, 0x2713, 0x2714, 0x2715, 0x2716, 0x2717,
+    0x2718, 0x2719, 0x271A, 0x271B, 0x271C, 0x271D, 0x271E, 0x271F, 0x2720, 0x2721, 0x2722, 0x2723,
+    0x2724, 0x2725, 0x2726, 0x2727, 0x2729, 0x272A, 0x272B, 0x272C, 0x272D, 0x272E, 0x272F, 0x2730,
+    0x2731, 0x2732, 0x2733, 0x2734, 0x2735, 0x2736, 0x2737, 0x2738, 0x2739, 0x273A, 0x273B, 0x273C,
+    0x273D, 0x273E, 0x273F, 0x2740, 0x2741, 0x2742, 0x2743, 0x2744, 0x2745, 0x2746, 0x2747, 0x2748,
+    0x2749, 0x274A, 0x274B, 0x274D, 0x274F, 0x2750, 0x2751, 0x2752, 0x2756, 0x2758, 0x2759, 0x275A,
+    0x275B, 0x275C, 0x275D, 0x275E, 0x2761, 0x2762, 0x2763, 0x2764, 0x2765, 0x2766, 0x2767, 0x2768,
+    0x2769, 0x276A, 0x276B, 0x276C, 0x276D, 0x276E, 0x276F, 0x2770, 0x2771, 0x2772, 0x2773, 0x2774,
+    0x2775, 0x2794, 0x2798, 0x2799, 0x279A, 0x279B, 0x279C, 0x279D, 0x279E, 0x279F, 0x27A0, 0x27A1,
+    0x27A2, 0x27A3, 0x27A4, 0x27A5, 0x27A6, 0x27A7, 0x27A8, 0x27A9, 0x27AA, 0x27AB, 0x27AC, 0x27AD,
+    0x27AE, 0x27AF, 0x27B1, 0x27B2, 0x27B3, 0x27B4, 0x27B5, 0x27B6, 0x27B7, 0x27B8, 0x27B9, 0x27BA,
+    0x27BB, 0x27BC, 0x27BD, 0x27BE,
+};
+
+static const glyphfont_offset_t PROGMEM glyphfont_offsets[] = {
+    0, 2, 13, 19, 31, 41, 52, 63, 69, 83, 97, 105,
+    114, 120, 123, 127, 140, 151, 162, 173, 184, 195, 206, 217,
+    228, 239, 250, 259, 270, 278, 284, 292, 303, 316, 327, 338,
+    349, 360, 371, 382, 393, 404, 415, 426, 437, 448, 459, 470,
+    481, 492, 505, 516, 527, 538, 549, 560, 571, 582, 593, 604,
+    618, 631, 645, 651, 654, 658, 667, 680, 689, 702, 711, 724,
+    736, 749, 762, 778, 791, 804, 813, 822, 831, 843, 855, 864,
+    873, 884, 893, 902, 911, 920, 932, 941, 955, 970, 984, 988,
+    990, 1001, 1014, 1025, 1033, 1044, 1058, 1070, 1073, 1083, 1092, 1100,
+    1105, 1108, 1118, 1121, 1127, 1136, 1143, 1150, 1154, 1166, 1178, 1182,
+    1187, 1194, 1203, 1211, 1225, 1239, 1253, 1265, 1279, 1293, 1307, 1321,
+    1334, 1348, 1359, 1373, 1387, 1401, 1415, 1428, 1442, 1456, 1470, 1483,
+    1494, 1508, 1522, 1536, 1550, 1564, 1577, 1585, 1596, 1610, 1624, 1638,
+    1651, 1665, 1676, 1689, 1701, 1713, 1725, 1737, 1749, 1763, 1772, 1784,
+    1796, 1808, 1820, 1832, 1844, 1856, 1868, 1880, 1893, 1905, 1917, 1929,
+    1941, 1953, 1965, 1974, 1983, 1995, 2007, 2019, 2031, 2046, 2062, 2077,
+    2091, 2103, 2118, 2130, 2144, 2156, 2170, 2182, 2196, 2208, 2222, 2234,
+    2248, 2260, 2274, 2287, 2298, 2311, 2325, 2337, 2352, 2364, 2378, 2390,
+    2404, 2416, 2430, 2442, 2456, 2471, 2486, 2501, 2515, 2530, 2544, 2559,
+    2573, 2588, 2599, 2612, 2626, 2638, 2652, 2664, 2679, 2691, 2705, 2721,
+    2735, 2744, 2755, 2771, 2785, 2800, 2814, 2830, 2839, 2853, 2868, 2882,
+    2898, 2909, 2922, 2933, 2946, 2957, 2970, 2984, 2996, 3010, 3022, 3036,
+    3048, 3061, 3075, 3087, 3101, 3113, 3128, 3140, 3154, 3166, 3177, 3186,
+    3200, 3212, 3226, 3238, 3252, 3264, 3278, 3290, 3304, 3316, 3330, 3342,
+    3356, 3368, 3382, 3396, 3410, 3422, 3433, 3444, 3458, 3470, 3484, 3496,
+    3511, 3523, 3538, 3552, 3566, 3578, 3592, 3604, 3618, 3630, 3644, 3659,
+    3672, 3686, 3698, 3712, 3724, 3738, 3750, 3763, 3775, 3786, 3797, 3809,
+    3820, 3831, 3842, 3854, 3865, 3876, 3888, 3900, 3912, 3924, 3935, 3946,
+    3957, 3972, 3987, 3999, 4013, 4025, 4037, 4049, 4061, 4073, 4085, 4097,
+    4108, 4122, 4134, 4146, 4158, 4167, 4179, 4190, 4202, 4216, 4230, 4242,
+    4251, 4262, 4277, 4291, 4303, 4315, 4330, 4342, 4351, 4362, 4374, 4386,
+    4398, 4410, 4419, 4431, 4443, 4455, 4467, 4479, 4491, 4503, 4514, 4526,
+    4537, 4549, 4560, 4571, 4585, 4597, 4611, 4623, 4637, 4649, 4663, 4675,
+    4690, 4704, 4719, 4733, 4748, 4762, 4777, 4791, 4800, 4815, 4829, 4844,
+    4858, 4872, 4884, 4898, 4913, 4927, 4941, 4955, 4967, 4984, 4999, 5013,
+    5028, 5043, 5057, 5072, 5083, 5097, 5109, 5123, 5135, 5149, 5161, 5175,
+    5187, 5201, 5213, 5227, 5239, 5253, 5265, 5279, 5291, 5305, 5317, 5331,
+    5343, 5357, 5369, 5383, 5395, 5409, 5421, 5435, 5447, 5461, 5473, 5487,
+    5499, 5513, 5527, 5542, 5554, 5568, 5582, 5597, 5610, 5625, 5637, 5651,
+    5663, 5677, 5689, 5704, 5718, 5733, 5747, 5761, 5773, 5788, 5802, 5816,
+    5831, 5844, 5854, 5866, 5878, 5889, 5900, 5912, 5924, 5933, 5945, 5957,
+    5969, 5981, 5993, 6005, 6017, 6029, 6041, 6050, 6055, 6060, 6071, 6080,
+    6084, 6093, 6102, 6111, 6122, 6133, 6137, 6142, 6154, 6158, 6170, 6182,
+    6194, 6206, 6217, 6229, 6243, 6254, 6265, 6276, 6287, 6298, 6309, 6320,
+    6331, 6342, 6353, 6364, 6375, 6386, 6397, 6408, 6419, 6430, 6441, 6452,
+    6463, 6474, 6485, 6496, 6507, 6520, 6533, 6545, 6557, 6572, 6584, 6598,
+    6607, 6622, 6634, 6646, 6655, 6670, 6682, 6695, 6704, 6713, 6725, 6737,
+    6746, 6761, 6770, 6779, 6791, 6803, 6812, 6821, 6830, 6842, 6854, 6866,
+    6875, 6887, 6899, 6911, 6923, 6935, 6947, 6959, 6971, 6983, 6996, 7010,
+    7019, 7031, 7046, 7058, 7073, 7085, 7096, 7111, 7122, 7134, 7149, 7160,
+    7169, 7181, 7190, 7206, 7218, 7227, 7236, 7247, 7263, 7274, 7286, 7298,
+    7310, 7322, 7333, 7345, 7359, 7372, 7387, 7401, 7412, 7423, 7434, 7447,
+    7458, 7470, 7482, 7494, 7508, 7522, 7537, 7551, 7562, 7573, 7584, 7595,
+    7608, 7619, 7630, 7641, 7652, 7667, 7678, 7689, 7700, 7711, 7722, 7733,
+    7744, 7755, 7766, 7777, 7788, 7799, 7812, 7823, 7834, 7847, 7858, 7869,
+    7880, 7891, 7902, 7913, 7922, 7934, 7943, 7952, 7963, 7972, 7981, 7990,
+    7999, 8011, 8020, 8029, 8038, 8047, 8056, 8065, 8077, 8086, 8095, 8107,
+    8123, 8132, 8143, 8152, 8161, 8172, 8181, 8190, 8199, 8208, 8217, 8226,
+    8238, 8249, 8264, 8276, 8285, 8294, 8307, 8319, 8335, 8344, 8353, 8365,
+    8377, 8389, 8404, 8414, 8426, 8438, 8450, 8459, 8472, 8483, 8495, 8504,
+    8519, 8531, 8544, 8555, 8569, 8581, 8595, 8606, 8620, 8631, 8643, 8652,
+    8666, 8678, 8692, 8703, 8714, 8726, 8738, 8750, 8764, 8775, 8787, 8800,
+    8811, 8826, 8838, 8853, 8865, 8880, 8892, 8906, 8917, 8929, 8944, 8956,
+    8969, 8981, 8992, 9001, 9016, 9028, 9039, 9048, 9061, 9073, 9086, 9098,
+    9111, 9123, 9135, 9147, 9161, 9173, 9186, 9198, 9211, 9223, 9235, 9244,
+    9257, 9269, 9282, 9294, 9308, 9323, 9336, 9351, 9365, 9380, 9393, 9405,
+    9419, 9430, 9443, 9455, 9458, 9461, 9464, 9467, 9470, 9473, 9488, 9493,
+    9499, 9505, 9511, 9517, 9523, 9529, 9535, 9541, 9553, 9565, 9571, 9577,
+    9581, 9583, 9594, 9605, 9610, 9615, 9620, 9625, 9630, 9635, 9641, 9647,
+    9658, 9670, 9673, 9677, 9691, 9705, 9717, 9729, 9741, 9754, 9766, 9778,
+    9790, 9802, 9814, 9825, 9837, 9849, 9861, 9873, 9885, 9900, 9911, 9923,
+    9935, 9950, 9962, 9974, 9987, 9998, 10010, 10024, 10036, 10048, 10060, 10072,
+    10084, 10096, 10108, 10120, 10132, 10144, 10156, 10166, 10178, 10192, 10204, 10210,
+    10222, 10233, 10244, 10258, 10266, 10278, 10283, 10292, 10297, 10306, 10311, 10320,
+    10328, 10336, 10343, 10350, 10355, 10361, 10366, 10371, 10376, 10385, 10390, 10399,
+    10404, 10409, 10414, 10423, 10428, 10437, 10446, 10452, 10459, 10466, 10473, 10478,
+    10485, 10496, 10506, 10516, 10527, 10538, 10547, 10554, 10560, 10566, 10575, 10585,
+    10594, 10603, 10607, 10611, 10620, 10629, 10633, 10637, 10646, 10655, 10664, 10673,
+    10682, 10691, 10700, 10709, 10718, 10725, 10733, 10738, 10744, 10749, 10754, 10763,
+    10768, 10777, 10782, 10791, 10799, 10806, 10814, 10821, 10826, 10831, 10836, 10841,
+    10850, 10859, 10864, 10873, 10878, 10887, 10892, 10897, 10902, 10911, 10916, 10925,
+    10934, 10943, 10952, 10961, 10970, 10979, 10986, 10995, 11004, 11013, 11018, 11027,
+    11039, 11046, 11053, 11058, 11065, 11071, 11078, 11083, 11088, 11093, 11104, 11116,
+    11127, 11139, 11151, 11159, 11170, 11181, 11192, 11205, 11212, 11223, 11236, 11244,
+    11254, 11269, 11284, 11299, 11302, 11312, 11325, 11333, 11339, 11345, 11358, 11371,
+    11384, 11390, 11397, 11405, 11413, 11428, 11438, 11448, 11458, 11468, 11483, 11498,
+    11513, 11522, 11531, 11540, 11549, 11554, 11562, 11571, 11580, 11584, 11588, 11596,
+    11602, 11608, 11617, 11625, 11634, 11644, 11650, 11658, 11666, 11674, 11682, 11688,
+    11698, 11706, 11714, 11725, 11736, 11747, 11753, 11759, 11765, 11775, 11784, 11794,
+    11804, 11814, 11825, 11834, 11844, 11855, 11865, 11873, 11883, 11893, 11902, 11911,
+    11921, 11931, 11942, 11953, 11963, 11973, 11983, 11994, 12005, 12014, 12023, 12034,
+    12045, 12056, 12067, 12080, 12093, 12103, 12112, 12124, 12136, 12148, 12160, 12172,
+    12184, 12192, 12200, 12210, 12220, 12230, 12240, 12252, 12264, 12275, 12286, 12296,
+    12306, 12314, 12322, 12332, 12342, 12352, 12362, 12370, 12378, 12386, 12394, 12402,
+    12410, 12418, 12426, 12434, 12443, 12452, 12461, 12470, 12480, 12490, 12500, 12510,
+    12518, 12526, 12535, 12544, 12550, 12565, 12580, 12588, 12592, 12597, 12603, 12613,
+    12623, 12633, 12643, 12658, 12673, 12682, 12691, 12703, 12714, 12728, 12742, 12754,
+    12766, 12777, 12788, 12799, 12810, 12824, 12838, 12842, 12845, 12850, 12867, 12884,
+    12887, 12892, 12907, 12924, 12927, 12931, 12946, 12963, 12973, 12984, 12994, 13005,
+    13015, 13026, 13036, 13047, 13057, 13068, 13078, 13089, 13099, 13110, 13120, 13131,
+    13148, 13165, 13182, 13199, 13216, 13233, 13250, 13267, 13284, 13301, 13318, 13335,
+    13352, 13369, 13386, 13403, 13413, 13424, 13435, 13446, 13456, 13467, 13478, 13489,
+    13499, 13510, 13521, 13532, 13542, 13553, 13564, 13575, 13592, 13609, 13626, 13643,
+    13660, 13677, 13694, 13711, 13728, 13745, 13762, 13779, 13796, 13813, 13830, 13847,
+    13850, 13855, 13870, 13885, 13890, 13907, 13918, 13928, 13939, 13950, 13960, 13971,
+    13982, 13992, 14003, 14014, 14024, 14035, 14052, 14069, 14086, 14103, 14120, 14137,
+    14148, 14158, 14169, 14180, 14190, 14201, 14218, 14235, 14252, 14262, 14272, 14282,
+    14292, 14309, 14326, 14343, 14346, 14355, 14358, 14367, 14372, 14382, 14387, 14397,
+    14402, 14419, 14424, 14441, 14451, 14455, 14461, 14469, 14479, 14490, 14503, 14518,
+    14535, 14552, 14569, 14586, 14603, 14620, 14637, 14654, 14671, 14688, 14705, 14722,
+    14726, 14743, 14753, 14763, 14773, 14790, 14808, 14825, 14842, 14852, 14870, 14887,
+    14897, 14907, 14917, 14927, 14937, 14947, 14957, 14967, 14977, 14987, 14994, 15001,
+    15007, 15013, 15023, 15033, 15039, 15045, 15055, 15065, 15071, 15077, 15086, 15095,
+    15102, 15109, 15116, 15123, 15132, 15141, 15147, 15153, 15162, 15171, 15177, 15183,
+    15190, 15197, 15206, 15215, 15224, 15234, 15248, 15258, 15268, 15278, 15288, 15298,
+    15308, 15318, 15328, 15338, 15348, 15358, 15367, 15377, 15389, 15404, 15413, 15421,
+    15427, 15433, 15439, 15444, 15450, 15456, 15466, 15476, 15485, 15494, 15496, 15506,
+    15516, 15526, 15536, 15546, 15556, 15566, 15576, 15586, 15596, 15606, 15616, 15626,
+    15636, 15646, 15656, 15666, 15675, 15684, 15694, 15703, 15712, 15719, 15726, 15736,
+    15742, 15747, 15752, 15756, 15758, 15765, 15767, 15778, 15790, 15795, 15805, 15816,
+    15827, 15838, 15848, 15854, 15863, 15872, 15880, 15889, 15894, 15899, 15910, 15921,
+    15930, 15936, 15943, 15950, 15952, 15954, 15956, 15959, 15965, 15976, 15985, 15992,
+    16002, 16013, 16024, 16036, 16047, 16056, 16066, 16075, 16086, 16096, 16106, 16114,
+    16123, 16132, 16141, 16150, 16155, 16166, 16178, 16190, 16201, 16212, 16222, 16232,
+    16243, 16253, 16263, 16274, 16282, 16292, 16302, 16312, 16322, 16332, 16341, 16352,
+    16361, 16371, 16377, 16387, 16396, 16401, 16411, 16420, 16423, 16432, 16439, 16448,
+    16458, 16468, 16478, 16488, 16496, 16498, 16500, 16509, 16511, 16521, 16530, 16536,
+    16540, 16551, 16562, 16574, 16584, 16591, 16597, 16605, 16615, 16625, 16632, 16641,
+    16650, 16659, 16668, 16677, 16686, 16695, 16704, 16713, 16722, 16729, 16734, 16744,
+    16753, 16762, 16771, 16780, 16789, 16798, 16807, 16816, 16825, 16834, 16837, 16840,
+    16850, 16860, 16869, 16879, 16885, 16895, 16903, 16912, 16920, 16930, 16934, 16940,
+    16950, 16958, 16966, 16978, 16988, 16994, 17000, 17006, 17012, 17022, 17032, 17040,
+    17047, 17052, 17058, 17067, 17072, 17081, 17086, 17091, 17099, 17107, 17115, 17124,
+    17134, 17144, 17153, 17162, 17171, 17180, 17190, 17200, 17210, 17219, 17227, 17236,
+    17245, 17254, 17263, 17270, 17275, 17280, 17289, 17297, 17303, 17310, 17318, 17325,
+    17333, 17342, 17351, 17357, 17362, 17369, 17375, 17382, 17390, 17397, 17405, 17415,
+    17425, 17435, 17445, 17454, 17463, 17472, 17481, 17491, 17500, 17508, 17518, 17528,
+    17537, 17546, 17555, 17563, 17572, 17575, 17584, 17594, 17603, 17612, 17624, 17637,
+    17650, 17655, 17660, 17665, 17670, 17681, 17691, 17701, 17709, 17719, 17728, 17734,
+    17745, 17756, 17768, 17779, 17791, 17803, 17814, 17825, 17838, 17851, 17864, 17877,
+    17890, 17903, 17909, 17917, 17922, 17931, 17936, 17943, 17948, 17953, 17958, 17963,
+    17968, 17973, 17978, 17985, 17990, 17995, 18001, 18006, 18013, 18019, 18026, 18031,
+    18039, 18047, 18054, 18061, 18070, 18075, 18083, 18087, 18095, 18104, 18108, 18116,
+    18122, 18126, 18131, 18137, 18143,
+};
+
+static const uint8_t PROGMEM glyphfont_data[] = {
+    0x00, 0x00, 0x04, 0x09, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x04, 0x04, 0x24,
+    0x24, 0x24, 0x24, 0x03, 0x0A, 0x12, 0x12, 0x14, 0x7F, 0x24, 0x24, 0xFE, 0x68, 0x48, 0x48, 0x05,
+    0x08, 0x3C, 0x68, 0x40, 0x38, 0x1C, 0x02, 0x46, 0x3C, 0x04, 0x09, 0x70, 0x90, 0x90, 0x76, 0x18,
+    0x6E, 0x0B, 0x0B, 0x0E, 0x04, 0x09, 0x3C, 0x60, 0x20, 0x30, 0x59, 0xCB, 0xC6, 0x46, 0x3A, 0x04,
+    0x04, 0x18, 0x18, 0x18, 0x18, 0x02, 0x0C, 0x08, 0x08, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x18, 0x08, 0x08, 0x02, 0x0C, 0x30, 0x10, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x10,
+    0x30, 0x04, 0x06, 0x10, 0x52, 0x38, 0x38, 0x52, 0x10, 0x05, 0x07, 0x18, 0x18, 0x18, 0xFE, 0x18,
+    0x18, 0x18, 0x0B, 0x04, 0x18, 0x18, 0x10, 0x10, 0x09, 0x01, 0x3C, 0x0B, 0x02, 0x18, 0x18, 0x04,
+    0x0B, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x10, 0x10, 0x30, 0x20, 0x60, 0x40, 0x04, 0x09, 0x3C, 0x64,
+    0x46, 0x42, 0x5A, 0x42, 0x46, 0x64, 0x3C, 0x04, 0x09, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x3E, 0x04, 0x09, 0x3C, 0x44, 0x06, 0x04, 0x0C, 0x18, 0x30, 0x60, 0x7E, 0x04, 0x09, 0x3C,
+    0x44, 0x06, 0x04, 0x3C, 0x06, 0x06, 0x46, 0x3C, 0x04, 0x09, 0x0C, 0x1C, 0x14, 0x24, 0x64, 0x44,
+    0x7E, 0x04, 0x04, 0x04, 0x09, 0x7C, 0x60, 0x60, 0x7C, 0x04, 0x06, 0x06, 0x44, 0x38, 0x04, 0x09,
+    0x3C, 0x60, 0x40, 0x7C, 0x66, 0x42, 0x42, 0x66, 0x3C, 0x04, 0x09, 0x7E, 0x06, 0x04, 0x0C, 0x08,
+    0x18, 0x18, 0x10, 0x30, 0x04, 0x09, 0x3C, 0x66, 0x46, 0x64, 0x3C, 0x66, 0x42, 0x66, 0x3C, 0x04,
+    0x09, 0x3C, 0x64, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x04, 0x38, 0x06, 0x07, 0x18, 0x18, 0x00, 0x00,
+    0x00, 0x18, 0x18, 0x06, 0x09, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x10, 0x06, 0x06,
+    0x02, 0x1C, 0x60, 0x60, 0x1C, 0x02, 0x07, 0x04, 0xFE, 0x00, 0x00, 0xFE, 0x06, 0x06, 0x40, 0x38,
+    0x0E, 0x0E, 0x38, 0x40, 0x04, 0x09, 0x3C, 0x06, 0x06, 0x0C, 0x18, 0x10, 0x00, 0x10, 0x10, 0x04,
+    0x0B, 0x3C, 0x62, 0x42, 0xCF, 0x93, 0x93, 0x93, 0xCF, 0x40, 0x60, 0x1C, 0x04, 0x09, 0x18, 0x18,
+    0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x04, 0x09, 0x7C, 0x46, 0x46, 0x46, 0x7C, 0x46, 0x42,
+    0x46, 0x7C, 0x04, 0x09, 0x1C, 0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x04, 0x09, 0x78,
+    0x44, 0x46, 0x42, 0x42, 0x42, 0x46, 0x44, 0x78, 0x04, 0x09, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60,
+    0x60, 0x60, 0x7E, 0x04, 0x09, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x04, 0x09,
+    0x3C, 0x62, 0x40, 0x40, 0x4E, 0x42, 0x42, 0x62, 0x3C, 0x04, 0x09, 0x42, 0x42, 0x42, 0x42, 0x7E,
+    0x42, 0x42, 0x42, 0x42, 0x04, 0x09, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x04,
+    0x09, 0x3C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x4C, 0x78, 0x04, 0x09, 0x42, 0x44, 0x48, 0x70,
+    0x78, 0x48, 0x4C, 0x46, 0x42, 0x04, 0x09, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7E,
+    0x04, 0x09, 0xE6, 0xE6, 0xE6, 0xFA, 0xDA, 0xDA, 0xC2, 0xC2, 0xC2, 0x04, 0x09, 0x62, 0x62, 0x72,
+    0x52, 0x5A, 0x4A, 0x4E, 0x46, 0x46, 0x04, 0x09, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66,
+    0x3C, 0x04, 0x09, 0x7C, 0x66, 0x62, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x04, 0x0B, 0x3C, 0x66,
+    0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x0C, 0x04, 0x04, 0x09, 0x7C, 0x46, 0x46, 0x46, 0x7C,
+    0x4C, 0x46, 0x42, 0x43, 0x04, 0x09, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x04,
+    0x09, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x09, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x66, 0x3C, 0x04, 0x09, 0xC2, 0x42, 0x46, 0x64, 0x24, 0x24, 0x3C, 0x18, 0x18,
+    0x04, 0x09, 0x83, 0x83, 0xC2, 0xDA, 0x5A, 0x5A, 0x6E, 0x66, 0x66, 0x04, 0x09, 0x42, 0x66, 0x3C,
+    0x18, 0x18, 0x3C, 0x24, 0x66, 0xC2, 0x04, 0x09, 0xC2, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x04, 0x09, 0x7E, 0x06, 0x04, 0x0C, 0x18, 0x10, 0x20, 0x60, 0x7E, 0x02, 0x0C, 0x1C, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x04, 0x0B, 0x40, 0x60, 0x20, 0x30,
+    0x10, 0x10, 0x08, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x0C, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x38, 0x04, 0x04, 0x18, 0x3C, 0x64, 0x42, 0x0F, 0x01, 0xFF, 0x03, 0x02,
+    0x30, 0x10, 0x06, 0x07, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x02, 0x0B, 0x40, 0x40, 0x40,
+    0x40, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x06, 0x07, 0x1C, 0x22, 0x60, 0x60, 0x60, 0x22,
+    0x1C, 0x02, 0x0B, 0x06, 0x06, 0x06, 0x06, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x07,
+    0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x02, 0x0B, 0x0E, 0x18, 0x10, 0x10, 0x7E, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x06, 0x0A, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x04, 0x38,
+    0x02, 0x0B, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x02, 0x0B, 0x18,
+    0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x02, 0x0E, 0x08, 0x00, 0x00, 0x00,
+    0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x70, 0x02, 0x0B, 0x60, 0x60, 0x60, 0x60,
+    0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x02, 0x0B, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x0E, 0x06, 0x07, 0x7E, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x06, 0x07, 0x7C,
+    0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x06, 0x07, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x06,
+    0x0A, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x06, 0x0A, 0x3E, 0x66, 0x46,
+    0x46, 0x46, 0x66, 0x3E, 0x06, 0x06, 0x06, 0x06, 0x07, 0x3E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x06, 0x07, 0x3C, 0x64, 0x60, 0x3C, 0x04, 0x44, 0x3C, 0x04, 0x09, 0x10, 0x10, 0x7E, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x1E, 0x06, 0x07, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x06, 0x07, 0x42,
+    0x46, 0x64, 0x24, 0x2C, 0x18, 0x18, 0x06, 0x07, 0x83, 0xC3, 0x5A, 0x5A, 0x7A, 0x66, 0x64, 0x06,
+    0x07, 0x46, 0x24, 0x18, 0x18, 0x38, 0x24, 0x42, 0x06, 0x0A, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18,
+    0x18, 0x18, 0x10, 0x60, 0x06, 0x07, 0x7E, 0x04, 0x08, 0x18, 0x30, 0x20, 0x7E, 0x02, 0x0C, 0x0C,
+    0x18, 0x18, 0x18, 0x10, 0x70, 0x10, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x02, 0x0D, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x02, 0x0C, 0x70, 0x10, 0x18, 0x18,
+    0x18, 0x0C, 0x18, 0x18, 0x18, 0x10, 0x10, 0x70, 0x08, 0x02, 0x70, 0x0E, 0x00, 0x00, 0x06, 0x09,
+    0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x0B, 0x08, 0x08, 0x1C, 0x2A, 0x68,
+    0x68, 0x68, 0x3A, 0x1C, 0x08, 0x08, 0x04, 0x09, 0x1C, 0x12, 0x30, 0x30, 0x7C, 0x30, 0x30, 0x30,
+    0x7E, 0x06, 0x06, 0x02, 0x3E, 0x24, 0x24, 0x3E, 0x42, 0x04, 0x09, 0x42, 0x66, 0x24, 0x7E, 0x18,
+    0x7E, 0x18, 0x18, 0x18, 0x04, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x04, 0x0A, 0x3C, 0x20, 0x30, 0x38, 0x44, 0x66, 0x1C, 0x0C, 0x04, 0x3C, 0x03, 0x01,
+    0x2C, 0x04, 0x08, 0x3C, 0x46, 0xBD, 0xA1, 0xA1, 0xBD, 0x46, 0x3C, 0x04, 0x07, 0x38, 0x04, 0x3C,
+    0x24, 0x3C, 0x00, 0x3C, 0x06, 0x06, 0x12, 0x24, 0x48, 0x48, 0x24, 0x12, 0x08, 0x03, 0xFE, 0x02,
+    0x02, 0x09, 0x01, 0x3C, 0x04, 0x08, 0x3C, 0x46, 0xB9, 0xA5, 0xB9, 0xAD, 0x46, 0x3C, 0x03, 0x01,
+    0x3C, 0x04, 0x04, 0x18, 0x24, 0x24, 0x18, 0x06, 0x07, 0x18, 0x18, 0xFE, 0x18, 0x18, 0x00, 0xFE,
+    0x04, 0x05, 0x38, 0x0C, 0x08, 0x10, 0x3C, 0x04, 0x05, 0x38, 0x0C, 0x18, 0x04, 0x38, 0x03, 0x02,
+    0x0C, 0x18, 0x06, 0x0A, 0x46, 0x46, 0x46, 0x46, 0x46, 0x66, 0x7A, 0x40, 0x40, 0x40, 0x04, 0x0A,
+    0x3E, 0x7A, 0x7A, 0x7A, 0x3A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x08, 0x02, 0x18, 0x18, 0x0D, 0x03,
+    0x08, 0x08, 0x38, 0x04, 0x05, 0x38, 0x08, 0x08, 0x08, 0x3C, 0x04, 0x07, 0x38, 0x24, 0x24, 0x24,
+    0x38, 0x00, 0x3C, 0x06, 0x06, 0x48, 0x6C, 0x16, 0x16, 0x6C, 0x48, 0x03, 0x0C, 0xE0, 0x20, 0x20,
+    0x20, 0x7E, 0x3C, 0xC0, 0x04, 0x0C, 0x14, 0x1E, 0x04, 0x03, 0x0C, 0xE0, 0x20, 0x20, 0x20, 0x7E,
+    0x3C, 0xC0, 0x1E, 0x02, 0x04, 0x08, 0x1E, 0x03, 0x0C, 0x70, 0x10, 0x30, 0x10, 0x76, 0x3C, 0xC0,
+    0x04, 0x0C, 0x14, 0x1E, 0x04, 0x06, 0x0A, 0x18, 0x18, 0x00, 0x18, 0x18, 0x10, 0x20, 0x60, 0x64,
+    0x3C, 0x01, 0x0C, 0x10, 0x18, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x01,
+    0x0C, 0x08, 0x10, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x01, 0x0C, 0x18,
+    0x24, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x01, 0x0C, 0x34, 0x2C, 0x00,
+    0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x02, 0x0B, 0x2C, 0x00, 0x18, 0x18, 0x3C,
+    0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x01, 0x0C, 0x18, 0x24, 0x24, 0x18, 0x18, 0x3C, 0x24, 0x24,
+    0x66, 0x7E, 0x42, 0xC3, 0x04, 0x09, 0x3E, 0x28, 0x28, 0x28, 0x6E, 0x48, 0x78, 0xC8, 0x8F, 0x04,
+    0x0C, 0x1C, 0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x00, 0x04, 0x18, 0x01, 0x0C, 0x10,
+    0x08, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x01, 0x0C, 0x08, 0x18, 0x00,
+    0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x01, 0x0C, 0x18, 0x24, 0x00, 0x7E, 0x60,
+    0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x02, 0x0B, 0x24, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E,
+    0x60, 0x60, 0x60, 0x7E, 0x01, 0x0C, 0x10, 0x18, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x7E, 0x01, 0x0C, 0x08, 0x10, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E,
+    0x01, 0x0C, 0x18, 0x24, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x02, 0x0B,
+    0x2C, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x04, 0x09, 0x78, 0x44, 0x46,
+    0x42, 0xF2, 0x42, 0x46, 0x44, 0x78, 0x01, 0x0C, 0x34, 0x2C, 0x00, 0x62, 0x62, 0x72, 0x52, 0x5A,
+    0x4A, 0x4E, 0x46, 0x46, 0x01, 0x0C, 0x10, 0x18, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46,
+    0x66, 0x3C, 0x01, 0x0C, 0x08, 0x10, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C,
+    0x01, 0x0C, 0x18, 0x24, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x01, 0x0C,
+    0x34, 0x2C, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x02, 0x0B, 0x2C, 0x00,
+    0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x06, 0x06, 0x42, 0x24, 0x18, 0x18, 0x24,
+    0x42, 0x04, 0x09, 0x3E, 0x66, 0x46, 0x4E, 0x52, 0x72, 0x66, 0x66, 0xBC, 0x01, 0x0C, 0x10, 0x18,
+    0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x08, 0x10, 0x00, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x18, 0x24, 0x00, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x02, 0x0B, 0x2C, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x66, 0x3C, 0x01, 0x0C, 0x08, 0x10, 0x00, 0xC2, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x04, 0x09, 0x60, 0x7C, 0x66, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x02, 0x0B, 0x3C, 0x64,
+    0x46, 0x48, 0x58, 0x58, 0x4C, 0x46, 0x42, 0x42, 0x7C, 0x03, 0x0A, 0x30, 0x10, 0x00, 0x3C, 0x44,
+    0x06, 0x3E, 0x46, 0x46, 0x3E, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46,
+    0x3E, 0x03, 0x0A, 0x18, 0x24, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x03, 0x0A, 0x34,
+    0x2C, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x44,
+    0x06, 0x3E, 0x46, 0x46, 0x3E, 0x01, 0x0C, 0x18, 0x24, 0x24, 0x18, 0x00, 0x3C, 0x44, 0x06, 0x3E,
+    0x46, 0x46, 0x3E, 0x06, 0x07, 0x7E, 0x1B, 0x1B, 0x7F, 0xD8, 0xD8, 0x7E, 0x06, 0x0A, 0x1C, 0x22,
+    0x60, 0x60, 0x60, 0x22, 0x1C, 0x00, 0x04, 0x1C, 0x03, 0x0A, 0x30, 0x18, 0x00, 0x3C, 0x66, 0x42,
+    0x7E, 0x40, 0x62, 0x3C, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C,
+    0x03, 0x0A, 0x18, 0x24, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x03, 0x0A, 0x24, 0x00,
+    0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x03, 0x0A, 0x30, 0x10, 0x00, 0x38, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x7E, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E,
+    0x03, 0x0A, 0x18, 0x24, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x03, 0x0A, 0x34, 0x00,
+    0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x02, 0x0B, 0x30, 0x1C, 0x38, 0x0C, 0x3C, 0x66,
+    0x46, 0x42, 0x42, 0x64, 0x3C, 0x03, 0x0A, 0x34, 0x2C, 0x00, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46,
+    0x46, 0x03, 0x0A, 0x30, 0x10, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x0C,
+    0x18, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x18, 0x24, 0x00, 0x3C, 0x66,
+    0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x34, 0x2C, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66,
+    0x3C, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x05, 0x07, 0x18,
+    0x18, 0x00, 0xFE, 0x00, 0x18, 0x18, 0x06, 0x07, 0x3E, 0x66, 0x4E, 0x52, 0x72, 0x66, 0x7C, 0x03,
+    0x0A, 0x30, 0x10, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x03, 0x0A, 0x0C, 0x18, 0x00,
+    0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x03, 0x0A, 0x18, 0x24, 0x00, 0x46, 0x46, 0x46, 0x46,
+    0x66, 0x66, 0x3E, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x03,
+    0x0D, 0x0C, 0x18, 0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x02, 0x0E,
+    0x40, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x03, 0x0D,
+    0x2C, 0x00, 0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x01, 0x0C, 0x3C,
+    0x00, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x03, 0x0A, 0x3C, 0x00, 0x00,
+    0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x18, 0x18, 0x3C,
+    0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46,
+    0x46, 0x3E, 0x04, 0x0C, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x02, 0x02, 0x03,
+    0x06, 0x0A, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x04, 0x04, 0x06, 0x01, 0x0C, 0x0C, 0x08,
+    0x00, 0x1C, 0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x03, 0x0A, 0x04, 0x08, 0x00, 0x1C,
+    0x22, 0x60, 0x60, 0x60, 0x22, 0x1C, 0x01, 0x0C, 0x0C, 0x14, 0x00, 0x1C, 0x22, 0x60, 0x40, 0x40,
+    0x40, 0x60, 0x22, 0x1C, 0x03, 0x0A, 0x08, 0x14, 0x00, 0x1C, 0x22, 0x60, 0x60, 0x60, 0x22, 0x1C,
+    0x01, 0x0C, 0x08, 0x00, 0x00, 0x1C, 0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x03, 0x0A,
+    0x08, 0x00, 0x00, 0x1C, 0x22, 0x60, 0x60, 0x60, 0x22, 0x1C, 0x01, 0x0C, 0x14, 0x18, 0x00, 0x1C,
+    0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x03, 0x0A, 0x14, 0x08, 0x00, 0x1C, 0x22, 0x60,
+    0x60, 0x60, 0x22, 0x1C, 0x01, 0x0C, 0x28, 0x30, 0x00, 0x78, 0x44, 0x46, 0x42, 0x42, 0x42, 0x46,
+    0x44, 0x78, 0x02, 0x0B, 0x06, 0x06, 0x07, 0x07, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x04,
+    0x09, 0x78, 0x44, 0x46, 0x42, 0xF2, 0x42, 0x46, 0x44, 0x78, 0x02, 0x0B, 0x06, 0x06, 0x1F, 0x06,
+    0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x01, 0x0C, 0x3C, 0x00, 0x00, 0x7E, 0x60, 0x60, 0x60,
+    0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A, 0x3C, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62,
+    0x3C, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E,
+    0x03, 0x0A, 0x24, 0x18, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x01, 0x0C, 0x18, 0x00,
+    0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A, 0x18, 0x00, 0x00, 0x3C,
+    0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x04, 0x0C, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60,
+    0x7E, 0x04, 0x04, 0x06, 0x06, 0x0A, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x00, 0x08, 0x0E,
+    0x01, 0x0C, 0x34, 0x18, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A,
+    0x24, 0x18, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x01, 0x0C, 0x18, 0x24, 0x00, 0x3C,
+    0x62, 0x40, 0x40, 0x4E, 0x42, 0x42, 0x62, 0x3C, 0x03, 0x0D, 0x18, 0x24, 0x00, 0x3E, 0x66, 0x46,
+    0x46, 0x46, 0x66, 0x3E, 0x06, 0x04, 0x38, 0x00, 0x0D, 0x24, 0x1C, 0x00, 0x00, 0x3C, 0x62, 0x40,
+    0x40, 0x4E, 0x42, 0x42, 0x62, 0x3C, 0x03, 0x0D, 0x24, 0x18, 0x00, 0x3E, 0x66, 0x46, 0x46, 0x46,
+    0x66, 0x3E, 0x06, 0x04, 0x38, 0x01, 0x0C, 0x18, 0x00, 0x00, 0x3C, 0x62, 0x40, 0x40, 0x4E, 0x42,
+    0x42, 0x62, 0x3C, 0x03, 0x0D, 0x18, 0x00, 0x00, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x06,
+    0x04, 0x38, 0x04, 0x0C, 0x3C, 0x62, 0x40, 0x40, 0x4E, 0x42, 0x42, 0x62, 0x3C, 0x00, 0x08, 0x18,
+    0x03, 0x0D, 0x08, 0x18, 0x00, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x04, 0x38, 0x01,
+    0x0C, 0x18, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x00, 0x0D, 0x24,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x04, 0x09, 0x42, 0x42,
+    0xFF, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x02, 0x0B, 0x40, 0x40, 0xF8, 0x40, 0x7C, 0x66, 0x66,
+    0x46, 0x46, 0x46, 0x46, 0x01, 0x0C, 0x34, 0x2C, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x7E, 0x03, 0x0A, 0x34, 0x2C, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x01, 0x0C,
+    0x3C, 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x03, 0x0A, 0x3C, 0x00,
+    0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x7E, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x7E, 0x04, 0x0C, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x10, 0x10,
+    0x18, 0x02, 0x0E, 0x18, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x10,
+    0x1C, 0x01, 0x0C, 0x18, 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x06,
+    0x07, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x04, 0x09, 0xF7, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x49, 0xF6, 0x02, 0x0E, 0x22, 0x00, 0x00, 0x00, 0xEE, 0x22, 0x22, 0x22, 0x22, 0x22, 0xFA,
+    0x02, 0x02, 0x0E, 0x01, 0x0C, 0x18, 0x14, 0x00, 0x3C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x4C,
+    0x78, 0x03, 0x0D, 0x18, 0x24, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x70,
+    0x04, 0x0C, 0x42, 0x44, 0x48, 0x70, 0x78, 0x48, 0x4C, 0x46, 0x42, 0x00, 0x08, 0x18, 0x02, 0x0E,
+    0x60, 0x60, 0x60, 0x60, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x00, 0x08, 0x08, 0x06, 0x07,
+    0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x01, 0x0C, 0x20, 0x20, 0x00, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x7E, 0x00, 0x0D, 0x10, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x0E, 0x04, 0x0C, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7E, 0x00,
+    0x08, 0x18, 0x02, 0x0E, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0E, 0x00,
+    0x10, 0x10, 0x04, 0x09, 0x6C, 0x68, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7E, 0x02, 0x0B, 0x70,
+    0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0E, 0x04, 0x09, 0x60, 0x60, 0x60, 0x66,
+    0x66, 0x60, 0x60, 0x60, 0x7E, 0x02, 0x0B, 0x70, 0x10, 0x10, 0x10, 0x10, 0x13, 0x13, 0x10, 0x10,
+    0x10, 0x0E, 0x04, 0x09, 0x60, 0x60, 0x60, 0x78, 0x60, 0xE0, 0x60, 0x60, 0x7E, 0x02, 0x0B, 0x70,
+    0x10, 0x10, 0x14, 0x18, 0x30, 0x70, 0x10, 0x10, 0x10, 0x0E, 0x01, 0x0C, 0x08, 0x18, 0x00, 0x62,
+    0x62, 0x72, 0x52, 0x5A, 0x4A, 0x4E, 0x46, 0x46, 0x03, 0x0A, 0x0C, 0x08, 0x00, 0x7C, 0x66, 0x66,
+    0x46, 0x46, 0x46, 0x46, 0x04, 0x0C, 0x62, 0x62, 0x72, 0x52, 0x5A, 0x4A, 0x4E, 0x46, 0x46, 0x00,
+    0x18, 0x10, 0x06, 0x0A, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x00, 0x18, 0x10, 0x01, 0x0C,
+    0x34, 0x18, 0x00, 0x62, 0x62, 0x72, 0x52, 0x5A, 0x4A, 0x4E, 0x46, 0x46, 0x03, 0x0A, 0x2C, 0x18,
+    0x00, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x02, 0x0B, 0x40, 0x40, 0xC0, 0x80, 0x3E, 0x32,
+    0x22, 0x23, 0x23, 0x23, 0x23, 0x04, 0x0C, 0x5C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x02, 0x06, 0x1C, 0x06, 0x0A, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x06, 0x06, 0x1C, 0x01,
+    0x0C, 0x3C, 0x00, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x3C,
+    0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x3C,
+    0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x3C, 0x66, 0x42,
+    0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x14, 0x3C, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46,
+    0x66, 0x3C, 0x03, 0x0A, 0x14, 0x2C, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x04, 0x09,
+    0x3F, 0x68, 0x48, 0xC8, 0xCF, 0xC8, 0x48, 0x68, 0x3F, 0x06, 0x07, 0x7E, 0xDB, 0x99, 0x9F, 0x98,
+    0xD8, 0x7E, 0x01, 0x0C, 0x18, 0x10, 0x00, 0x7C, 0x46, 0x46, 0x46, 0x7C, 0x4C, 0x46, 0x42, 0x43,
+    0x03, 0x0A, 0x02, 0x04, 0x00, 0x3E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x04, 0x0C, 0x7C, 0x46,
+    0x46, 0x46, 0x7C, 0x4C, 0x46, 0x42, 0x43, 0x00, 0x08, 0x18, 0x06, 0x0A, 0x3E, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x00, 0x30, 0x20, 0x01, 0x0C, 0x28, 0x18, 0x00, 0x7C, 0x46, 0x46, 0x46, 0x7C,
+    0x4C, 0x46, 0x42, 0x43, 0x03, 0x0A, 0x14, 0x08, 0x00, 0x3E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x01, 0x0C, 0x08, 0x18, 0x00, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x03, 0x0A,
+    0x0C, 0x08, 0x00, 0x3C, 0x64, 0x60, 0x3C, 0x04, 0x44, 0x3C, 0x01, 0x0C, 0x18, 0x24, 0x00, 0x3C,
+    0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x03, 0x0A, 0x18, 0x24, 0x00, 0x3C, 0x64, 0x60,
+    0x3C, 0x04, 0x44, 0x3C, 0x04, 0x0C, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x08,
+    0x08, 0x38, 0x06, 0x0A, 0x3C, 0x64, 0x60, 0x3C, 0x04, 0x44, 0x3C, 0x08, 0x08, 0x38, 0x01, 0x0C,
+    0x24, 0x18, 0x00, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x03, 0x0A, 0x24, 0x18,
+    0x00, 0x3C, 0x64, 0x60, 0x3C, 0x04, 0x44, 0x3C, 0x04, 0x0C, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x08, 0x08, 0x38, 0x04, 0x0C, 0x10, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x1E, 0x04, 0x04, 0x1C, 0x01, 0x0C, 0x24, 0x18, 0x00, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x03, 0x0A, 0x04, 0x14, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x04, 0x09,
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x18, 0x18, 0x18, 0x04, 0x09, 0x10, 0x10, 0x7E, 0x10, 0x78,
+    0x10, 0x10, 0x10, 0x1E, 0x01, 0x0C, 0x34, 0x2C, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x66, 0x3C, 0x03, 0x0A, 0x34, 0x2C, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x01, 0x0C,
+    0x3C, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x3C, 0x00,
+    0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x46, 0x46, 0x46, 0x46,
+    0x66, 0x66, 0x3E, 0x00, 0x0D, 0x18, 0x24, 0x24, 0x18, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x66, 0x3C, 0x01, 0x0C, 0x18, 0x24, 0x24, 0x18, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E,
+    0x01, 0x0C, 0x14, 0x3C, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A,
+    0x14, 0x2C, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x04, 0x0C, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x66, 0x3C, 0x10, 0x10, 0x18, 0x06, 0x0A, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66,
+    0x3E, 0x00, 0x04, 0x03, 0x01, 0x0C, 0x18, 0x24, 0x00, 0x83, 0x83, 0xC2, 0xDA, 0x5A, 0x5A, 0x6E,
+    0x66, 0x66, 0x03, 0x0A, 0x18, 0x24, 0x00, 0x83, 0xC3, 0x5A, 0x5A, 0x7A, 0x66, 0x64, 0x01, 0x0C,
+    0x18, 0x24, 0x00, 0xC2, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0D, 0x18, 0x24,
+    0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x02, 0x0B, 0x2C, 0x00, 0xC2,
+    0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0C, 0x08, 0x18, 0x00, 0x7E, 0x06, 0x04,
+    0x0C, 0x18, 0x10, 0x20, 0x60, 0x7E, 0x03, 0x0A, 0x04, 0x08, 0x00, 0x7E, 0x04, 0x08, 0x18, 0x30,
+    0x20, 0x7E, 0x01, 0x0C, 0x18, 0x00, 0x00, 0x7E, 0x06, 0x04, 0x0C, 0x18, 0x10, 0x20, 0x60, 0x7E,
+    0x03, 0x0A, 0x18, 0x00, 0x00, 0x7E, 0x04, 0x08, 0x18, 0x30, 0x20, 0x7E, 0x01, 0x0C, 0x24, 0x18,
+    0x00, 0x7E, 0x06, 0x04, 0x0C, 0x18, 0x10, 0x20, 0x60, 0x7E, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x7E,
+    0x04, 0x08, 0x18, 0x30, 0x20, 0x7E, 0x02, 0x0B, 0x0E, 0x18, 0x10, 0x10, 0x70, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x03, 0x0A, 0x40, 0xF8, 0x40, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x04,
+    0x09, 0x7C, 0xA6, 0xA2, 0x26, 0x3C, 0x22, 0x23, 0x22, 0x3E, 0x04, 0x09, 0x7E, 0x40, 0x40, 0x7C,
+    0x46, 0x42, 0x42, 0x46, 0x7C, 0x03, 0x0A, 0x7C, 0x60, 0x40, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66,
+    0x7C, 0x04, 0x09, 0x60, 0xE0, 0x60, 0x78, 0x7E, 0x62, 0x63, 0x62, 0x7C, 0x04, 0x09, 0x60, 0x60,
+    0x7E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x3C, 0x04, 0x09, 0x78, 0x4C, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x4C, 0x78, 0x03, 0x0A, 0x06, 0x3C, 0x60, 0x40, 0xC0, 0xC0, 0xC0, 0x40, 0x60, 0x3C, 0x04, 0x09,
+    0x02, 0x04, 0x3C, 0x60, 0x40, 0x40, 0x40, 0x60, 0x3C, 0x04, 0x09, 0x78, 0x44, 0x46, 0x42, 0xF2,
+    0x42, 0x46, 0x44, 0x78, 0x03, 0x0A, 0x30, 0xFE, 0xA2, 0x23, 0x23, 0x23, 0x23, 0x23, 0x26, 0x3C,
+    0x03, 0x0A, 0x3E, 0x3E, 0x02, 0x02, 0x1E, 0x7E, 0x42, 0x42, 0x62, 0x3E, 0x03, 0x0A, 0x3E, 0x06,
+    0x02, 0x3E, 0x66, 0x46, 0x42, 0x46, 0x66, 0x3E, 0x06, 0x0A, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66,
+    0x3C, 0x04, 0x04, 0x38, 0x04, 0x09, 0x7E, 0x02, 0x02, 0x02, 0x7E, 0x02, 0x02, 0x02, 0x7E, 0x04,
+    0x09, 0x3C, 0x26, 0x06, 0x02, 0x7E, 0x42, 0x46, 0x66, 0x3C, 0x04, 0x09, 0x3E, 0x60, 0x40, 0x60,
+    0x38, 0x60, 0x40, 0x60, 0x3E, 0x03, 0x0D, 0x1E, 0x3E, 0x30, 0x30, 0x3E, 0x3E, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x20, 0x60, 0x03, 0x0D, 0x0E, 0x18, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x20, 0x03, 0x0A, 0x1E, 0x7E, 0x40, 0xC0, 0xC0, 0xCE, 0xC6, 0x46, 0x66, 0x3C, 0x04,
+    0x0C, 0x42, 0x46, 0x24, 0x3C, 0x18, 0x18, 0x3C, 0x24, 0x64, 0x66, 0x66, 0x3C, 0x03, 0x0A, 0x80,
+    0xC0, 0xC0, 0xF0, 0xD8, 0xCA, 0xCA, 0xCA, 0xCA, 0xCE, 0x03, 0x0A, 0x3C, 0x7C, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x0E, 0x03, 0x0A, 0x3C, 0x7C, 0x18, 0x18, 0x18, 0x3C, 0x18, 0x18, 0x18,
+    0x7E, 0x03, 0x0A, 0x40, 0x46, 0x4F, 0x58, 0x70, 0x78, 0x48, 0x4C, 0x46, 0x42, 0x03, 0x0A, 0x38,
+    0x20, 0x60, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x03, 0x0A, 0x70, 0x10, 0x10, 0x10, 0x10,
+    0x38, 0x10, 0x10, 0x10, 0x0E, 0x03, 0x0A, 0x20, 0x24, 0x38, 0x30, 0x58, 0x18, 0x3C, 0x24, 0x66,
+    0x42, 0x04, 0x09, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x7E, 0x04, 0x0C, 0x66, 0x66,
+    0x76, 0x56, 0x5E, 0x4E, 0x4E, 0x46, 0x46, 0x40, 0x40, 0x80, 0x06, 0x0A, 0x7C, 0x66, 0x66, 0x46,
+    0x46, 0x46, 0x46, 0x06, 0x06, 0x02, 0x03, 0x0A, 0x18, 0x3C, 0x66, 0x42, 0x46, 0x7E, 0x42, 0x46,
+    0x66, 0x3C, 0x03, 0x0A, 0x01, 0x7E, 0x4C, 0xC4, 0x84, 0x84, 0x84, 0xC4, 0x4C, 0x78, 0x06, 0x07,
+    0x79, 0x4F, 0xC4, 0xC4, 0xC4, 0x4C, 0x78, 0x03, 0x0A, 0x32, 0x7F, 0x4F, 0xCB, 0xCB, 0xCB, 0xCB,
+    0xCB, 0x4B, 0x7B, 0x06, 0x09, 0x7B, 0x4F, 0x4F, 0x4B, 0x4B, 0x4B, 0x7B, 0x03, 0x03, 0x03, 0x0A,
+    0x38, 0x7E, 0xB2, 0x33, 0x32, 0x3E, 0x30, 0x30, 0x30, 0x30, 0x04, 0x0C, 0x38, 0x60, 0x7C, 0x66,
+    0x62, 0x42, 0x62, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x03, 0x0C, 0x40, 0x40, 0x78, 0x4C, 0x46, 0x46,
+    0x6C, 0x78, 0x44, 0x46, 0x02, 0x03, 0x03, 0x0A, 0x38, 0x7C, 0x02, 0x02, 0x0E, 0x38, 0x60, 0x40,
+    0x62, 0x3E, 0x06, 0x07, 0x3C, 0x06, 0x04, 0x3C, 0x60, 0x60, 0x3C, 0x04, 0x09, 0x7E, 0x60, 0x20,
+    0x10, 0x18, 0x10, 0x20, 0x60, 0x7E, 0x03, 0x0D, 0x70, 0x58, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x06, 0x04, 0x0C, 0x10, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E,
+    0x06, 0x04, 0x18, 0x03, 0x0A, 0x3E, 0x7E, 0x98, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03,
+    0x0A, 0x0C, 0x10, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x03, 0x0D, 0x7E, 0x7E, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x0E, 0x03, 0x0A, 0x01, 0x87, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0xCC, 0x78, 0x06, 0x07, 0x8D, 0x8E, 0x8C, 0x8C, 0xCC, 0xCC, 0x7C, 0x04,
+    0x09, 0xEE, 0x64, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x40, 0x40, 0x44, 0x44,
+    0x46, 0x46, 0x46, 0x46, 0x6C, 0x38, 0x03, 0x0A, 0x02, 0x46, 0x4C, 0x28, 0x38, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x06, 0x0A, 0xC3, 0x44, 0x44, 0x2C, 0x28, 0x38, 0x10, 0x10, 0x30, 0x60, 0x03, 0x0A,
+    0x3E, 0x7E, 0x06, 0x04, 0x08, 0x3C, 0x30, 0x20, 0x60, 0x7E, 0x06, 0x07, 0x7E, 0x04, 0x08, 0x7E,
+    0x30, 0x20, 0x7E, 0x03, 0x0A, 0x7C, 0x7E, 0x04, 0x08, 0x18, 0x0E, 0x03, 0x83, 0xC2, 0x7E, 0x03,
+    0x0A, 0x7E, 0x7E, 0x20, 0x10, 0x38, 0x70, 0xC0, 0xC3, 0xC2, 0x7E, 0x06, 0x0A, 0x7E, 0x20, 0x10,
+    0x18, 0x38, 0x60, 0x40, 0x40, 0x72, 0x1E, 0x06, 0x0A, 0x7E, 0x04, 0x08, 0x18, 0x0E, 0x06, 0x3C,
+    0x60, 0x64, 0x3C, 0x03, 0x0A, 0x38, 0x7C, 0x06, 0x06, 0x04, 0x3C, 0x18, 0x30, 0x60, 0x7E, 0x03,
+    0x0A, 0x3E, 0x7E, 0x60, 0x60, 0x78, 0x3E, 0x03, 0x83, 0xC2, 0x7E, 0x06, 0x0A, 0x3C, 0x20, 0x20,
+    0x20, 0x3C, 0x06, 0x02, 0x02, 0x4E, 0x78, 0x04, 0x09, 0x10, 0x38, 0x38, 0x18, 0x1C, 0x06, 0x06,
+    0x04, 0x7C, 0x06, 0x0A, 0x7E, 0x62, 0x42, 0x46, 0x44, 0x58, 0x70, 0x60, 0x40, 0x40, 0x04, 0x09,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0A, 0x20, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x04, 0x09, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x18,
+    0x04, 0x09, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x01, 0x0C, 0x24, 0x18, 0x00,
+    0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x3C, 0x44,
+    0x06, 0x3E, 0x46, 0x46, 0x3E, 0x01, 0x0C, 0x24, 0x18, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x7E, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x01,
+    0x0C, 0x24, 0x18, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x24,
+    0x18, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x24, 0x18, 0x00, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x46, 0x46, 0x46, 0x46,
+    0x66, 0x66, 0x3E, 0x00, 0x0D, 0x3C, 0x00, 0x2C, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x66, 0x3C, 0x01, 0x0C, 0x3C, 0x00, 0x2C, 0x00, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E,
+    0x00, 0x0D, 0x08, 0x10, 0x2C, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01,
+    0x0C, 0x0C, 0x18, 0x2C, 0x00, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x00, 0x0D, 0x24,
+    0x18, 0x2C, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x24, 0x18,
+    0x2C, 0x00, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x00, 0x0D, 0x10, 0x18, 0x2C, 0x00,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x30, 0x10, 0x2C, 0x00, 0x00,
+    0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x06, 0x07, 0x3C, 0x46, 0x02, 0x7E, 0x42, 0x66, 0x3C,
+    0x00, 0x0D, 0x3C, 0x00, 0x2C, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x01,
+    0x0C, 0x3C, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x00, 0x0D, 0x3C,
+    0x00, 0x18, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x01, 0x0C, 0x3C, 0x00,
+    0x18, 0x00, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x01, 0x0C, 0x1E, 0x00, 0x00, 0x3E,
+    0x28, 0x28, 0x28, 0x6E, 0x48, 0x78, 0xC8, 0x8F, 0x03, 0x0A, 0x3C, 0x00, 0x00, 0x7E, 0x1B, 0x1B,
+    0x7F, 0xD8, 0xD8, 0x7E, 0x01, 0x0C, 0x24, 0x18, 0x00, 0x3C, 0x62, 0x40, 0x40, 0x4E, 0x42, 0x42,
+    0x62, 0x3C, 0x03, 0x0D, 0x24, 0x18, 0x00, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x04,
+    0x38, 0x01, 0x0C, 0x24, 0x18, 0x00, 0x42, 0x44, 0x48, 0x70, 0x78, 0x48, 0x4C, 0x46, 0x42, 0x01,
+    0x0C, 0x24, 0x78, 0x60, 0x60, 0x60, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x04, 0x0C, 0x3C,
+    0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x10, 0x10, 0x18, 0x06, 0x0A, 0x3C, 0x66, 0x42,
+    0x42, 0x42, 0x66, 0x3C, 0x10, 0x10, 0x18, 0x01, 0x0F, 0x3C, 0x00, 0x00, 0x3C, 0x66, 0x46, 0x42,
+    0x42, 0x42, 0x46, 0x66, 0x3C, 0x10, 0x10, 0x18, 0x03, 0x0D, 0x3C, 0x00, 0x00, 0x3C, 0x66, 0x42,
+    0x42, 0x42, 0x66, 0x3C, 0x10, 0x10, 0x18, 0x01, 0x0C, 0x24, 0x18, 0x7C, 0x7E, 0x04, 0x08, 0x18,
+    0x0E, 0x03, 0x83, 0xC2, 0x7E, 0x03, 0x0D, 0x24, 0x18, 0x00, 0x7E, 0x04, 0x08, 0x10, 0x3C, 0x06,
+    0x02, 0x02, 0x4E, 0x78, 0x03, 0x0D, 0x24, 0x18, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x18, 0x70, 0x01, 0x0C, 0x0C, 0x08, 0x00, 0x3C, 0x62, 0x40, 0x40, 0x4E, 0x42, 0x42, 0x62,
+    0x3C, 0x03, 0x0D, 0x0C, 0x18, 0x00, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x04, 0x38,
+    0x04, 0x09, 0xD8, 0xD8, 0xD8, 0xF8, 0xFB, 0xDA, 0xDA, 0xCA, 0xCE, 0x01, 0x0C, 0x10, 0x18, 0x00,
+    0x62, 0x62, 0x72, 0x52, 0x5A, 0x4A, 0x4E, 0x46, 0x46, 0x03, 0x0A, 0x30, 0x10, 0x00, 0x7C, 0x66,
+    0x66, 0x46, 0x46, 0x46, 0x46, 0x01, 0x0C, 0x06, 0x04, 0x00, 0x3E, 0x28, 0x28, 0x28, 0x6E, 0x48,
+    0x78, 0xC8, 0x8F, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x7E, 0x1B, 0x1B, 0x7F, 0xD8, 0xD8, 0x7E, 0x01,
+    0x0C, 0x08, 0x10, 0x00, 0x3E, 0x66, 0x46, 0x4E, 0x52, 0x72, 0x66, 0x66, 0xBC, 0x03, 0x0A, 0x0C,
+    0x18, 0x00, 0x3E, 0x66, 0x4E, 0x52, 0x72, 0x66, 0x7C, 0x01, 0x0C, 0x28, 0x00, 0x00, 0x18, 0x18,
+    0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x03, 0x0A, 0x28, 0x14, 0x00, 0x3C, 0x44, 0x06, 0x3E,
+    0x46, 0x46, 0x3E, 0x01, 0x0C, 0x38, 0x00, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42,
+    0xC2, 0x03, 0x0A, 0x3C, 0x24, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x01, 0x0C, 0x28,
+    0x00, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A, 0x28, 0x14, 0x00,
+    0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x01, 0x0C, 0x38, 0x00, 0x00, 0x7E, 0x60, 0x60, 0x60,
+    0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A, 0x3C, 0x24, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62,
+    0x3C, 0x01, 0x0C, 0x28, 0x00, 0x00, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x03,
+    0x0A, 0x28, 0x14, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x01, 0x0C, 0x38, 0x00, 0x00,
+    0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x03, 0x0A, 0x3C, 0x24, 0x00, 0x38, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x7E, 0x01, 0x0C, 0x28, 0x00, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42,
+    0x46, 0x66, 0x3C, 0x03, 0x0A, 0x28, 0x14, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01,
+    0x0C, 0x38, 0x00, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x3C,
+    0x24, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x78, 0x28, 0x00, 0x7C, 0x46,
+    0x46, 0x46, 0x7C, 0x4C, 0x46, 0x42, 0x43, 0x03, 0x0A, 0x14, 0x1A, 0x00, 0x3E, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x01, 0x0C, 0x38, 0x00, 0x00, 0x7C, 0x46, 0x46, 0x46, 0x7C, 0x4C, 0x46, 0x42,
+    0x43, 0x03, 0x0A, 0x1C, 0x12, 0x00, 0x3E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x01, 0x0C, 0x28,
+    0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x28, 0x14, 0x00,
+    0x46, 0x46, 0x46, 0x46, 0x66, 0x66, 0x3E, 0x01, 0x0C, 0x38, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x3C, 0x24, 0x00, 0x46, 0x46, 0x46, 0x46, 0x66, 0x66,
+    0x3E, 0x04, 0x0C, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x00, 0x10, 0x10, 0x06,
+    0x0A, 0x3C, 0x64, 0x60, 0x3C, 0x04, 0x44, 0x3C, 0x00, 0x10, 0x10, 0x04, 0x0C, 0xFF, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x10, 0x10, 0x04, 0x0C, 0x10, 0x10, 0x7E, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x1E, 0x00, 0x08, 0x10, 0x03, 0x0D, 0x18, 0x7C, 0x06, 0x06, 0x04, 0x1C, 0x3E,
+    0x02, 0x02, 0x06, 0x0C, 0x70, 0x40, 0x06, 0x0A, 0x3C, 0x06, 0x04, 0x0C, 0x3C, 0x06, 0x06, 0x0C,
+    0x38, 0x40, 0x01, 0x0C, 0x24, 0x18, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42,
+    0x01, 0x0C, 0x24, 0x78, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x03, 0x0D,
+    0x48, 0x7C, 0x66, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x02, 0x02, 0x02, 0x03, 0x0B, 0x08,
+    0x08, 0x08, 0x78, 0xD8, 0x88, 0x88, 0x8A, 0xDD, 0x7E, 0x08, 0x03, 0x0D, 0x3E, 0x7E, 0x06, 0x04,
+    0x08, 0x18, 0x10, 0x20, 0x60, 0x7E, 0x02, 0x02, 0x0C, 0x06, 0x0A, 0x7E, 0x04, 0x08, 0x18, 0x30,
+    0x20, 0x7E, 0x06, 0x04, 0x18, 0x01, 0x0C, 0x18, 0x00, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66,
+    0x7E, 0x42, 0xC2, 0x03, 0x0A, 0x18, 0x00, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x04,
+    0x0C, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x08, 0x08, 0x18, 0x06, 0x0A, 0x3C,
+    0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x08, 0x08, 0x18, 0x00, 0x0D, 0x3C, 0x00, 0x2C, 0x00, 0x3C,
+    0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x01, 0x0C, 0x3C, 0x00, 0x2C, 0x00, 0x00, 0x3C,
+    0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x00, 0x0D, 0x3C, 0x34, 0x2C, 0x00, 0x3C, 0x66, 0x46, 0x42,
+    0x42, 0x42, 0x46, 0x66, 0x3C, 0x01, 0x0C, 0x3C, 0x00, 0x34, 0x2C, 0x00, 0x3C, 0x66, 0x42, 0x42,
+    0x42, 0x66, 0x3C, 0x01, 0x0C, 0x18, 0x00, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66,
+    0x3C, 0x03, 0x0A, 0x18, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x00, 0x0D, 0x3C,
+    0x00, 0x18, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x01, 0x0C, 0x3C, 0x00,
+    0x18, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x01, 0x0C, 0x3C, 0x00, 0x00, 0xC2,
+    0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0D, 0x3C, 0x00, 0x00, 0x42, 0x66, 0x24,
+    0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x03, 0x0B, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x14, 0x1A, 0x1C, 0x10, 0x06, 0x08, 0x70, 0x58, 0x58, 0x58, 0x5E, 0x4E, 0x4E, 0x08, 0x04, 0x0A,
+    0x10, 0x10, 0x7E, 0x10, 0x10, 0x10, 0x1C, 0x18, 0x1C, 0x10, 0x06, 0x0A, 0x38, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x18, 0x70, 0x04, 0x09, 0x10, 0x10, 0x7E, 0x5A, 0x52, 0x52, 0x52, 0x5A,
+    0x7C, 0x06, 0x09, 0x7E, 0x5A, 0x52, 0x52, 0x52, 0x5A, 0x7C, 0x10, 0x10, 0x03, 0x0A, 0x10, 0x1A,
+    0x3C, 0x2C, 0x2C, 0x34, 0x7E, 0x7E, 0x42, 0xC3, 0x03, 0x0A, 0x1E, 0x3E, 0x64, 0x44, 0x48, 0x50,
+    0x70, 0x60, 0x60, 0xBE, 0x06, 0x07, 0x3E, 0x24, 0x68, 0x70, 0x70, 0x60, 0x5E, 0x03, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0xF8, 0x60, 0x20, 0x20, 0x3F, 0x03, 0x0A, 0x7F, 0x7E, 0x1C, 0x1C, 0x18,
+    0x18, 0x18, 0x38, 0x58, 0xD8, 0x06, 0x0A, 0x3C, 0x60, 0x60, 0x3C, 0x06, 0x04, 0x7C, 0x18, 0x08,
+    0x06, 0x06, 0x0A, 0x7E, 0x04, 0x08, 0x18, 0x30, 0x20, 0x60, 0x30, 0x18, 0x0E, 0x03, 0x0A, 0x38,
+    0x7E, 0x82, 0x02, 0x02, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x03, 0x0A, 0x70, 0x7C, 0x46, 0x46, 0x7C,
+    0x7C, 0x62, 0xF2, 0x46, 0x7C, 0x03, 0x0A, 0x40, 0x42, 0x42, 0x42, 0x42, 0xFF, 0x66, 0x42, 0x66,
+    0x3C, 0x03, 0x0A, 0x10, 0x18, 0x38, 0x2C, 0x24, 0x24, 0x66, 0x46, 0x42, 0xC2, 0x03, 0x0A, 0x30,
+    0x7C, 0x66, 0x66, 0x64, 0xF8, 0x6C, 0x66, 0x62, 0x63, 0x06, 0x07, 0x3E, 0x30, 0x30, 0x7E, 0x30,
+    0x30, 0x30, 0x03, 0x03, 0x18, 0x10, 0x10, 0x0D, 0x03, 0x08, 0x18, 0x10, 0x04, 0x09, 0x46, 0x46,
+    0x4E, 0x4A, 0x5A, 0x52, 0x72, 0x62, 0x62, 0x06, 0x07, 0x46, 0x46, 0x4E, 0x5E, 0x76, 0x66, 0x66,
+    0x0E, 0x02, 0x10, 0x08, 0x06, 0x07, 0x38, 0x4C, 0x06, 0x06, 0x06, 0x44, 0x38, 0x06, 0x07, 0x1C,
+    0x22, 0x60, 0x6C, 0x6C, 0x22, 0x1C, 0x06, 0x07, 0x38, 0x4C, 0x06, 0x36, 0x36, 0x44, 0x38, 0x06,
+    0x09, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x10, 0x04, 0x09, 0x3C, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x4C, 0x78, 0x03, 0x02, 0x0C, 0x18, 0x01, 0x03, 0x0C, 0x18, 0x2C, 0x03, 0x0A,
+    0x60, 0x58, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x08, 0x02, 0x18, 0x18, 0x03, 0x0A,
+    0x80, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A, 0x80, 0x42, 0x42, 0x42,
+    0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x03, 0x0A, 0x80, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x7E, 0x03, 0x0A, 0x40, 0xBC, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x04, 0x09,
+    0xC2, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0A, 0x40, 0xBC, 0x66, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x24, 0xEE, 0x01, 0x0C, 0x0C, 0x18, 0x2C, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x0C, 0x04, 0x09, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x04, 0x09,
+    0x7C, 0x46, 0x46, 0x46, 0x7C, 0x46, 0x42, 0x46, 0x7C, 0x04, 0x09, 0x7E, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x04, 0x09, 0x18, 0x18, 0x2C, 0x24, 0x24, 0x66, 0x46, 0x42, 0xFE, 0x04,
+    0x09, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x04, 0x09, 0x7E, 0x06, 0x04, 0x0C,
+    0x18, 0x10, 0x20, 0x60, 0x7E, 0x04, 0x09, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42,
+    0x04, 0x09, 0x3C, 0x66, 0x46, 0x42, 0x7E, 0x42, 0x46, 0x66, 0x3C, 0x04, 0x09, 0x7E, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x04, 0x09, 0x42, 0x44, 0x48, 0x70, 0x78, 0x48, 0x4C, 0x46,
+    0x42, 0x04, 0x09, 0x18, 0x18, 0x2C, 0x24, 0x24, 0x66, 0x46, 0x42, 0xC2, 0x04, 0x09, 0xE6, 0xE6,
+    0xE6, 0xFA, 0xDA, 0xDA, 0xC2, 0xC2, 0xC2, 0x04, 0x09, 0x62, 0x62, 0x72, 0x52, 0x5A, 0x4A, 0x4E,
+    0x46, 0x46, 0x04, 0x09, 0x7E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7E, 0x04, 0x09, 0x3C,
+    0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x04, 0x09, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x04, 0x09, 0x7C, 0x66, 0x62, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x04, 0x09,
+    0x7E, 0x60, 0x20, 0x10, 0x18, 0x10, 0x20, 0x60, 0x7E, 0x04, 0x09, 0xFF, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x04, 0x09, 0xC2, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04,
+    0x09, 0x3C, 0x18, 0x3C, 0x7E, 0x5A, 0x7E, 0x3C, 0x18, 0x3C, 0x04, 0x09, 0x42, 0x66, 0x3C, 0x18,
+    0x18, 0x3C, 0x24, 0x66, 0xC2, 0x04, 0x09, 0x5A, 0x5A, 0x5A, 0x5A, 0x5E, 0x7E, 0x3C, 0x18, 0x3C,
+    0x04, 0x09, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x42, 0x42, 0x24, 0xEE, 0x02, 0x0B, 0x2C, 0x00, 0x7E,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x02, 0x0B, 0x2C, 0x00, 0xC2, 0x66, 0x24, 0x3C,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x7A, 0x4E, 0xC4, 0xC4, 0xC4, 0x4C,
+    0x7A, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x3E, 0x60, 0x20, 0x38, 0x60, 0x60, 0x3E, 0x03, 0x0D, 0x0C,
+    0x18, 0x00, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x06, 0x06, 0x06, 0x03, 0x0A, 0x0C, 0x18,
+    0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x01, 0x0C, 0x0C, 0x18, 0x2C, 0x00, 0x00, 0xE6,
+    0x22, 0x22, 0x22, 0x22, 0x24, 0x3C, 0x06, 0x07, 0x7A, 0x4E, 0xC4, 0xC4, 0xC4, 0x4C, 0x7A, 0x03,
+    0x0D, 0x38, 0x64, 0x44, 0x44, 0x5C, 0x5E, 0x42, 0x42, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x06, 0x0A,
+    0xC2, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x10, 0x03, 0x0A, 0x3C, 0x60, 0x60, 0x3C,
+    0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x06, 0x07, 0x3E, 0x60, 0x20, 0x38, 0x60, 0x60, 0x3E, 0x03,
+    0x0D, 0x7E, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x40, 0x40, 0x60, 0x3C, 0x06, 0x06, 0x04, 0x06, 0x0A,
+    0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46, 0x06, 0x06, 0x06, 0x02, 0x0B, 0x38, 0x24, 0x66, 0x46,
+    0x42, 0x7E, 0x42, 0x46, 0x66, 0x24, 0x38, 0x06, 0x07, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0C,
+    0x06, 0x07, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x03, 0x0A, 0x60, 0x10, 0x18, 0x18, 0x18,
+    0x3C, 0x24, 0x24, 0x46, 0x42, 0x06, 0x0A, 0x46, 0x46, 0x46, 0x46, 0x46, 0x66, 0x7A, 0x40, 0x40,
+    0x40, 0x06, 0x07, 0x44, 0x62, 0x62, 0x26, 0x24, 0x3C, 0x18, 0x03, 0x0D, 0x7C, 0x38, 0x60, 0x60,
+    0x3C, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x06, 0x04, 0x06, 0x07, 0x3C, 0x66, 0x42, 0x42, 0x42,
+    0x66, 0x3C, 0x06, 0x07, 0xFE, 0x66, 0x64, 0x64, 0x64, 0x66, 0x66, 0x06, 0x0A, 0x3C, 0x26, 0x62,
+    0x42, 0x62, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x06, 0x0A, 0x3E, 0x20, 0x60, 0x60, 0x60, 0x20, 0x1C,
+    0x06, 0x06, 0x04, 0x06, 0x07, 0x3E, 0x64, 0x46, 0x42, 0x42, 0x66, 0x3C, 0x06, 0x07, 0x7E, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x07, 0xE6, 0x22, 0x22, 0x22, 0x22, 0x24, 0x3C, 0x06, 0x0A,
+    0x2C, 0x5E, 0x5A, 0xDA, 0x5A, 0x5E, 0x3C, 0x18, 0x18, 0x18, 0x06, 0x0A, 0x66, 0x24, 0x3C, 0x18,
+    0x18, 0x18, 0x38, 0x2C, 0x64, 0x42, 0x06, 0x0A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x7E, 0x3C, 0x18,
+    0x18, 0x10, 0x06, 0x07, 0x46, 0x42, 0xC2, 0xDA, 0xDA, 0x5A, 0x7E, 0x03, 0x0A, 0x2C, 0x00, 0x00,
+    0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0xE6, 0x22, 0x22, 0x22,
+    0x22, 0x24, 0x3C, 0x03, 0x0A, 0x0C, 0x18, 0x00, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03,
+    0x0A, 0x0C, 0x18, 0x00, 0xE6, 0x22, 0x22, 0x22, 0x22, 0x24, 0x3C, 0x03, 0x0A, 0x0C, 0x18, 0x00,
+    0x46, 0x42, 0xC2, 0xDA, 0xDA, 0x5A, 0x7E, 0x03, 0x0A, 0x38, 0x3C, 0x64, 0x44, 0x7C, 0x7C, 0x46,
+    0x62, 0x66, 0x3C, 0x03, 0x0A, 0x1C, 0x3C, 0x26, 0x22, 0x5E, 0x4E, 0x42, 0x46, 0x6C, 0x3C, 0x03,
+    0x0A, 0x42, 0xE7, 0x3A, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0A, 0xC2, 0xE7, 0x3A,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x02, 0x0B, 0x2C, 0x42, 0xE7, 0x3A, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x04, 0x0C, 0x18, 0x18, 0x3C, 0x7E, 0x5A, 0x5A, 0x5A, 0x7E, 0x3C, 0x18,
+    0x18, 0x10, 0x06, 0x07, 0xFF, 0x42, 0xC2, 0xDA, 0xDA, 0x5A, 0x6E, 0x06, 0x0A, 0xE2, 0x36, 0x3C,
+    0x38, 0x28, 0x68, 0xC6, 0x02, 0x06, 0x0C, 0x03, 0x0D, 0x18, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x42,
+    0x46, 0x66, 0x3C, 0x18, 0x18, 0x10, 0x06, 0x0A, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x18,
+    0x18, 0x10, 0x03, 0x0D, 0x0E, 0x3E, 0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x60, 0x38, 0x04, 0x0C,
+    0x08, 0x06, 0x0A, 0x3E, 0x60, 0x40, 0x40, 0x40, 0x60, 0x38, 0x0C, 0x0C, 0x08, 0x04, 0x09, 0x7E,
+    0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x03, 0x0D, 0x0C, 0x10, 0x10, 0x10, 0x10, 0x1C,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0xC0, 0x04, 0x09, 0x60, 0x20, 0x22, 0x6E, 0x76, 0x44, 0x04,
+    0x04, 0x06, 0x03, 0x0A, 0x30, 0x20, 0x20, 0x60, 0x7E, 0x7E, 0x04, 0x04, 0x0C, 0x08, 0x03, 0x0D,
+    0x70, 0xFC, 0x64, 0x66, 0x6A, 0x1A, 0x1A, 0x1B, 0x1A, 0x1A, 0x02, 0x06, 0x04, 0x06, 0x09, 0x60,
+    0x10, 0x08, 0x1C, 0x34, 0x2E, 0x52, 0x02, 0x02, 0x06, 0x07, 0xE2, 0x36, 0x3C, 0x38, 0x28, 0x68,
+    0xC6, 0x06, 0x0A, 0x3C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x60, 0x30, 0x1E, 0x06, 0x07, 0x1C,
+    0x22, 0x60, 0x60, 0x60, 0x22, 0x1C, 0x02, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x18, 0x70, 0x03, 0x0A, 0x18, 0x3C, 0x66, 0x42, 0x7E, 0x7E, 0x42, 0x46,
+    0x66, 0x3C, 0x06, 0x07, 0x3E, 0x60, 0x40, 0x7E, 0x40, 0x20, 0x3E, 0x06, 0x07, 0x78, 0x04, 0x04,
+    0x7E, 0x04, 0x0C, 0x78, 0x04, 0x09, 0x60, 0x7C, 0x66, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x02,
+    0x0E, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x04,
+    0x09, 0x1C, 0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x03, 0x0A, 0x42, 0xE6, 0xFE, 0xDA,
+    0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x06, 0x0A, 0x66, 0x7E, 0x5A, 0x52, 0x42, 0x42, 0x42, 0x40,
+    0x40, 0x40, 0x06, 0x0A, 0x3C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x40, 0xFC, 0x40, 0x03, 0x0A,
+    0x30, 0x7C, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x78, 0x04, 0x09, 0x1C, 0x22, 0x60, 0x40,
+    0x4C, 0x4C, 0x60, 0x22, 0x1C, 0x03, 0x0A, 0x30, 0x7C, 0x04, 0x06, 0x06, 0x36, 0x36, 0x06, 0x0C,
+    0x78, 0x01, 0x0C, 0x10, 0x18, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x02,
+    0x0B, 0x34, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0D, 0xF8, 0xF8,
+    0x60, 0x60, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x02, 0x06, 0x0C, 0x01, 0x0C, 0x0C, 0x08, 0x00,
+    0x7E, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x04, 0x09, 0x1C, 0x22, 0x60, 0x40, 0x7C,
+    0x40, 0x60, 0x22, 0x1C, 0x04, 0x09, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x06, 0x02, 0x46, 0x3C, 0x04,
+    0x09, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x02, 0x0B, 0x2C, 0x00, 0x7E, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x04, 0x09, 0x3C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x4C, 0x78, 0x03, 0x0A, 0x38, 0x38, 0x28, 0x28, 0x2C, 0x2E, 0x6B, 0x6B, 0x4B, 0xCE, 0x03, 0x0A,
+    0x08, 0x88, 0x88, 0x88, 0xFC, 0xFE, 0x8B, 0x8B, 0x8B, 0x8E, 0x03, 0x0A, 0xF8, 0xF8, 0x60, 0x60,
+    0x7C, 0x66, 0x62, 0x62, 0x62, 0x62, 0x01, 0x0C, 0x08, 0x18, 0x00, 0x42, 0x44, 0x48, 0x70, 0x78,
+    0x48, 0x4C, 0x46, 0x42, 0x01, 0x0C, 0x10, 0x18, 0x00, 0x46, 0x46, 0x4E, 0x4A, 0x5A, 0x52, 0x72,
+    0x62, 0x62, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x10,
+    0x60, 0x03, 0x0C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x18, 0x18, 0x04,
+    0x09, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x04, 0x09, 0x7E, 0x40, 0x40, 0x7C,
+    0x46, 0x42, 0x42, 0x46, 0x7C, 0x04, 0x09, 0x7C, 0x46, 0x46, 0x46, 0x7C, 0x46, 0x42, 0x46, 0x7C,
+    0x04, 0x09, 0x7E, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x04, 0x0B, 0x7E, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x46, 0xFF, 0x83, 0x83, 0x04, 0x09, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x60,
+    0x60, 0x60, 0x7E, 0x04, 0x09, 0xDA, 0x5E, 0x7C, 0x3C, 0x3C, 0x7E, 0x5A, 0x5A, 0xDB, 0x04, 0x09,
+    0x3C, 0x44, 0x06, 0x04, 0x3C, 0x06, 0x06, 0x46, 0x3C, 0x04, 0x09, 0x46, 0x46, 0x4E, 0x4A, 0x5A,
+    0x52, 0x72, 0x62, 0x62, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x46, 0x46, 0x4E, 0x4A, 0x5A, 0x52,
+    0x72, 0x62, 0x62, 0x04, 0x09, 0x42, 0x44, 0x48, 0x70, 0x78, 0x48, 0x4C, 0x46, 0x42, 0x04, 0x09,
+    0x3E, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x62, 0xC2, 0x04, 0x09, 0xE6, 0xE6, 0xE6, 0xFA, 0xDA,
+    0xDA, 0xC2, 0xC2, 0xC2, 0x04, 0x09, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x04,
+    0x09, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x04, 0x09, 0x7E, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x04, 0x09, 0x7C, 0x66, 0x62, 0x62, 0x66, 0x7C, 0x60, 0x60, 0x60,
+    0x04, 0x09, 0x1C, 0x22, 0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x04, 0x09, 0xFF, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x09, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x10,
+    0x60, 0x04, 0x09, 0x18, 0x7C, 0x5E, 0xDA, 0xDA, 0xDA, 0x5E, 0x3C, 0x18, 0x04, 0x09, 0x42, 0x66,
+    0x3C, 0x18, 0x18, 0x3C, 0x24, 0x66, 0xC2, 0x04, 0x0B, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0xC6, 0xFF, 0x03, 0x03, 0x04, 0x09, 0x42, 0x42, 0x42, 0x46, 0x3E, 0x02, 0x02, 0x02, 0x02, 0x04,
+    0x09, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x7E, 0x04, 0x0B, 0xD2, 0xD2, 0xD2, 0xD2,
+    0xD2, 0xD2, 0xD2, 0xD2, 0xFF, 0x03, 0x03, 0x04, 0x09, 0xE0, 0x20, 0x20, 0x3C, 0x26, 0x22, 0x22,
+    0x26, 0x3C, 0x04, 0x09, 0xC2, 0xC2, 0xC2, 0xF2, 0xDA, 0xCA, 0xCA, 0xDA, 0xF2, 0x04, 0x09, 0x60,
+    0x60, 0x60, 0x7C, 0x66, 0x62, 0x62, 0x66, 0x7C, 0x04, 0x09, 0x78, 0x4C, 0x06, 0x06, 0x7E, 0x06,
+    0x06, 0x4C, 0x78, 0x04, 0x09, 0xDC, 0xD2, 0xF2, 0xF2, 0xF3, 0xF2, 0xF2, 0xD2, 0xDC, 0x04, 0x09,
+    0x3E, 0x62, 0x42, 0x62, 0x3E, 0x32, 0x22, 0x62, 0x42, 0x06, 0x07, 0x3C, 0x44, 0x06, 0x3E, 0x46,
+    0x46, 0x3E, 0x03, 0x0A, 0x0C, 0x30, 0x60, 0x7C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x06, 0x07,
+    0x7C, 0x64, 0x64, 0x7C, 0x64, 0x64, 0x7C, 0x06, 0x07, 0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x06, 0x09, 0x3C, 0x24, 0x24, 0x24, 0x64, 0x64, 0x7E, 0x42, 0x42, 0x06, 0x07, 0x3C, 0x66, 0x42,
+    0x7E, 0x40, 0x62, 0x3C, 0x06, 0x07, 0x5A, 0x7C, 0x3C, 0x3C, 0x5E, 0x5A, 0xDA, 0x06, 0x07, 0x3C,
+    0x46, 0x04, 0x3C, 0x06, 0x46, 0x3C, 0x06, 0x07, 0x46, 0x46, 0x4E, 0x5E, 0x76, 0x66, 0x66, 0x03,
+    0x0A, 0x24, 0x18, 0x00, 0x46, 0x46, 0x4E, 0x5E, 0x76, 0x66, 0x66, 0x06, 0x07, 0x66, 0x6C, 0x78,
+    0x78, 0x6C, 0x66, 0x62, 0x06, 0x07, 0x3E, 0x26, 0x26, 0x26, 0x26, 0x66, 0xC6, 0x06, 0x07, 0xC3,
+    0xC7, 0xE7, 0xFF, 0xDB, 0xC3, 0xC3, 0x06, 0x07, 0x46, 0x46, 0x46, 0x7E, 0x46, 0x46, 0x46, 0x06,
+    0x07, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x06, 0x07, 0x7E, 0x46, 0x46, 0x46, 0x46, 0x46,
+    0x46, 0x06, 0x0A, 0x7C, 0x66, 0x62, 0x42, 0x62, 0x66, 0x7C, 0x40, 0x40, 0x40, 0x06, 0x07, 0x1C,
+    0x22, 0x60, 0x60, 0x60, 0x22, 0x1C, 0x06, 0x07, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x06,
+    0x0A, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x02, 0x0E, 0x18, 0x18, 0x18,
+    0x18, 0x3C, 0x5E, 0x5A, 0x5A, 0x5A, 0x5E, 0x3C, 0x18, 0x18, 0x18, 0x06, 0x07, 0x46, 0x24, 0x18,
+    0x18, 0x38, 0x24, 0x42, 0x06, 0x09, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x7E, 0x02, 0x02, 0x06,
+    0x07, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x06, 0x06, 0x06, 0x07, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+    0x7E, 0x06, 0x09, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xFF, 0x01, 0x01, 0x06, 0x07, 0xE0, 0x20,
+    0x20, 0x3E, 0x22, 0x22, 0x3E, 0x06, 0x07, 0x42, 0x42, 0x42, 0x72, 0x4A, 0x4A, 0x72, 0x06, 0x07,
+    0x40, 0x40, 0x40, 0x7C, 0x46, 0x46, 0x7C, 0x06, 0x07, 0x38, 0x44, 0x06, 0x3E, 0x06, 0x44, 0x38,
+    0x06, 0x07, 0xCC, 0xD2, 0xD2, 0xF2, 0xD2, 0xD2, 0xCC, 0x06, 0x07, 0x3C, 0x64, 0x64, 0x3C, 0x34,
+    0x24, 0x64, 0x03, 0x0A, 0x20, 0x10, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x04, 0x09,
+    0x34, 0x00, 0x3C, 0x66, 0x42, 0x7E, 0x40, 0x62, 0x3C, 0x03, 0x0D, 0x60, 0x60, 0x60, 0xF8, 0x60,
+    0x7C, 0x66, 0x62, 0x62, 0x62, 0x06, 0x0C, 0x08, 0x03, 0x0A, 0x04, 0x08, 0x00, 0x3C, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x06, 0x07, 0x1C, 0x22, 0x60, 0x7C, 0x60, 0x22, 0x1C, 0x06, 0x07, 0x3C,
+    0x64, 0x60, 0x3C, 0x04, 0x44, 0x3C, 0x02, 0x0B, 0x18, 0x00, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x7E, 0x03, 0x0A, 0x34, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x02,
+    0x0E, 0x08, 0x00, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0x70, 0x06,
+    0x07, 0x78, 0x68, 0x68, 0x6E, 0x6B, 0x4B, 0xCE, 0x06, 0x07, 0xC8, 0xC8, 0xC8, 0xFE, 0xCA, 0xCA,
+    0xCE, 0x03, 0x0A, 0x60, 0x60, 0x60, 0xF8, 0x60, 0x7C, 0x66, 0x62, 0x62, 0x62, 0x03, 0x0A, 0x04,
+    0x08, 0x00, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x62, 0x03, 0x0A, 0x10, 0x08, 0x00, 0x46, 0x46,
+    0x4E, 0x5E, 0x76, 0x66, 0x66, 0x03, 0x0D, 0x24, 0x18, 0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18,
+    0x18, 0x18, 0x10, 0x60, 0x06, 0x08, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x7E, 0x18, 0x03, 0x0A,
+    0x20, 0x20, 0xFC, 0x20, 0x38, 0x3E, 0x22, 0x22, 0x26, 0x3C, 0x03, 0x0A, 0x20, 0x20, 0x20, 0xFC,
+    0x20, 0x20, 0x3E, 0x22, 0x22, 0x3E, 0x03, 0x0A, 0x18, 0x3C, 0x66, 0x42, 0x46, 0x7E, 0x42, 0x46,
+    0x66, 0x3C, 0x06, 0x07, 0x3C, 0x66, 0x42, 0x7E, 0x46, 0x66, 0x3C, 0x02, 0x0B, 0x02, 0x02, 0x7E,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x04, 0x09, 0x04, 0x04, 0x3C, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x03, 0x0A, 0x3E, 0x7E, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x60, 0x60, 0x60, 0x06,
+    0x07, 0x3C, 0x20, 0x60, 0x78, 0x20, 0x20, 0x20, 0x03, 0x0D, 0x3E, 0x7E, 0x60, 0x60, 0x78, 0x7E,
+    0x62, 0x62, 0x62, 0x62, 0x02, 0x0E, 0x08, 0x06, 0x0A, 0x3C, 0x20, 0x20, 0x3E, 0x22, 0x22, 0x22,
+    0x02, 0x06, 0x0C, 0x04, 0x0B, 0x5A, 0x7E, 0x3C, 0x3C, 0x3C, 0x7E, 0x5A, 0x5A, 0xDB, 0x01, 0x01,
+    0x06, 0x09, 0x5A, 0x7C, 0x3C, 0x3C, 0x5E, 0x5A, 0xDB, 0x01, 0x01, 0x04, 0x0C, 0x3C, 0x44, 0x06,
+    0x04, 0x3C, 0x06, 0x06, 0x46, 0x3C, 0x10, 0x08, 0x30, 0x06, 0x0A, 0x3C, 0x46, 0x04, 0x3C, 0x06,
+    0x46, 0x3C, 0x10, 0x08, 0x30, 0x03, 0x0C, 0x42, 0x46, 0x4C, 0x58, 0x70, 0x78, 0x48, 0x44, 0x46,
+    0x43, 0x03, 0x03, 0x06, 0x09, 0x66, 0x6C, 0x78, 0x78, 0x6C, 0x66, 0x63, 0x03, 0x03, 0x03, 0x0C,
+    0x04, 0xC4, 0xC4, 0xC4, 0xFC, 0xFC, 0xC4, 0xC4, 0xC4, 0xC7, 0x03, 0x03, 0x06, 0x09, 0x44, 0x44,
+    0x44, 0x7C, 0x44, 0x44, 0x46, 0x02, 0x02, 0x03, 0x0A, 0x06, 0x4E, 0x48, 0x48, 0x78, 0x78, 0x48,
+    0x48, 0x48, 0x48, 0x06, 0x07, 0x4F, 0x4C, 0x4C, 0x7C, 0x4C, 0x4C, 0x4C, 0x04, 0x0C, 0x1C, 0x22,
+    0x60, 0x40, 0x40, 0x40, 0x60, 0x22, 0x1C, 0x00, 0x04, 0x18, 0x06, 0x0A, 0x1C, 0x22, 0x60, 0x60,
+    0x60, 0x22, 0x1C, 0x00, 0x04, 0x1C, 0x03, 0x0C, 0x7E, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x1C, 0x0C, 0x0C, 0x06, 0x09, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x04, 0x04, 0x04,
+    0x09, 0xC2, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x06, 0x0A, 0x42, 0x46, 0x24, 0x24,
+    0x3C, 0x18, 0x18, 0x18, 0x18, 0x10, 0x03, 0x0A, 0x02, 0x42, 0x66, 0x24, 0x38, 0x18, 0x3C, 0x18,
+    0x18, 0x18, 0x06, 0x0A, 0x42, 0x46, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x3C, 0x18, 0x10, 0x03, 0x0C,
+    0x42, 0x66, 0x24, 0x3C, 0x18, 0x18, 0x3C, 0x24, 0x46, 0xC3, 0x03, 0x03, 0x06, 0x09, 0x66, 0x24,
+    0x18, 0x18, 0x3C, 0x24, 0x42, 0x02, 0x02, 0x03, 0x0A, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x42,
+    0x42, 0x42, 0x42, 0x02, 0x0B, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x66, 0x66, 0x46, 0x46, 0x46, 0x46,
+    0x04, 0x09, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x0D, 0x24, 0x18, 0x00,
+    0x00, 0xDA, 0x5E, 0x7C, 0x3C, 0x3C, 0x7E, 0x5A, 0x5A, 0xDB, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x5A,
+    0x7C, 0x3C, 0x3C, 0x5E, 0x5A, 0xDA, 0x03, 0x0D, 0x42, 0x46, 0x4C, 0x58, 0x78, 0x7C, 0x46, 0x46,
+    0x46, 0x46, 0x06, 0x0C, 0x08, 0x06, 0x0A, 0x66, 0x6C, 0x78, 0x7C, 0x62, 0x62, 0x62, 0x02, 0x06,
+    0x0C, 0x03, 0x0D, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x06, 0x0E, 0x08,
+    0x06, 0x0A, 0x46, 0x46, 0x66, 0x7E, 0x46, 0x46, 0x46, 0x06, 0x04, 0x1C, 0x03, 0x0C, 0x42, 0x42,
+    0x42, 0x42, 0x66, 0x7E, 0x02, 0x02, 0x02, 0x0E, 0x0C, 0x0C, 0x06, 0x09, 0x46, 0x46, 0x66, 0x3E,
+    0x06, 0x06, 0x0E, 0x0C, 0x08, 0x03, 0x0A, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2,
+    0x03, 0x0A, 0x24, 0x18, 0x00, 0x3C, 0x44, 0x06, 0x3E, 0x46, 0x46, 0x3E, 0x02, 0x0B, 0x2C, 0x00,
+    0x18, 0x18, 0x3C, 0x2C, 0x24, 0x66, 0x7E, 0x42, 0xC2, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x44,
+    0x06, 0x3E, 0x46, 0x46, 0x3E, 0x04, 0x09, 0x3E, 0x28, 0x28, 0x28, 0x6E, 0x48, 0x78, 0xC8, 0x8F,
+    0x06, 0x07, 0x7E, 0x1B, 0x1B, 0x7F, 0xD8, 0xD8, 0x7E, 0x00, 0x0D, 0x24, 0x18, 0x00, 0x00, 0x7E,
+    0x60, 0x60, 0x60, 0x7E, 0x60, 0x60, 0x60, 0x7E, 0x03, 0x0A, 0x24, 0x18, 0x00, 0x3C, 0x66, 0x42,
+    0x7E, 0x40, 0x62, 0x3C, 0x04, 0x09, 0x3C, 0x26, 0x06, 0x02, 0x7E, 0x42, 0x46, 0x66, 0x3C, 0x06,
+    0x07, 0x3C, 0x46, 0x02, 0x7E, 0x42, 0x66, 0x3C, 0x02, 0x0B, 0x2C, 0x00, 0x3C, 0x26, 0x06, 0x02,
+    0x7E, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x46, 0x02, 0x7E, 0x42, 0x66,
+    0x3C, 0x02, 0x0B, 0x2C, 0x00, 0xDA, 0x5E, 0x7C, 0x3C, 0x3C, 0x7E, 0x5A, 0x5A, 0xDB, 0x03, 0x0A,
+    0x2C, 0x00, 0x00, 0x5A, 0x7C, 0x3C, 0x3C, 0x5E, 0x5A, 0xDA, 0x02, 0x0B, 0x2C, 0x00, 0x3C, 0x44,
+    0x06, 0x04, 0x3C, 0x06, 0x06, 0x46, 0x3C, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x46, 0x04, 0x3C,
+    0x06, 0x46, 0x3C, 0x03, 0x0A, 0x7C, 0x7E, 0x04, 0x08, 0x18, 0x0E, 0x03, 0x83, 0xC2, 0x7E, 0x06,
+    0x0A, 0x7E, 0x04, 0x08, 0x10, 0x3C, 0x06, 0x02, 0x02, 0x4E, 0x78, 0x01, 0x0C, 0x3C, 0x00, 0x00,
+    0x46, 0x46, 0x4E, 0x4A, 0x5A, 0x52, 0x72, 0x62, 0x62, 0x03, 0x0A, 0x3C, 0x00, 0x00, 0x46, 0x46,
+    0x4E, 0x5E, 0x76, 0x66, 0x66, 0x02, 0x0B, 0x2C, 0x00, 0x46, 0x46, 0x4E, 0x4A, 0x5A, 0x52, 0x72,
+    0x62, 0x62, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x46, 0x46, 0x4E, 0x5E, 0x76, 0x66, 0x66, 0x02, 0x0B,
+    0x2C, 0x00, 0x3C, 0x66, 0x46, 0x42, 0x42, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x2C, 0x00, 0x00,
+    0x3C, 0x66, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x03, 0x0A, 0x18, 0x3C, 0x66, 0x42, 0x7E, 0x7E, 0x42,
+    0x46, 0x66, 0x3C, 0x06, 0x07, 0x3C, 0x66, 0x42, 0x7E, 0x46, 0x66, 0x3C, 0x02, 0x0B, 0x2C, 0x18,
+    0x3C, 0x66, 0x42, 0x7E, 0x7E, 0x42, 0x46, 0x66, 0x3C, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x3C, 0x66,
+    0x42, 0x7E, 0x46, 0x66, 0x3C, 0x02, 0x0B, 0x2C, 0x00, 0x78, 0x4C, 0x06, 0x06, 0x7E, 0x06, 0x06,
+    0x4C, 0x78, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x38, 0x44, 0x06, 0x3E, 0x06, 0x44, 0x38, 0x01, 0x0C,
+    0x3C, 0x00, 0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x10, 0x60, 0x03, 0x0D, 0x3C, 0x00,
+    0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x02, 0x0B, 0x2C, 0x00, 0x42,
+    0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x10, 0x60, 0x03, 0x0D, 0x2C, 0x00, 0x00, 0x42, 0x66, 0x24,
+    0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x60, 0x01, 0x0C, 0x14, 0x3C, 0x00, 0x42, 0x66, 0x24, 0x24,
+    0x3C, 0x18, 0x18, 0x10, 0x60, 0x03, 0x0D, 0x14, 0x2C, 0x00, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18,
+    0x18, 0x18, 0x10, 0x60, 0x02, 0x0B, 0x2C, 0x00, 0x42, 0x42, 0x42, 0x46, 0x3E, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x46, 0x46, 0x66, 0x3E, 0x06, 0x06, 0x06, 0x03, 0x0C, 0x3E,
+    0x7E, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0x10, 0x10, 0x06, 0x09, 0x3C, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x30, 0x10, 0x10, 0x02, 0x0B, 0x2C, 0x00, 0xC2, 0xC2, 0xC2, 0xF2, 0xDA, 0xCA,
+    0xCA, 0xDA, 0xF2, 0x03, 0x0A, 0x2C, 0x00, 0x00, 0x42, 0x42, 0x42, 0x72, 0x4A, 0x4A, 0x72, 0x09,
+    0x01, 0x3C, 0x09, 0x01, 0x3C, 0x09, 0x01, 0xFF, 0x09, 0x01, 0xFF, 0x09, 0x01, 0xFF, 0x09, 0x01,
+    0xFF, 0x02, 0x0D, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x0D, 0x03, 0xFF, 0x00, 0xFF, 0x02, 0x04, 0x08, 0x18, 0x18, 0x18, 0x02, 0x04, 0x18, 0x18, 0x18,
+    0x10, 0x0B, 0x04, 0x18, 0x18, 0x10, 0x10, 0x03, 0x04, 0x18, 0x18, 0x18, 0x08, 0x02, 0x04, 0x34,
+    0x24, 0x6C, 0x6C, 0x02, 0x04, 0x36, 0x34, 0x24, 0x6C, 0x0B, 0x04, 0x36, 0x34, 0x24, 0x6C, 0x03,
+    0x04, 0x6C, 0x6C, 0x24, 0x24, 0x04, 0x0A, 0x18, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x04, 0x0A, 0x18, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x18, 0x06, 0x04, 0x18,
+    0x3C, 0x3C, 0x18, 0x06, 0x04, 0x20, 0x38, 0x3C, 0x30, 0x0B, 0x02, 0xDA, 0xDA, 0x00, 0x00, 0x04,
+    0x09, 0x60, 0x90, 0x92, 0x7C, 0x40, 0x66, 0x99, 0x99, 0x66, 0x04, 0x09, 0xE0, 0x90, 0xA2, 0x78,
+    0x60, 0x5A, 0xAD, 0xA5, 0xFE, 0x03, 0x03, 0x08, 0x10, 0x10, 0x03, 0x03, 0x10, 0x28, 0x28, 0x03,
+    0x03, 0x28, 0x74, 0x54, 0x03, 0x03, 0x10, 0x18, 0x08, 0x03, 0x03, 0x28, 0x38, 0x14, 0x03, 0x03,
+    0x54, 0x3C, 0x2A, 0x07, 0x04, 0x18, 0x30, 0x30, 0x18, 0x07, 0x04, 0x10, 0x08, 0x08, 0x10, 0x04,
+    0x09, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x00, 0x66, 0x66, 0x03, 0x0A, 0x18, 0x7C, 0x16, 0x1C,
+    0x1C, 0x18, 0x10, 0x00, 0x10, 0x10, 0x03, 0x01, 0xFF, 0x0E, 0x02, 0x81, 0x7E, 0x03, 0x0C, 0x1C,
+    0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x03, 0x0C, 0x38, 0x08, 0x08,
+    0x08, 0x08, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08, 0x38, 0x03, 0x0A, 0x66, 0xFE, 0x33, 0x32, 0x26,
+    0x64, 0x44, 0x04, 0x44, 0x44, 0x03, 0x0A, 0x60, 0xF6, 0x36, 0x36, 0x26, 0x66, 0x44, 0x00, 0x46,
+    0x46, 0x03, 0x0A, 0x06, 0x6E, 0x63, 0x62, 0x66, 0x64, 0x64, 0x04, 0x64, 0x64, 0x03, 0x0B, 0x30,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5C, 0x50, 0x50, 0x50, 0x50, 0x50, 0x03, 0x0A, 0x20, 0x50, 0x80, 0x8F,
+    0x88, 0x88, 0xCE, 0x78, 0x08, 0x0F, 0x03, 0x0A, 0x1E, 0x3E, 0x6C, 0x54, 0x54, 0x54, 0x58, 0x68,
+    0x2A, 0x3E, 0x03, 0x0A, 0x1C, 0x3E, 0x60, 0x42, 0x4E, 0x48, 0x48, 0x48, 0x6A, 0x3E, 0x03, 0x0A,
+    0x3E, 0x7E, 0x60, 0x60, 0x7C, 0x7C, 0x60, 0x60, 0x60, 0x60, 0x03, 0x0A, 0x0C, 0x1A, 0x30, 0x30,
+    0x7C, 0x30, 0x7C, 0x30, 0x30, 0x7E, 0x05, 0x09, 0x08, 0x7E, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x7A,
+    0x20, 0x03, 0x0A, 0x40, 0x66, 0x76, 0x76, 0xFF, 0x7E, 0xFE, 0x4E, 0x4E, 0x46, 0x03, 0x0A, 0xC0,
+    0xF0, 0xB0, 0xBF, 0xB4, 0xF4, 0x92, 0x91, 0x91, 0x8E, 0x03, 0x0A, 0xC0, 0xF0, 0x90, 0x97, 0x98,
+    0xEC, 0x96, 0x91, 0x99, 0x8E, 0x03, 0x0A, 0x80, 0xDB, 0xFF, 0xFF, 0xFA, 0x5A, 0x6E, 0x66, 0x66,
+    0x66, 0x03, 0x0A, 0x60, 0xF9, 0x89, 0x8D, 0xA5, 0xA5, 0xA1, 0xA1, 0x91, 0x9F, 0x02, 0x0D, 0x06,
+    0x06, 0x1F, 0x06, 0x3E, 0x66, 0x46, 0x46, 0x46, 0x66, 0x3E, 0x00, 0x1E, 0x04, 0x09, 0x1C, 0x32,
+    0x60, 0xFC, 0x60, 0xF8, 0x60, 0x32, 0x1C, 0x03, 0x0A, 0x02, 0x44, 0x4C, 0x58, 0x70, 0x70, 0x58,
+    0x4C, 0x44, 0x42, 0x03, 0x0A, 0x7E, 0x7E, 0x18, 0x1C, 0x18, 0x3C, 0x18, 0x38, 0x18, 0x18, 0x03,
+    0x0D, 0x20, 0x70, 0x28, 0x28, 0x28, 0x0A, 0x0B, 0x4D, 0xCD, 0xF6, 0x04, 0x04, 0x04, 0x03, 0x0A,
+    0x0C, 0x1E, 0x12, 0x1A, 0x0E, 0x7E, 0x1A, 0x02, 0x02, 0x0E, 0x03, 0x0A, 0x38, 0x7E, 0x7F, 0x62,
+    0x66, 0x7C, 0x60, 0x60, 0x60, 0x60, 0x03, 0x0B, 0x1C, 0x3E, 0x48, 0xC8, 0xC8, 0xCE, 0xCA, 0x4A,
+    0x6A, 0x3E, 0x08, 0x04, 0x09, 0x18, 0x18, 0x3C, 0x7E, 0x24, 0x7E, 0x42, 0x42, 0xC2, 0x03, 0x0A,
+    0x38, 0x7C, 0x02, 0x02, 0xFF, 0x7C, 0xFE, 0x40, 0x62, 0x3E, 0x03, 0x0C, 0x08, 0x08, 0x3E, 0x68,
+    0x48, 0x48, 0x48, 0x68, 0x2A, 0x3E, 0x08, 0x08, 0x03, 0x0A, 0x7E, 0x7E, 0xFE, 0x7E, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x03, 0x0A, 0x7E, 0x18, 0x1C, 0x0C, 0x18, 0x70, 0x18, 0x08, 0x0C, 0x04,
+    0x03, 0x0A, 0x20, 0x20, 0x38, 0x30, 0x78, 0x32, 0x62, 0x22, 0x26, 0x3C, 0x03, 0x0A, 0x30, 0x3E,
+    0x22, 0x22, 0x26, 0x7C, 0x20, 0x7C, 0x30, 0x20, 0x03, 0x0A, 0x1C, 0x20, 0x60, 0x40, 0x40, 0x40,
+    0x40, 0x60, 0x20, 0x1E, 0x03, 0x0A, 0x04, 0xE4, 0x84, 0x88, 0x8A, 0xFF, 0x11, 0x11, 0x25, 0x26,
+    0x03, 0x0A, 0x42, 0xA5, 0xA5, 0xA5, 0xBD, 0xA5, 0xA5, 0xA5, 0xA5, 0xE7, 0x03, 0x0A, 0x30, 0x20,
+    0x20, 0x3E, 0x22, 0x62, 0x46, 0x46, 0x44, 0x44, 0x03, 0x0A, 0x30, 0x38, 0x60, 0x3E, 0x22, 0x62,
+    0x46, 0x46, 0x44, 0x44, 0x03, 0x0A, 0x40, 0xE0, 0xD0, 0x90, 0xA8, 0x90, 0x94, 0x8A, 0x8A, 0x86,
+    0x03, 0x0A, 0x40, 0x6C, 0x68, 0x68, 0x68, 0x7A, 0x5F, 0x5B, 0x58, 0xDF, 0x04, 0x08, 0x18, 0x46,
+    0x9E, 0x85, 0x9D, 0x81, 0x42, 0x3C, 0x03, 0x0A, 0x78, 0xA6, 0xA4, 0xA4, 0xA6, 0xBC, 0xA0, 0xA0,
+    0xA0, 0xE0, 0x03, 0x0C, 0x18, 0x66, 0x66, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0x66, 0x3C, 0x04, 0x06,
+    0x03, 0x0A, 0x70, 0xAC, 0x8A, 0x8A, 0x88, 0xBC, 0x84, 0x8A, 0x82, 0xC7, 0x04, 0x04, 0xFA, 0x5E,
+    0x56, 0x52, 0x03, 0x0A, 0x7E, 0x0A, 0x0A, 0x14, 0x14, 0x28, 0x28, 0x50, 0x40, 0xFE, 0x04, 0x09,
+    0x3C, 0x66, 0x42, 0x42, 0x42, 0x42, 0x42, 0x24, 0xEE, 0x04, 0x09, 0x42, 0x44, 0x48, 0x70, 0x78,
+    0x48, 0x4C, 0x46, 0x42, 0x01, 0x0C, 0x18, 0x24, 0x24, 0x18, 0x18, 0x3C, 0x24, 0x24, 0x66, 0x7E,
+    0x42, 0xC3, 0x06, 0x06, 0x42, 0xC3, 0xC3, 0xC0, 0xC0, 0x40, 0x03, 0x0A, 0x08, 0x08, 0x00, 0x38,
+    0x18, 0x18, 0x08, 0x28, 0x20, 0xFC, 0x08, 0x03, 0x40, 0xFE, 0x40, 0x06, 0x07, 0x18, 0x3C, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x08, 0x03, 0x06, 0xFE, 0x06, 0x06, 0x07, 0x10, 0x18, 0x18, 0x18, 0x18,
+    0x3C, 0x18, 0x08, 0x03, 0x46, 0xFE, 0x46, 0x06, 0x07, 0x18, 0x3C, 0x18, 0x18, 0x18, 0x3C, 0x18,
+    0x07, 0x06, 0x30, 0x60, 0x70, 0x18, 0x0C, 0x04, 0x07, 0x06, 0x0C, 0x0E, 0x0E, 0x10, 0x20, 0x40,
+    0x08, 0x05, 0x60, 0x30, 0x1A, 0x0E, 0x0E, 0x08, 0x05, 0x04, 0x08, 0x50, 0x60, 0x70, 0x08, 0x03,
+    0x44, 0xFE, 0x48, 0x07, 0x04, 0x10, 0x16, 0xFE, 0x66, 0x07, 0x03, 0x60, 0xCE, 0xF8, 0x07, 0x03,
+    0x06, 0x76, 0x1E, 0x08, 0x03, 0x58, 0xFE, 0x58, 0x06, 0x07, 0x18, 0x3C, 0x18, 0x3C, 0x18, 0x18,
+    0x18, 0x08, 0x03, 0x1E, 0xFE, 0x1E, 0x06, 0x07, 0x10, 0x18, 0x18, 0x3C, 0x18, 0x3C, 0x18, 0x08,
+    0x03, 0x42, 0xFC, 0x42, 0x08, 0x03, 0x46, 0x3E, 0x46, 0x08, 0x03, 0x42, 0xFE, 0x42, 0x06, 0x07,
+    0x18, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x08, 0x03, 0xC6, 0xFE, 0xC6, 0x06, 0x07, 0x3C, 0x18,
+    0x18, 0x18, 0x18, 0x3C, 0x18, 0x06, 0x07, 0x18, 0x3C, 0x18, 0x18, 0x3C, 0x18, 0x3C, 0x07, 0x04,
+    0x02, 0x42, 0xFE, 0x40, 0x06, 0x05, 0x40, 0x40, 0xC6, 0x7E, 0x06, 0x06, 0x05, 0x04, 0x0A, 0x4A,
+    0xFE, 0x48, 0x06, 0x05, 0x60, 0x70, 0xD6, 0x7E, 0x16, 0x08, 0x03, 0x56, 0xFE, 0x66, 0x07, 0x05,
+    0x08, 0x5E, 0xFE, 0x56, 0x10, 0x04, 0x09, 0x20, 0x66, 0x4C, 0x74, 0x64, 0x04, 0x14, 0x1E, 0x0C,
+    0x05, 0x08, 0x20, 0x7E, 0x22, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x08, 0x04, 0x7E, 0x44, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x04, 0x09, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x7E, 0x60, 0x20, 0x04,
+    0x09, 0x40, 0x40, 0x40, 0x40, 0x40, 0x4C, 0x7E, 0x0C, 0x08, 0x06, 0x07, 0x78, 0x08, 0x08, 0x08,
+    0x08, 0x1C, 0x08, 0x08, 0x05, 0x02, 0x62, 0x7E, 0x60, 0x20, 0x07, 0x04, 0x1E, 0x22, 0x70, 0x20,
+    0x07, 0x04, 0x78, 0x4C, 0x0E, 0x04, 0x06, 0x07, 0x7E, 0x30, 0x60, 0x70, 0x18, 0x0C, 0x04, 0x05,
+    0x08, 0x90, 0xF0, 0xFE, 0xF0, 0x0A, 0x7E, 0x0E, 0x0A, 0x06, 0x07, 0x06, 0x0C, 0x4E, 0x42, 0x42,
+    0x64, 0x38, 0x06, 0x07, 0x60, 0x70, 0x72, 0x42, 0x42, 0x66, 0x3C, 0x08, 0x02, 0x40, 0xFE, 0x09,
+    0x02, 0xFE, 0x40, 0x06, 0x07, 0x18, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x06, 0x07, 0x10, 0x38,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x02, 0x06, 0xFE, 0x09, 0x02, 0xFE, 0x06, 0x06, 0x07, 0x10,
+    0x18, 0x18, 0x18, 0x18, 0x1C, 0x18, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x18, 0x06,
+    0x07, 0x04, 0x7E, 0x06, 0x64, 0x7E, 0x60, 0x20, 0x06, 0x07, 0x24, 0x74, 0x24, 0x24, 0x24, 0x2E,
+    0x24, 0x06, 0x07, 0x60, 0x7E, 0x60, 0x24, 0x7E, 0x06, 0x04, 0x06, 0x07, 0x60, 0x7E, 0x60, 0x60,
+    0x7E, 0x60, 0x20, 0x06, 0x07, 0x24, 0x7E, 0x24, 0x24, 0x24, 0x24, 0x24, 0x06, 0x07, 0x04, 0x7E,
+    0x06, 0x04, 0x7E, 0x06, 0x04, 0x06, 0x07, 0x24, 0x24, 0x24, 0x24, 0x24, 0x7E, 0x24, 0x07, 0x05,
+    0x40, 0xFE, 0x00, 0xFE, 0x06, 0x06, 0x06, 0x04, 0x06, 0xFE, 0x00, 0xFE, 0x40, 0x08, 0x03, 0x7E,
+    0xC8, 0x7E, 0x07, 0x04, 0x08, 0x7E, 0xD2, 0x7E, 0x08, 0x03, 0x7E, 0x12, 0x7E, 0x08, 0x03, 0x7E,
+    0xC0, 0x7E, 0x06, 0x07, 0x18, 0x3C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x7E, 0x02, 0x7E,
+    0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3C, 0x18, 0x08, 0x03, 0x7E, 0xC2, 0x7E, 0x06, 0x07,
+    0x18, 0x3C, 0x08, 0x08, 0x08, 0x3C, 0x18, 0x07, 0x06, 0x30, 0x50, 0x40, 0x20, 0x10, 0x08, 0x07,
+    0x05, 0x0C, 0x0A, 0x12, 0x20, 0x40, 0x07, 0x06, 0x20, 0x10, 0x28, 0x16, 0x0A, 0x0E, 0x08, 0x05,
+    0x08, 0x14, 0x68, 0x50, 0x70, 0x08, 0x03, 0x60, 0xFE, 0x7E, 0x08, 0x03, 0x06, 0x7E, 0x7E, 0x08,
+    0x03, 0x40, 0xFE, 0x60, 0x08, 0x03, 0x06, 0xFE, 0x06, 0x06, 0x07, 0x18, 0x3C, 0x18, 0x3C, 0x18,
+    0x3C, 0x18, 0x06, 0x07, 0x10, 0x3C, 0x18, 0x3C, 0x18, 0x3C, 0x18, 0x08, 0x03, 0x40, 0xEA, 0x40,
+    0x06, 0x07, 0x18, 0x3C, 0x18, 0x00, 0x18, 0x00, 0x18, 0x08, 0x03, 0x06, 0xFE, 0x06, 0x06, 0x07,
+    0x10, 0x00, 0x18, 0x00, 0x18, 0x3C, 0x18, 0x08, 0x03, 0xE0, 0xFE, 0xE0, 0x08, 0x03, 0x0E, 0xFE,
+    0x0E, 0x08, 0x03, 0x7E, 0x80, 0x7E, 0x06, 0x07, 0x18, 0x24, 0x08, 0x08, 0x08, 0x08, 0x18, 0x08,
+    0x03, 0x7E, 0x80, 0x7E, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x28, 0x20, 0x10, 0x06, 0x07, 0x18,
+    0x24, 0x08, 0x08, 0x00, 0x18, 0x18, 0x06, 0x07, 0x18, 0x24, 0x08, 0x08, 0x08, 0x24, 0x7C, 0x06,
+    0x07, 0x18, 0x24, 0x08, 0x08, 0x08, 0x24, 0x7C, 0x06, 0x07, 0x18, 0x34, 0x18, 0x18, 0x18, 0x3C,
+    0x7C, 0x06, 0x07, 0x18, 0x3C, 0x24, 0x28, 0x08, 0x08, 0x18, 0x06, 0x07, 0x18, 0x3C, 0x24, 0x28,
+    0x08, 0x24, 0x7C, 0x07, 0x05, 0xC0, 0xBE, 0x80, 0xBE, 0x40, 0x06, 0x07, 0xFE, 0xB0, 0xB0, 0xB8,
+    0x8C, 0x86, 0x82, 0x06, 0x07, 0x40, 0x60, 0x30, 0x1C, 0x0C, 0x1C, 0x7E, 0x06, 0x07, 0x18, 0x24,
+    0x08, 0x08, 0x28, 0x20, 0x10, 0x08, 0x03, 0x76, 0xFE, 0x76, 0x06, 0x07, 0x24, 0x2E, 0x24, 0x24,
+    0x24, 0x74, 0x24, 0x04, 0x0A, 0x04, 0x06, 0xFE, 0x06, 0x06, 0xFE, 0x06, 0x06, 0xFE, 0x06, 0x07,
+    0x05, 0x08, 0x48, 0xFE, 0x48, 0x08, 0x07, 0x05, 0x10, 0x16, 0xFE, 0x16, 0x10, 0x08, 0x03, 0x5E,
+    0xFE, 0x5E, 0x07, 0x05, 0x04, 0x5C, 0xFE, 0x5C, 0x04, 0x07, 0x04, 0x20, 0x7E, 0xFE, 0x3E, 0x07,
+    0x05, 0x38, 0x7E, 0xFE, 0x7E, 0x08, 0x08, 0x03, 0x60, 0xBE, 0x60, 0x08, 0x03, 0x06, 0xFC, 0x06,
+    0x08, 0x03, 0x66, 0xBC, 0x66, 0x04, 0x09, 0xC2, 0x42, 0x7E, 0x64, 0x24, 0x24, 0x3C, 0x18, 0x18,
+    0x03, 0x0A, 0x18, 0x3C, 0x66, 0x40, 0x40, 0x40, 0x40, 0x42, 0x66, 0x3C, 0x04, 0x09, 0x18, 0x0C,
+    0x06, 0x06, 0x3E, 0x66, 0x44, 0x4C, 0x38, 0x03, 0x0A, 0x3C, 0x7E, 0x06, 0x06, 0x06, 0x7E, 0x06,
+    0x06, 0x06, 0x7E, 0x03, 0x0A, 0x3C, 0x7E, 0x0E, 0x1E, 0x1E, 0x7E, 0x16, 0x26, 0x26, 0x7E, 0x06,
+    0x06, 0x3E, 0x46, 0x4A, 0x52, 0x62, 0x7C, 0x04, 0x09, 0x18, 0x18, 0x3C, 0x24, 0x24, 0x66, 0x42,
+    0xC2, 0xFF, 0x04, 0x09, 0xFF, 0xC2, 0x42, 0x46, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x04, 0x09, 0x3E,
+    0x60, 0x40, 0x40, 0x7E, 0x40, 0x40, 0x20, 0x1E, 0x03, 0x0B, 0x06, 0x3E, 0x6C, 0x48, 0x48, 0x7E,
+    0x58, 0x50, 0x30, 0x3E, 0x20, 0x07, 0x05, 0x3E, 0x60, 0x7E, 0x60, 0x3E, 0x04, 0x09, 0x7C, 0x04,
+    0x02, 0x02, 0x7E, 0x02, 0x06, 0x04, 0x78, 0x03, 0x0B, 0x0C, 0x7C, 0x0C, 0x0A, 0x1A, 0x7E, 0x12,
+    0x36, 0x24, 0x78, 0x60, 0x06, 0x06, 0x7C, 0x06, 0x7E, 0x7E, 0x06, 0x7C, 0x05, 0x08, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x03, 0x0D, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x03, 0x0D, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x7E, 0x03, 0x0D, 0x7E, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x10, 0x30,
+    0x20, 0x40, 0x7E, 0x08, 0x01, 0xFE, 0x05, 0x08, 0x7E, 0x7E, 0x00, 0x18, 0x18, 0x7E, 0x18, 0x18,
+    0x04, 0x0B, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x10, 0x10, 0x30, 0x20, 0x60, 0x40, 0x07, 0x06, 0x10,
+    0x52, 0x38, 0x38, 0x52, 0x10, 0x08, 0x04, 0x18, 0x24, 0x24, 0x18, 0x06, 0x04, 0x18, 0x3C, 0x3C,
+    0x18, 0x02, 0x0B, 0x02, 0x02, 0x02, 0x04, 0x04, 0x44, 0x24, 0x28, 0x28, 0x18, 0x10, 0x02, 0x0B,
+    0x72, 0x1A, 0x32, 0x0C, 0x74, 0x44, 0x24, 0x28, 0x28, 0x18, 0x10, 0x02, 0x0B, 0x12, 0x32, 0x52,
+    0x7C, 0x14, 0x44, 0x24, 0x28, 0x28, 0x18, 0x10, 0x07, 0x04, 0x3C, 0x4C, 0x4C, 0x3C, 0x07, 0x05,
+    0x66, 0x9A, 0x99, 0x9A, 0x66, 0x05, 0x06, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7E, 0x05, 0x06, 0x06,
+    0x0C, 0x08, 0x10, 0x20, 0x7E, 0x02, 0x0D, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x05, 0x08, 0x10, 0x18, 0x18, 0x3C, 0x24, 0x24, 0x64, 0x46, 0x05, 0x08,
+    0x40, 0x66, 0x24, 0x24, 0x2C, 0x38, 0x18, 0x18, 0x05, 0x08, 0x18, 0x3C, 0x46, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x05, 0x08, 0x40, 0x42, 0x42, 0x42, 0x42, 0x42, 0x66, 0x3C, 0x02, 0x0D, 0x0E, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x02, 0x0D, 0x36, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6C, 0x02, 0x0D, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x5E, 0x7C, 0x06, 0x07, 0x18, 0x18, 0x00, 0x00, 0x00,
+    0x66, 0x66, 0x06, 0x07, 0x66, 0x66, 0x00, 0x00, 0x00, 0x18, 0x18, 0x06, 0x07, 0x18, 0x18, 0x00,
+    0x00, 0x00, 0x18, 0x18, 0x06, 0x07, 0x66, 0x66, 0x00, 0x00, 0x00, 0x66, 0x66, 0x06, 0x03, 0x18,
+    0x18, 0xFE, 0x06, 0x06, 0x02, 0x02, 0x78, 0x78, 0x02, 0x02, 0x06, 0x07, 0xC2, 0xC2, 0xFE, 0x00,
+    0x00, 0xC2, 0xC2, 0x06, 0x07, 0x18, 0x18, 0x72, 0x0E, 0x00, 0x18, 0x18, 0x08, 0x02, 0x72, 0x0E,
+    0x08, 0x02, 0x1E, 0x70, 0x06, 0x06, 0x08, 0x08, 0x7A, 0x1E, 0x10, 0x10, 0x07, 0x04, 0x7E, 0x00,
+    0x70, 0x5E, 0x07, 0x04, 0x7A, 0x0C, 0x00, 0x7E, 0x05, 0x07, 0x04, 0x04, 0x7E, 0x1E, 0x10, 0x7E,
+    0x20, 0x06, 0x06, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x7E, 0x06, 0x07, 0x7E, 0x04, 0x7E, 0x7E, 0x18,
+    0x7E, 0x20, 0x05, 0x08, 0x0C, 0x7E, 0x08, 0x7E, 0x7E, 0x30, 0x7E, 0x20, 0x07, 0x04, 0x70, 0x0E,
+    0x70, 0x0E, 0x06, 0x06, 0x08, 0x7A, 0x1C, 0x70, 0x5E, 0x10, 0x06, 0x06, 0x7E, 0x00, 0x7A, 0x0E,
+    0x00, 0x7E, 0x06, 0x06, 0x7E, 0x00, 0x7A, 0x0E, 0x70, 0x5E, 0x06, 0x06, 0x7E, 0x00, 0x7E, 0x7E,
+    0x00, 0x7E, 0x07, 0x04, 0x7E, 0x00, 0x10, 0x7E, 0x05, 0x08, 0x18, 0x3C, 0x66, 0x00, 0x00, 0x66,
+    0x3C, 0x10, 0x05, 0x06, 0x18, 0x3C, 0x66, 0x00, 0x00, 0x7E, 0x05, 0x06, 0x18, 0x18, 0xFE, 0x00,
+    0x00, 0xFE, 0x05, 0x09, 0x18, 0x18, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x18, 0x05, 0x09, 0xC0,
+    0xC0, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x02, 0x05, 0x09, 0x02, 0x02, 0xFE, 0x00, 0x00, 0xFE,
+    0x00, 0xC0, 0xC0, 0x07, 0x04, 0xFE, 0x40, 0x40, 0xDE, 0x07, 0x04, 0xFE, 0x02, 0x02, 0x7A, 0x07,
+    0x04, 0x7E, 0x2C, 0x3C, 0x7E, 0x03, 0x08, 0x18, 0x24, 0x24, 0x18, 0x7E, 0x00, 0x00, 0x7E, 0x04,
+    0x07, 0x18, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0x08, 0x18, 0x18, 0x2C, 0x24, 0x7E, 0x00,
+    0x00, 0x7E, 0x03, 0x08, 0x24, 0x18, 0x18, 0x10, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0x08, 0x18, 0x18,
+    0x18, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x02, 0x09, 0x10, 0x18, 0x08, 0x2C, 0x00, 0x7E, 0x00, 0x00,
+    0x7E, 0x04, 0x07, 0x22, 0xB0, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x03, 0x08, 0x74, 0x40, 0x40, 0x00,
+    0x7E, 0x00, 0x00, 0x7E, 0x02, 0x09, 0x18, 0x08, 0x10, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x05,
+    0x08, 0x02, 0x04, 0xFE, 0x18, 0x10, 0xFE, 0x60, 0x40, 0x06, 0x06, 0x7E, 0x00, 0x7E, 0x7E, 0x00,
+    0x7E, 0x05, 0x08, 0x04, 0x7E, 0x08, 0x7E, 0x7E, 0x30, 0x7E, 0x20, 0x05, 0x08, 0xFE, 0x00, 0x7E,
+    0x00, 0x00, 0x7E, 0x00, 0xFE, 0x06, 0x07, 0x06, 0x3C, 0xE0, 0x3C, 0x06, 0x00, 0xFE, 0x06, 0x07,
+    0x40, 0x3C, 0x06, 0x3C, 0x40, 0x00, 0xFE, 0x06, 0x08, 0x0E, 0x78, 0x70, 0x1E, 0x02, 0x7E, 0x00,
+    0xFE, 0x06, 0x08, 0x70, 0x1E, 0x0E, 0x78, 0x40, 0x7E, 0x00, 0xFE, 0x06, 0x09, 0x0E, 0x78, 0x70,
+    0x1E, 0x06, 0x7E, 0x18, 0xFE, 0x20, 0x06, 0x09, 0x70, 0x1E, 0x0E, 0x78, 0x44, 0x7E, 0x18, 0xFE,
+    0x20, 0x05, 0x08, 0x04, 0x0E, 0x7E, 0x18, 0x18, 0x7E, 0x20, 0x20, 0x05, 0x08, 0x04, 0x0E, 0x1C,
+    0x78, 0x78, 0x1C, 0x12, 0x30, 0x05, 0x08, 0x08, 0x68, 0x38, 0x1E, 0x1E, 0x38, 0x70, 0x20, 0x05,
+    0x09, 0x04, 0x0E, 0x1E, 0x78, 0x78, 0x1E, 0x10, 0xFE, 0x20, 0x05, 0x09, 0x08, 0x48, 0x78, 0x1E,
+    0x1E, 0x70, 0x20, 0xFE, 0x60, 0x06, 0x07, 0x02, 0x1E, 0x60, 0x78, 0x0E, 0x20, 0x7E, 0x06, 0x07,
+    0x40, 0x78, 0x06, 0x1E, 0x70, 0x20, 0x7E, 0x05, 0x09, 0x04, 0x0E, 0x1E, 0x78, 0x78, 0x1E, 0x30,
+    0x7E, 0x20, 0x05, 0x09, 0x08, 0x48, 0x78, 0x1E, 0x1E, 0x70, 0x30, 0x7E, 0x60, 0x05, 0x09, 0x02,
+    0x1E, 0x60, 0x78, 0xFE, 0x3E, 0x06, 0x3C, 0xE0, 0x05, 0x09, 0x40, 0x78, 0x0E, 0x1E, 0x7E, 0x7C,
+    0xE0, 0x3C, 0x06, 0x04, 0x0B, 0x04, 0x06, 0x1E, 0x78, 0x78, 0xFE, 0x3E, 0x16, 0x3C, 0xE0, 0x20,
+    0x04, 0x0B, 0x04, 0x44, 0x7C, 0x0E, 0x1E, 0x7E, 0x7C, 0xF0, 0x3C, 0x26, 0x20, 0x05, 0x08, 0x02,
+    0x06, 0x1C, 0x70, 0x70, 0x0C, 0x06, 0x02, 0x05, 0x07, 0x80, 0x60, 0x38, 0x0E, 0x0E, 0x30, 0x60,
+    0x04, 0x0A, 0x02, 0x06, 0x1C, 0x70, 0x78, 0x0E, 0x72, 0x1C, 0x06, 0x02, 0x04, 0x0A, 0x80, 0x60,
+    0x38, 0x0E, 0x1C, 0x70, 0xCE, 0x38, 0x60, 0xC0, 0x04, 0x0A, 0x02, 0x06, 0x1C, 0x70, 0x78, 0x0E,
+    0x02, 0x00, 0x7A, 0x0C, 0x04, 0x0A, 0x80, 0x60, 0x38, 0x0E, 0x1C, 0x70, 0xC0, 0x00, 0x7A, 0x0C,
+    0x04, 0x0A, 0x04, 0x06, 0x0E, 0x1C, 0x78, 0x78, 0x1C, 0x16, 0x32, 0x20, 0x04, 0x0A, 0x0C, 0x88,
+    0x68, 0x38, 0x1E, 0x1E, 0x30, 0x60, 0x20, 0x20, 0x06, 0x06, 0x3E, 0x40, 0x40, 0x40, 0x40, 0x3E,
+    0x06, 0x06, 0x7C, 0x02, 0x02, 0x02, 0x06, 0x7C, 0x05, 0x08, 0x0C, 0x3E, 0x48, 0x58, 0x50, 0x70,
+    0x3E, 0x20, 0x05, 0x08, 0x0C, 0x7C, 0x0A, 0x1A, 0x12, 0x16, 0x7C, 0x20, 0x05, 0x08, 0x3E, 0x40,
+    0x40, 0x40, 0x40, 0x3E, 0x00, 0xFE, 0x05, 0x08, 0x7C, 0x02, 0x02, 0x02, 0x06, 0x7C, 0x00, 0xFE,
+    0x04, 0x0A, 0x04, 0x3E, 0x48, 0x48, 0x58, 0x50, 0x3E, 0x30, 0xFE, 0x20, 0x04, 0x0A, 0x04, 0x7C,
+    0x0E, 0x0A, 0x1A, 0x16, 0x7C, 0x30, 0xFE, 0x20, 0x05, 0x09, 0x3E, 0x40, 0x40, 0x40, 0x40, 0x3E,
+    0x08, 0xFE, 0x30, 0x05, 0x09, 0x7C, 0x02, 0x02, 0x02, 0x06, 0x7C, 0x08, 0xFE, 0x30, 0x05, 0x08,
+    0x42, 0x42, 0x42, 0x42, 0x5A, 0x42, 0x46, 0x3C, 0x05, 0x08, 0x42, 0x42, 0x42, 0x42, 0x5A, 0x42,
+    0x46, 0x3C, 0x06, 0x06, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0x06, 0x06, 0xFE, 0x02, 0x02, 0x02,
+    0x02, 0xFE, 0x05, 0x08, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0x00, 0xFE, 0x05, 0x08, 0xFE, 0x02,
+    0x02, 0x02, 0x02, 0xFE, 0x00, 0xFE, 0x05, 0x08, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x05, 0x08, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x06, 0x06, 0x3C, 0x52, 0x7E, 0x5A,
+    0x52, 0x3C, 0x06, 0x06, 0x3C, 0x42, 0x7E, 0x42, 0x42, 0x3C, 0x06, 0x06, 0x3C, 0x66, 0x5A, 0x5A,
+    0x66, 0x3C, 0x06, 0x06, 0x3C, 0x46, 0x4A, 0x52, 0x62, 0x3C, 0x06, 0x06, 0x3C, 0x42, 0x5A, 0x5A,
+    0x42, 0x3C, 0x06, 0x06, 0x3C, 0x5A, 0x6E, 0x7E, 0x5A, 0x3C, 0x06, 0x06, 0x3C, 0x56, 0x7A, 0x7E,
+    0x56, 0x3C, 0x06, 0x06, 0x3C, 0x42, 0x7E, 0x7E, 0x42, 0x3C, 0x06, 0x06, 0x3C, 0x42, 0x5A, 0x42,
+    0x42, 0x3C, 0x05, 0x07, 0x7E, 0xDA, 0x92, 0xFE, 0xDA, 0x92, 0xFE, 0x05, 0x07, 0x7E, 0xC2, 0x82,
+    0xFE, 0xC2, 0x82, 0xFE, 0x05, 0x07, 0x7E, 0xE6, 0xE6, 0x9A, 0x9A, 0xE6, 0xFE, 0x05, 0x07, 0x7E,
+    0xC2, 0x82, 0x9A, 0x9A, 0x82, 0xFE, 0x05, 0x08, 0xC0, 0xC0, 0xC0, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0,
+    0x05, 0x08, 0x02, 0x02, 0x02, 0x7E, 0x7E, 0x02, 0x02, 0x02, 0x05, 0x08, 0x7E, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x05, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFE, 0x06, 0x06,
+    0x06, 0x1E, 0x62, 0x72, 0x1E, 0x02, 0x06, 0x06, 0xE0, 0xF8, 0xC6, 0xCE, 0xF8, 0x40, 0x06, 0x07,
+    0x02, 0x1E, 0x62, 0x7A, 0x0E, 0x00, 0xFE, 0x06, 0x07, 0x40, 0xF8, 0xC6, 0xDE, 0xF0, 0x00, 0xFE,
+    0x07, 0x04, 0x06, 0xFB, 0x7B, 0x06, 0x03, 0x0D, 0x3C, 0x66, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x03, 0x0D, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x66, 0x3C, 0x06, 0x06, 0x18, 0x3C, 0x66, 0x66, 0x3C, 0x18, 0x08, 0x02, 0x18, 0x18,
+    0x07, 0x03, 0x18, 0x18, 0x18, 0x07, 0x04, 0x5E, 0x70, 0x00, 0x7E, 0x05, 0x08, 0x42, 0x64, 0x3C,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x64, 0xC2, 0x05,
+    0x08, 0x3E, 0x60, 0x5E, 0x50, 0x50, 0x4E, 0x60, 0x1E, 0x05, 0x08, 0x78, 0x04, 0x72, 0x0A, 0x0A,
+    0x72, 0x04, 0x78, 0x03, 0x0D, 0x02, 0x1E, 0x60, 0x78, 0x0E, 0x00, 0xFE, 0x00, 0x70, 0x1E, 0x0E,
+    0x78, 0x40, 0x03, 0x0D, 0x40, 0x78, 0x06, 0x1E, 0x70, 0x00, 0xFE, 0x00, 0x0E, 0x78, 0x60, 0x1E,
+    0x02, 0x06, 0x07, 0x7E, 0x00, 0x06, 0x78, 0xE0, 0x3C, 0x06, 0x06, 0x07, 0x7E, 0x00, 0x60, 0x3C,
+    0x06, 0x7C, 0x40, 0x04, 0x0A, 0x02, 0x06, 0x0C, 0x7A, 0x66, 0x1C, 0x70, 0x38, 0x0E, 0x02, 0x05,
+    0x09, 0x60, 0x30, 0x9E, 0x66, 0x38, 0x0E, 0x1C, 0x60, 0xC0, 0x03, 0x0C, 0x04, 0x06, 0x06, 0x1C,
+    0x78, 0x78, 0x1E, 0x72, 0x1C, 0x36, 0x22, 0x20, 0x03, 0x0C, 0x04, 0x84, 0x6C, 0x38, 0x1E, 0x1C,
+    0x70, 0xDE, 0x38, 0x60, 0xE0, 0x60, 0x04, 0x0A, 0x04, 0x0C, 0xFE, 0xC8, 0xD8, 0xD0, 0xD0, 0xFE,
+    0x20, 0x20, 0x04, 0x0A, 0x04, 0x0C, 0x7E, 0x0A, 0x1A, 0x12, 0x12, 0x7E, 0x20, 0x20, 0x05, 0x09,
+    0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0x0C, 0x7E, 0x30, 0x05, 0x09, 0xFE, 0x02, 0x02, 0x02, 0x02,
+    0xFE, 0x0C, 0x7E, 0x30, 0x06, 0x09, 0x02, 0x1E, 0x60, 0x78, 0x0E, 0x38, 0x7E, 0x10, 0x10, 0x06,
+    0x09, 0x40, 0x78, 0x06, 0x1E, 0x78, 0x38, 0x7E, 0x10, 0x10, 0x04, 0x0C, 0x02, 0x06, 0x1C, 0x70,
+    0x78, 0x0E, 0x0A, 0x08, 0x7A, 0x1C, 0x10, 0x10, 0x04, 0x0C, 0x80, 0x60, 0x38, 0x0E, 0x1C, 0x70,
+    0xC8, 0x08, 0x7A, 0x1C, 0x10, 0x10, 0x08, 0x02, 0xDA, 0xDA, 0x08, 0x01, 0xFF, 0x07, 0x03, 0xFF,
+    0xFF, 0xFF, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x08, 0x01, 0xDB, 0x07, 0x03, 0x5A, 0xDB, 0x5A, 0x02, 0x0D, 0x10, 0x10,
+    0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x18, 0x18, 0x18,
+    0x18, 0x00, 0x10, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x08, 0x01, 0xFF, 0x08,
+    0x02, 0xFF, 0x0A, 0x02, 0x0D, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00,
+    0x10, 0x10, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00,
+    0x18, 0x18, 0x18, 0x08, 0x08, 0x1F, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x09, 0x0F,
+    0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x07, 0x09, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x08, 0xF0,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x09, 0xF0, 0xF0, 0xF0, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x08, 0x08, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x07, 0x09, 0xF8, 0xF8,
+    0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x1F, 0x01, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x0F, 0x01, 0x08, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x01, 0x09, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F,
+    0x1F, 0x01, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x01, 0x09, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0xF0, 0xF0, 0xF0, 0x01, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8,
+    0x01, 0x09, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x01, 0x0F, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x1F, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01,
+    0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF0, 0xF0, 0xF0, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0x18,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF8,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xF8, 0xF8, 0xF8, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x08, 0xFF, 0x18, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x09, 0xF0, 0xFF, 0xF8, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x07, 0x09, 0x0F, 0xFF, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x09, 0xFF, 0xFF, 0xFF,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x07, 0x09, 0xF8, 0xFF, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x07, 0x09, 0x1F, 0xFF, 0x1F,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x07, 0x09, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x01, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x01, 0x09, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0xF0, 0xFF, 0xF0, 0x01, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0xFF,
+    0x0F, 0x01, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0x01, 0x08, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x01, 0x09, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xFF,
+    0xF8, 0x01, 0x09, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0x1F, 0x01, 0x09, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0xFF, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0xF0, 0xFF, 0xF8, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x1F, 0xFF, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xFF, 0xF8, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01,
+    0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF8, 0xFF, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F, 0xFF, 0x1F, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0xFF, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xFF, 0xF8, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0x1F,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x01, 0xFF, 0x07, 0x03, 0x66, 0xFF, 0x6E, 0x02,
+    0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x02, 0x0D,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x10, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x07, 0x03, 0xFF,
+    0x00, 0xFF, 0x01, 0x0F, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x07, 0x09, 0x1F, 0x10, 0x1F, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08,
+    0x3F, 0x3C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x07, 0x09, 0x3F, 0x20, 0x2F, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x07, 0x09, 0xF0, 0x10, 0xF0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08,
+    0xFC, 0x3C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x07, 0x09, 0xFC, 0x0C, 0xEC, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x01, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x1F, 0x10, 0x1F, 0x01, 0x08,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x3F, 0x01, 0x09, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2F, 0x20, 0x3F, 0x01, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x10, 0xF0, 0x01, 0x08,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xFC, 0x01, 0x09, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0xEC, 0x0C, 0xFC, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x1F, 0x10, 0x1F, 0x18, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2F, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x01, 0x0F, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2F, 0x20, 0x2F,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x10,
+    0xF0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0xEC, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x01, 0x0F, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0xEC, 0x0C, 0xEC, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x07, 0x09, 0xFF, 0x00, 0xFF, 0x18, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0xFF, 0x3C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x07, 0x09,
+    0xFF, 0x00, 0xEF, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x01, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x18, 0xFF, 0x00, 0xFF, 0x01, 0x08, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xFF, 0x01, 0x09,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xEF, 0x00, 0xFF, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x18, 0xFF, 0x10, 0xFF, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0F, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0xFF, 0x3C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x01, 0x0F, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0xEF, 0x00, 0xEF, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x08, 0x08, 0x0F, 0x08,
+    0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0xF0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x01, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x01, 0x08, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x18, 0x08, 0x0F, 0x01, 0x0F, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x30,
+    0x20, 0x40, 0x40, 0x80, 0x80, 0x01, 0x0F, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x18, 0x08,
+    0x0C, 0x04, 0x06, 0x02, 0x03, 0x01, 0x01, 0x0F, 0x81, 0x83, 0x42, 0x46, 0x24, 0x2C, 0x18, 0x18,
+    0x18, 0x3C, 0x24, 0x46, 0x42, 0x83, 0x81, 0x08, 0x01, 0xF0, 0x01, 0x07, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x08, 0x01, 0x0F, 0x09, 0x07, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07,
+    0x03, 0xF0, 0xF0, 0xF0, 0x01, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x07, 0x03,
+    0x0F, 0x0F, 0x0F, 0x08, 0x08, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x07, 0x03, 0x0F,
+    0xFF, 0x0F, 0x01, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x07, 0x03, 0xF0, 0xFF, 0xF0, 0x01, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0E, 0x02, 0xFF, 0xFF, 0x0C, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x06, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x0F, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x01, 0x0F, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x01, 0x0F, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+    0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x01, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0x0F, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x01, 0x0F, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x01, 0x0F, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+    0x0F, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22,
+    0x01, 0x0F, 0x96, 0xFF, 0x6B, 0x96, 0xFE, 0x6B, 0x96, 0xFE, 0x6B, 0x96, 0xFE, 0x6B, 0x96, 0xF6,
+    0x6B, 0x01, 0x0F, 0x77, 0xFF, 0xDD, 0xFF, 0x77, 0xFF, 0xDD, 0xFF, 0x77, 0xFF, 0xDD, 0xFF, 0x77,
+    0xFF, 0xDD, 0x01, 0x02, 0xFF, 0xFF, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0xF0, 0x08, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x08, 0xE0, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x08, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x01, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x06, 0x08, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFE, 0x06, 0x08, 0xFE, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x83, 0x3C, 0x06, 0x08, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFE, 0x06,
+    0x08, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFE, 0x06, 0x08, 0xFF, 0xD9, 0xD9, 0xD9, 0xD9,
+    0xD9, 0xFF, 0xFE, 0x06, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x06, 0x08, 0xFF,
+    0xAB, 0xD5, 0xAB, 0xD5, 0xEB, 0xFF, 0xFE, 0x06, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x06, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x05, 0x7C, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x07, 0x05, 0x7C, 0x42, 0x42, 0x42, 0x7E, 0x08, 0x04, 0xFF, 0xFF, 0xFF, 0xFE, 0x08,
+    0x04, 0xFF, 0x81, 0x81, 0xFE, 0x06, 0x08, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x06,
+    0x08, 0x3C, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x38, 0x08, 0x04, 0x3E, 0x7E, 0xFC, 0x7C, 0x08,
+    0x04, 0x3E, 0x42, 0xC4, 0x7C, 0x06, 0x08, 0x10, 0x18, 0x38, 0x3C, 0x7C, 0x7E, 0xFE, 0x7E, 0x06,
+    0x08, 0x10, 0x18, 0x28, 0x24, 0x44, 0x42, 0xC2, 0x7E, 0x08, 0x04, 0x18, 0x18, 0x3C, 0x3C, 0x08,
+    0x04, 0x18, 0x08, 0x24, 0x3C, 0x06, 0x07, 0xC0, 0xF0, 0xFC, 0xFE, 0xFC, 0xF0, 0xC0, 0x06, 0x07,
+    0xC0, 0xB0, 0x8C, 0x82, 0x8C, 0xB0, 0xC0, 0x07, 0x05, 0x40, 0x70, 0x7C, 0x78, 0x60, 0x07, 0x05,
+    0x40, 0x70, 0x4C, 0x58, 0x60, 0x07, 0x05, 0x80, 0xF8, 0xFE, 0xF8, 0xC0, 0x07, 0x05, 0x80, 0xB8,
+    0x86, 0x98, 0xC0, 0x06, 0x07, 0xFE, 0x7E, 0x7C, 0x3C, 0x38, 0x18, 0x10, 0x06, 0x07, 0xFE, 0x42,
+    0x44, 0x24, 0x28, 0x18, 0x10, 0x07, 0x04, 0x3C, 0x3C, 0x18, 0x18, 0x07, 0x04, 0x3C, 0x24, 0x08,
+    0x18, 0x06, 0x07, 0x03, 0x0F, 0x3F, 0xFF, 0x3F, 0x0F, 0x03, 0x06, 0x07, 0x03, 0x0D, 0x31, 0xC1,
+    0x21, 0x09, 0x03, 0x08, 0x04, 0x0E, 0x3E, 0x1E, 0x04, 0x08, 0x04, 0x0E, 0x22, 0x1A, 0x04, 0x07,
+    0x05, 0x03, 0x1F, 0x7F, 0x1F, 0x03, 0x07, 0x05, 0x03, 0x1D, 0x61, 0x19, 0x03, 0x06, 0x07, 0x18,
+    0x3C, 0x7E, 0xFF, 0x7E, 0x3C, 0x18, 0x06, 0x07, 0x18, 0x2C, 0x46, 0xC3, 0x42, 0x24, 0x18, 0x06,
+    0x07, 0x18, 0x3C, 0x7E, 0xBF, 0x7E, 0x3C, 0x18, 0x06, 0x08, 0x3C, 0x7A, 0xBD, 0xFD, 0xFD, 0xFE,
+    0x66, 0x18, 0x03, 0x0C, 0x18, 0x18, 0x24, 0x24, 0x40, 0x42, 0x42, 0x40, 0x24, 0x24, 0x18, 0x18,
+    0x06, 0x08, 0x3C, 0x42, 0x81, 0x81, 0x81, 0xC2, 0x66, 0x18, 0x06, 0x08, 0x10, 0x42, 0x00, 0x81,
+    0x00, 0x00, 0x42, 0x10, 0x06, 0x08, 0x3C, 0x5A, 0xDB, 0xD9, 0xDB, 0xDA, 0x7E, 0x18, 0x06, 0x08,
+    0x3C, 0x42, 0x99, 0xA1, 0x99, 0xC2, 0x66, 0x18, 0x06, 0x08, 0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x7E, 0x18, 0x06, 0x08, 0x3C, 0x72, 0xF1, 0xF1, 0xF1, 0xF2, 0x76, 0x18, 0x06, 0x08, 0x3C, 0x4E,
+    0x8F, 0x8F, 0x8F, 0xCE, 0x6E, 0x18, 0x06, 0x08, 0x3C, 0x42, 0x81, 0x81, 0xFF, 0xFE, 0x7E, 0x18,
+    0x06, 0x08, 0x3C, 0x7E, 0xFF, 0xFF, 0x81, 0xC2, 0x66, 0x18, 0x06, 0x08, 0x3C, 0x4E, 0x8F, 0x8F,
+    0x81, 0xC2, 0x66, 0x18, 0x06, 0x08, 0x3C, 0x4E, 0x8F, 0x9F, 0xFF, 0xFE, 0x7E, 0x18, 0x06, 0x07,
+    0x0C, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1C, 0x06, 0x08, 0x30, 0x38, 0x3C, 0x3C, 0x3C, 0x38, 0x38,
+    0x20, 0x03, 0x0A, 0xFF, 0xFF, 0xFF, 0xEF, 0xC3, 0xC3, 0xE7, 0xFF, 0xFF, 0xFF, 0x03, 0x0D, 0xFF,
+    0xFF, 0xFF, 0xD3, 0xBD, 0x7E, 0x7E, 0x7E, 0xFD, 0x9B, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0xFF, 0xFF,
+    0xFF, 0xD3, 0xBD, 0x7E, 0x7E, 0x0A, 0x06, 0x7E, 0xFD, 0x9B, 0xFF, 0xFF, 0xFF, 0x06, 0x04, 0x0C,
+    0x10, 0x20, 0x20, 0x06, 0x04, 0x30, 0x08, 0x04, 0x04, 0x0A, 0x04, 0x04, 0x08, 0x18, 0x20, 0x0A,
+    0x03, 0x20, 0x20, 0x18, 0x06, 0x04, 0x3C, 0x42, 0x81, 0x81, 0x0A, 0x04, 0x81, 0xC2, 0x66, 0x18,
+    0x06, 0x08, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7E, 0x06, 0x08, 0x80, 0xC0, 0xE0, 0xF0,
+    0xF8, 0xFC, 0xFE, 0xFE, 0x06, 0x07, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x06, 0x07, 0x7F,
+    0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x06, 0x08, 0xFF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+    0xF1, 0xFE, 0x06, 0x08, 0xFF, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xFE, 0x06, 0x08, 0xFF, 0xFD,
+    0xF9, 0xF1, 0xE1, 0xC1, 0x81, 0xFE, 0x06, 0x08, 0xFF, 0x83, 0x87, 0x8F, 0x9F, 0xBF, 0xFF, 0xFE,
+    0x06, 0x08, 0xFF, 0x91, 0x91, 0x91, 0x91, 0x91, 0x99, 0xFE, 0x06, 0x08, 0x10, 0x18, 0x28, 0x24,
+    0x5C, 0x42, 0xC2, 0x7E, 0x06, 0x08, 0x10, 0x18, 0x38, 0x34, 0x74, 0x72, 0xF2, 0x7E, 0x06, 0x08,
+    0x10, 0x18, 0x28, 0x2C, 0x4C, 0x4E, 0xCE, 0x7E, 0x06, 0x08, 0x6E, 0xC2, 0x81, 0x81, 0x81, 0x83,
+    0x66, 0x18, 0x06, 0x08, 0xFF, 0x91, 0x91, 0xF1, 0x81, 0x81, 0x81, 0xFE, 0x06, 0x08, 0xFF, 0x81,
+    0x81, 0xF1, 0x91, 0x91, 0x99, 0xFE, 0x06, 0x08, 0xFF, 0x81, 0x81, 0x8F, 0x91, 0x91, 0x99, 0xFE,
+    0x06, 0x08, 0xFF, 0x91, 0x91, 0x9F, 0x81, 0x81, 0x81, 0xFE, 0x06, 0x08, 0x3C, 0x52, 0x91, 0xF1,
+    0x81, 0xC2, 0x66, 0x18, 0x06, 0x08, 0x3C, 0x42, 0x81, 0xF1, 0x91, 0xD2, 0x7E, 0x18, 0x06, 0x08,
+    0x3C, 0x42, 0x81, 0x8F, 0x91, 0xD2, 0x7E, 0x18, 0x06, 0x08, 0x3C, 0x52, 0x91, 0x9F, 0x81, 0xC2,
+    0x66, 0x18, 0x06, 0x07, 0xFE, 0x84, 0x88, 0x90, 0xA0, 0xC0, 0x80, 0x06, 0x07, 0x7F, 0x21, 0x11,
+    0x09, 0x05, 0x03, 0x01, 0x06, 0x08, 0x80, 0xC0, 0xA0, 0x90, 0x88, 0x84, 0x86, 0xFE, 0x06, 0x07,
+    0x7E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7E, 0x06, 0x07, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x07, 0x05, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x07, 0x05, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x06, 0x08,
+    0x01, 0x03, 0x05, 0x09, 0x11, 0x21, 0x41, 0x7E, 0x07, 0x04, 0x18, 0x3E, 0x18, 0x40, 0x0A, 0x03,
+    0x1C, 0x3E, 0x7E, 0x07, 0x03, 0x3C, 0x7E, 0x24, 0x04, 0x02, 0x10, 0x18, 0x00, 0x00, 0x07, 0x05,
+    0x10, 0x18, 0x7E, 0x38, 0x3C, 0x00, 0x00, 0x04, 0x09, 0x04, 0x08, 0x10, 0x20, 0x60, 0x30, 0x18,
+    0x0C, 0x0C, 0x03, 0x0A, 0x7E, 0xC6, 0x84, 0x88, 0x90, 0x90, 0x88, 0x84, 0x82, 0x82, 0x09, 0x03,
+    0x18, 0x00, 0x02, 0x05, 0x08, 0x7C, 0xC2, 0x83, 0x83, 0xC2, 0xA5, 0xA5, 0x66, 0x04, 0x09, 0x46,
+    0xA5, 0xA5, 0x66, 0x82, 0x81, 0x82, 0x46, 0x3C, 0x04, 0x09, 0x02, 0x06, 0x1C, 0x7C, 0x46, 0xC2,
+    0xC2, 0x64, 0x38, 0x04, 0x09, 0x0E, 0x08, 0x09, 0x08, 0x7E, 0x90, 0x90, 0x90, 0x60, 0x05, 0x08,
+    0x3C, 0x7E, 0xFF, 0x3C, 0x7E, 0x7E, 0x76, 0x7E, 0x09, 0x04, 0x08, 0x00, 0x18, 0x10, 0x06, 0x07,
+    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x06, 0x07, 0x7E, 0x00, 0x00, 0x08, 0x00, 0x10, 0x7E,
+    0x07, 0x06, 0x42, 0x26, 0x1A, 0x1A, 0x26, 0x7E, 0x05, 0x07, 0x64, 0x24, 0x18, 0x18, 0x18, 0x24,
+    0x64, 0x07, 0x03, 0x10, 0x7C, 0x7E, 0x0A, 0x03, 0x3C, 0x00, 0x3C, 0x04, 0x09, 0x18, 0x46, 0x02,
+    0x00, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x04, 0x09, 0x18, 0x7E, 0x7E, 0x7E, 0x7E, 0xFE, 0xFE, 0xFE,
+    0xFF, 0x05, 0x07, 0x18, 0x38, 0x18, 0x7E, 0xFE, 0x66, 0x42, 0x06, 0x04, 0x12, 0x3C, 0x3A, 0x7A,
+    0x06, 0x05, 0xFF, 0x3E, 0x1E, 0x1E, 0x1E, 0x06, 0x05, 0xFE, 0xFC, 0xF8, 0xF8, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x10, 0x08, 0x04, 0x2C, 0x04, 0x24, 0x2C, 0x04, 0x09, 0x3C,
+    0xC4, 0x04, 0x08, 0x10, 0x30, 0x60, 0x6F, 0x38, 0x06, 0x07, 0x46, 0xE6, 0xFF, 0x19, 0x18, 0x3A,
+    0x3C, 0x08, 0x05, 0x24, 0x7E, 0x18, 0x18, 0x08, 0x05, 0x08, 0x7E, 0x3C, 0x34, 0x34, 0x3C, 0x38,
+    0x18, 0x18, 0x04, 0x09, 0x08, 0x08, 0x18, 0x7E, 0x10, 0x10, 0x10, 0x10, 0x18, 0x04, 0x09, 0x18,
+    0x18, 0x46, 0x00, 0x00, 0x10, 0x18, 0x18, 0x18, 0x03, 0x0A, 0x1C, 0x12, 0x12, 0x12, 0x1C, 0x54,
+    0x38, 0x10, 0x38, 0x54, 0x04, 0x09, 0x18, 0x38, 0x7C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x06,
+    0x07, 0x18, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x18, 0x05, 0x08, 0x30, 0x60, 0xC0, 0xC6, 0xC2, 0xC0,
+    0x60, 0x38, 0x06, 0x07, 0x10, 0xD2, 0xD3, 0xD1, 0xB4, 0x38, 0x18, 0x04, 0x09, 0x10, 0x18, 0x76,
+    0x56, 0x7A, 0x56, 0x7E, 0x28, 0x10, 0x05, 0x08, 0x04, 0x02, 0x1A, 0x1A, 0x06, 0x7F, 0x40, 0x80,
+    0x05, 0x08, 0x18, 0x74, 0x42, 0x91, 0x99, 0xA6, 0x42, 0x3C, 0x07, 0x06, 0x60, 0xF0, 0xF4, 0xF8,
+    0x7E, 0x3C, 0x05, 0x07, 0x18, 0x76, 0x7A, 0xEF, 0x7E, 0x7E, 0x18, 0x05, 0x07, 0x64, 0x42, 0xA1,
+    0x99, 0xA6, 0x42, 0x3C, 0x05, 0x07, 0x64, 0x42, 0xA1, 0x81, 0x9A, 0x42, 0x3C, 0x05, 0x07, 0x7C,
+    0x5A, 0xFF, 0xFF, 0xDA, 0x7E, 0x3C, 0x08, 0x03, 0x26, 0x18, 0x40, 0x04, 0x09, 0x18, 0x04, 0x08,
+    0x0A, 0x0A, 0x0A, 0x08, 0x10, 0x30, 0x03, 0x0A, 0x04, 0x18, 0x20, 0x50, 0x40, 0x40, 0x50, 0x10,
+    0x28, 0x04, 0x04, 0x0A, 0x42, 0x24, 0x3C, 0x44, 0x42, 0x64, 0x3C, 0x10, 0x18, 0x10, 0x04, 0x09,
+    0x10, 0x3C, 0x42, 0x42, 0x42, 0x3C, 0x18, 0x18, 0x18, 0x05, 0x09, 0x18, 0x18, 0x10, 0x3C, 0x46,
+    0x42, 0x42, 0x24, 0x18, 0x04, 0x08, 0x02, 0x03, 0x35, 0x5C, 0x84, 0x84, 0xC8, 0x78, 0x04, 0x08,
+    0x02, 0x32, 0x4A, 0x06, 0x06, 0x7E, 0x7E, 0x02, 0x04, 0x09, 0x20, 0x70, 0x20, 0x28, 0x34, 0x22,
+    0x22, 0x24, 0x24, 0x04, 0x08, 0x42, 0x52, 0x5E, 0x5E, 0x52, 0x5A, 0x18, 0x18, 0x04, 0x08, 0x10,
+    0x18, 0x76, 0x52, 0x3C, 0x18, 0x18, 0x10, 0x04, 0x09, 0x7C, 0x44, 0x44, 0x7C, 0x60, 0x40, 0x40,
+    0x40, 0x7C, 0x05, 0x06, 0xE6, 0x89, 0x99, 0x18, 0x18, 0x10, 0x05, 0x08, 0x02, 0x42, 0x24, 0x3C,
+    0x24, 0x40, 0x24, 0x38, 0x05, 0x08, 0xC7, 0x34, 0x24, 0x24, 0x24, 0x24, 0x24, 0xFF, 0x05, 0x08,
+    0x76, 0x90, 0x90, 0x76, 0x0A, 0x09, 0x0E, 0x3C, 0x05, 0x08, 0x12, 0x02, 0x02, 0x72, 0x94, 0x14,
+    0x00, 0x06, 0x06, 0x08, 0x7C, 0x56, 0x56, 0x55, 0x55, 0x56, 0x56, 0x0C, 0x05, 0x07, 0x18, 0x24,
+    0x24, 0x24, 0x66, 0x00, 0x7E, 0x05, 0x09, 0x28, 0x58, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x02,
+    0x05, 0x07, 0x0E, 0x03, 0x3D, 0x0D, 0x14, 0x24, 0x40, 0x05, 0x08, 0x10, 0x70, 0x60, 0x68, 0x0D,
+    0x09, 0x0E, 0x30, 0x07, 0x04, 0x3E, 0x00, 0x2A, 0x06, 0x05, 0x08, 0x42, 0x24, 0x24, 0x7E, 0x2C,
+    0x24, 0x24, 0x42, 0x06, 0x07, 0x10, 0x7C, 0x10, 0x80, 0x5A, 0x00, 0x24, 0x0A, 0x03, 0x3C, 0x04,
+    0x04, 0x05, 0x08, 0x5E, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x7E, 0x06, 0x07, 0x10, 0x38, 0x24,
+    0x18, 0x00, 0x20, 0x24, 0x0A, 0x01, 0x40, 0x06, 0x07, 0x18, 0x18, 0x20, 0x18, 0x24, 0x42, 0x7E,
+    0x08, 0x05, 0x7E, 0x7E, 0x7E, 0x3C, 0x3C, 0x06, 0x07, 0x24, 0x26, 0x36, 0x7C, 0x3C, 0x3C, 0x3C,
+    0x05, 0x08, 0x5A, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7E, 0x05, 0x08, 0x10, 0x18, 0x38, 0x20,
+    0x18, 0x18, 0x38, 0x3C, 0x05, 0x08, 0x10, 0x30, 0x78, 0x7C, 0x7C, 0x7E, 0x3E, 0x3E, 0x05, 0x08,
+    0x10, 0x18, 0x18, 0x3C, 0x38, 0x7C, 0x7E, 0x7E, 0x05, 0x06, 0x18, 0x38, 0x3C, 0x7E, 0x7E, 0x76,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x18, 0x3C, 0x3C, 0x38, 0x7E, 0xFF, 0x7E, 0x00, 0x00, 0x04,
+    0x08, 0x66, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, 0x38, 0x18, 0x05, 0x07, 0x18, 0x3C, 0x7C, 0x7E, 0x3C,
+    0x18, 0x10, 0x07, 0x04, 0x20, 0x00, 0x00, 0x10, 0x0B, 0x02, 0x80, 0x3C, 0x04, 0x09, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x3C, 0x18, 0x04, 0x09, 0x18, 0x1E, 0x12, 0x10, 0x10, 0x10, 0x10,
+    0x70, 0x70, 0x04, 0x0A, 0x1C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x06, 0x04, 0x08,
+    0x1F, 0x3F, 0x3F, 0x21, 0x21, 0x21, 0x21, 0xE7, 0x08, 0x05, 0x18, 0x24, 0x04, 0x08, 0x20, 0x06,
+    0x04, 0x18, 0x00, 0x00, 0x18, 0x05, 0x06, 0x04, 0x18, 0x20, 0x00, 0x1C, 0x30, 0x05, 0x08, 0x18,
+    0x10, 0x5A, 0x7E, 0x10, 0x10, 0x10, 0x18, 0x05, 0x08, 0x18, 0x18, 0x52, 0xFE, 0x00, 0x00, 0x18,
+    0x18, 0x06, 0x05, 0x10, 0x00, 0x00, 0x00, 0x02, 0x06, 0x07, 0x18, 0x2C, 0x30, 0x0A, 0x4A, 0x82,
+    0x76, 0x06, 0x07, 0x10, 0x28, 0x20, 0x08, 0x52, 0x9A, 0x76, 0x06, 0x07, 0x18, 0x28, 0x20, 0x0A,
+    0x4A, 0x92, 0x76, 0x06, 0x07, 0x18, 0x24, 0x28, 0x5A, 0xBA, 0x81, 0x76, 0x06, 0x07, 0x18, 0x2C,
+    0x28, 0x12, 0x4A, 0x92, 0x76, 0x06, 0x07, 0x10, 0x38, 0x20, 0x10, 0x4A, 0x82, 0x76, 0x06, 0x07,
+    0x18, 0x24, 0x38, 0x4A, 0xC2, 0x93, 0x76, 0x06, 0x07, 0x18, 0x2C, 0x20, 0x02, 0x42, 0x81, 0x76,
+    0x06, 0x07, 0x3C, 0x3C, 0x42, 0xE6, 0x42, 0x7E, 0x24, 0x06, 0x07, 0x34, 0x42, 0xFE, 0xB9, 0xDA,
+    0x52, 0x3C, 0x07, 0x05, 0x3C, 0x24, 0x66, 0x6C, 0x3C, 0x08, 0x03, 0x7C, 0x52, 0x24, 0x05, 0x08,
+    0x20, 0x20, 0x20, 0x30, 0x7C, 0xC4, 0x4E, 0x38, 0x06, 0x07, 0xFF, 0x81, 0x81, 0x99, 0x81, 0x81,
+    0xFE, 0x06, 0x07, 0xFF, 0x85, 0x85, 0x81, 0xA1, 0xA1, 0xFE, 0x06, 0x07, 0xFF, 0x85, 0x85, 0x99,
+    0xA1, 0xA1, 0xFE, 0x06, 0x07, 0xFF, 0xA5, 0xA5, 0x81, 0xA5, 0xA5, 0xFF, 0x06, 0x07, 0xFF, 0xA5,
+    0xA5, 0x99, 0xA5, 0xA5, 0xFE, 0x06, 0x07, 0xFF, 0xA5, 0xA1, 0xA5, 0x81, 0xA5, 0xFF, 0x06, 0x07,
+    0x24, 0x02, 0x00, 0x04, 0x00, 0x42, 0x24, 0x06, 0x07, 0x04, 0x00, 0x00, 0x24, 0x00, 0x42, 0x24,
+    0x06, 0x07, 0x3C, 0x7E, 0xFE, 0xFB, 0xFE, 0x7E, 0x3C, 0x06, 0x07, 0x3C, 0x7E, 0xFE, 0xFB, 0xFE,
+    0x7E, 0x3C, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xE6, 0x05, 0x08, 0x40, 0x48, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x05, 0x08, 0x70, 0x7E, 0x7E, 0x7E, 0x7E, 0x44, 0x40, 0x40, 0x06, 0x07, 0x24, 0x66,
+    0xE6, 0x18, 0x18, 0x24, 0x22, 0x05, 0x08, 0x18, 0x00, 0x18, 0x3C, 0x00, 0x00, 0xC3, 0x3C, 0x09,
+    0x04, 0x10, 0x08, 0x24, 0x42, 0x05, 0x08, 0x60, 0x38, 0x06, 0x38, 0x18, 0x04, 0x10, 0x08, 0x07,
+    0x06, 0x7E, 0x44, 0x00, 0x00, 0x89, 0x66, 0x06, 0x07, 0x3C, 0x7E, 0x8C, 0x00, 0x1E, 0x21, 0x21,
+    0x05, 0x06, 0x38, 0x24, 0x3C, 0x42, 0x7C, 0x18, 0x05, 0x08, 0x10, 0x7C, 0x46, 0xD2, 0xDA, 0x42,
+    0x7C, 0x18, 0x05, 0x02, 0x66, 0x08, 0x07, 0x04, 0x08, 0x20, 0x24, 0x18, 0x05, 0x08, 0x10, 0x18,
+    0xDE, 0x3C, 0x38, 0x18, 0x00, 0x10, 0x07, 0x06, 0x18, 0x18, 0x24, 0x00, 0x02, 0x92, 0x06, 0x06,
+    0x08, 0x30, 0x38, 0x0C, 0x10, 0x20, 0x03, 0x0A, 0x18, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x38, 0x18, 0x05, 0x08, 0x18, 0x18, 0x7C, 0x7C, 0x3C, 0x3C, 0x3C, 0x38, 0x07, 0x04, 0x20, 0x00,
+    0x7E, 0x08, 0x07, 0x04, 0x46, 0x38, 0x66, 0x40, 0x07, 0x04, 0x48, 0x1E, 0x20, 0x20, 0x07, 0x04,
+    0x42, 0x30, 0x40, 0x40, 0x05, 0x08, 0x18, 0x44, 0x18, 0x90, 0xA0, 0x20, 0x20, 0x18, 0x05, 0x08,
+    0x18, 0x52, 0x18, 0x91, 0xB5, 0x66, 0x40, 0x18, 0x06, 0x06, 0x10, 0x18, 0x18, 0x7E, 0x18, 0x10,
+    0x07, 0x05, 0xFE, 0xC2, 0x98, 0xBC, 0xC2, 0x07, 0x03, 0x18, 0x30, 0x30, 0x07, 0x04, 0x08, 0x10,
+    0x30, 0x60, 0x05, 0x07, 0x20, 0x70, 0x78, 0x6C, 0x36, 0x1C, 0x02, 0x09, 0x03, 0xC4, 0xC6, 0x40,
+    0x05, 0x07, 0x02, 0x1A, 0x26, 0x48, 0x50, 0x60, 0x20, 0x08, 0x03, 0xC6, 0x0E, 0x7C, 0x08, 0x03,
+    0x7C, 0xF6, 0xFC, 0x06, 0x06, 0x04, 0x0C, 0x08, 0x50, 0x70, 0x20, 0x06, 0x06, 0x06, 0x0C, 0x1C,
+    0x78, 0x70, 0x60, 0x06, 0x06, 0x42, 0x64, 0x38, 0x18, 0x2C, 0x46, 0x05, 0x07, 0x04, 0x6E, 0x7C,
+    0x3C, 0x7C, 0x6E, 0x04, 0x05, 0x08, 0x02, 0x34, 0x1C, 0x18, 0x38, 0x2C, 0x64, 0x40, 0x05, 0x08,
+    0x46, 0x6E, 0x7C, 0x38, 0x38, 0x7C, 0xEC, 0x40, 0x06, 0x07, 0x18, 0x18, 0x90, 0xFE, 0x90, 0x18,
+    0x18, 0x06, 0x07, 0x10, 0x18, 0x18, 0xFE, 0x7E, 0x18, 0x18, 0x06, 0x07, 0x18, 0x18, 0x18, 0xEF,
+    0x18, 0x18, 0x18, 0x06, 0x07, 0x18, 0x18, 0x6E, 0xE7, 0x18, 0x18, 0x18, 0x05, 0x08, 0x18, 0x18,
+    0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x08, 0x28, 0x6C, 0x02, 0x6E, 0x2C, 0x28, 0x28, 0x18,
+    0x05, 0x08, 0x08, 0x3C, 0x7E, 0x7E, 0x7C, 0x38, 0x38, 0x38, 0x06, 0x07, 0x38, 0x98, 0xD3, 0xFF,
+    0x93, 0x18, 0x3C, 0x06, 0x06, 0x18, 0x7E, 0x66, 0x66, 0x7E, 0x18, 0x06, 0x07, 0x18, 0x18, 0x00,
+    0xFF, 0x00, 0x18, 0x18, 0x06, 0x07, 0x18, 0x18, 0x42, 0xFF, 0x00, 0x18, 0x18, 0x06, 0x07, 0x18,
+    0x18, 0x76, 0xFF, 0x5A, 0x18, 0x18, 0x06, 0x07, 0x18, 0x38, 0x66, 0xFF, 0x76, 0x38, 0x18, 0x07,
+    0x05, 0x10, 0x18, 0x7C, 0x18, 0x10, 0x08, 0x03, 0x08, 0x64, 0x08, 0x08, 0x03, 0x24, 0x00, 0x04,
+    0x06, 0x07, 0x38, 0x7E, 0x66, 0xC2, 0x66, 0x5A, 0x3C, 0x07, 0x06, 0x10, 0x18, 0x66, 0x00, 0x2C,
+    0x24, 0x08, 0x04, 0x3C, 0x18, 0x3C, 0x18, 0x08, 0x05, 0x10, 0x78, 0x18, 0x18, 0x24, 0x07, 0x06,
+    0x10, 0x18, 0x66, 0x24, 0x3C, 0x24, 0x08, 0x05, 0x08, 0x7E, 0x38, 0x28, 0x04, 0x07, 0x06, 0x18,
+    0x08, 0x06, 0x04, 0x34, 0x24, 0x06, 0x07, 0x18, 0x5E, 0x7E, 0x3C, 0x7E, 0x5A, 0x18, 0x06, 0x07,
+    0x18, 0x5A, 0x7E, 0x24, 0x7E, 0x5A, 0x18, 0x07, 0x04, 0x04, 0x18, 0x7E, 0x38, 0x08, 0x03, 0x18,
+    0x3C, 0x38, 0x07, 0x05, 0x3C, 0x3C, 0x7E, 0x3C, 0x1C, 0x07, 0x04, 0x5A, 0x3C, 0x3C, 0x5A, 0x07,
+    0x05, 0x14, 0x3C, 0x7E, 0x3C, 0x14, 0x06, 0x06, 0x10, 0x7C, 0x3C, 0x7E, 0x3C, 0x7C, 0x07, 0x05,
+    0x3C, 0x7C, 0x7E, 0x7C, 0x3C, 0x06, 0x06, 0x30, 0x3C, 0x7E, 0x7E, 0x7E, 0x7C, 0x05, 0x08, 0x18,
+    0x18, 0xD7, 0x7E, 0x3C, 0xF7, 0x18, 0x18, 0x05, 0x08, 0x18, 0x18, 0xD6, 0x7E, 0x38, 0xE6, 0x1A,
+    0x18, 0x05, 0x08, 0x18, 0x18, 0xFF, 0x7E, 0x7E, 0xFF, 0x5A, 0x18, 0x05, 0x08, 0x10, 0x08, 0xFF,
+    0xFE, 0x7E, 0xBD, 0x5A, 0x18, 0x06, 0x07, 0x18, 0x7C, 0xE7, 0xC2, 0x66, 0x7E, 0x7C, 0x06, 0x07,
+    0x08, 0x66, 0xBD, 0xBC, 0x7E, 0x5A, 0x7C, 0x06, 0x07, 0x38, 0x7E, 0x7E, 0xE6, 0x7E, 0x7E, 0x18,
+    0x06, 0x07, 0x3C, 0x7A, 0xE6, 0xA5, 0xE7, 0x5A, 0x3C, 0x05, 0x08, 0x18, 0x5A, 0xBF, 0x7E, 0x7E,
+    0xBF, 0x5A, 0x18, 0x05, 0x07, 0x18, 0xD6, 0x76, 0x18, 0x7E, 0xC6, 0x18, 0x06, 0x06, 0x3C, 0x7E,
+    0x7E, 0x7E, 0x76, 0x3C, 0x05, 0x08, 0x18, 0x58, 0x42, 0xFE, 0x18, 0xC6, 0x5E, 0x18, 0x05, 0x08,
+    0x18, 0x18, 0xC7, 0x7E, 0x18, 0xE7, 0x5A, 0x18, 0x06, 0x07, 0x10, 0x14, 0x18, 0xFE, 0x20, 0x50,
+    0x10, 0x06, 0x07, 0x18, 0x1C, 0x18, 0xFF, 0x00, 0x58, 0x18, 0x06, 0x07, 0x10, 0x64, 0x00, 0xDF,
+    0x24, 0x56, 0x10, 0x07, 0x06, 0x52, 0x3C, 0xFE, 0x3C, 0x76, 0x18, 0x06, 0x07, 0x0C, 0x02, 0x02,
+    0x01, 0x01, 0x02, 0x0C, 0x0C, 0x01, 0x02, 0x06, 0x07, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x82,
+    0x06, 0x08, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x7E, 0x06, 0x07, 0xFF, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x82, 0x06, 0x07, 0x18, 0x38, 0x7E, 0xEE, 0x7E, 0x38, 0x18, 0x04, 0x0A, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x0B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x0B, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x04, 0x03, 0x10, 0x18, 0x18, 0x04, 0x03, 0x18, 0x18, 0x10, 0x04, 0x03, 0x24, 0x2C,
+    0x2C, 0x04, 0x03, 0x7C, 0x24, 0x24, 0x05, 0x09, 0x3E, 0x70, 0x70, 0x70, 0x38, 0x00, 0x70, 0x68,
+    0x30, 0x05, 0x08, 0x38, 0x3C, 0x3C, 0x18, 0x00, 0x18, 0x38, 0x18, 0x05, 0x08, 0x2C, 0x7E, 0x3C,
+    0x18, 0x00, 0x18, 0x38, 0x18, 0x06, 0x06, 0x24, 0xFE, 0xFF, 0x7E, 0x3C, 0x18, 0x05, 0x08, 0x70,
+    0x78, 0x7C, 0x3E, 0x7C, 0x78, 0x78, 0x70, 0x06, 0x07, 0x1A, 0x8A, 0x3C, 0x3E, 0x3C, 0x38, 0x1C,
+    0x07, 0x04, 0x48, 0x7C, 0xDD, 0x5E, 0x04, 0x09, 0x08, 0x10, 0x30, 0x30, 0x70, 0x30, 0x30, 0x30,
+    0x18, 0x04, 0x09, 0x10, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x04, 0x0A, 0x08, 0x18,
+    0x18, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x08, 0x05, 0x09, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x18,
+    0x18, 0x18, 0x10, 0x04, 0x0A, 0x08, 0x08, 0x18, 0x10, 0x30, 0x30, 0x10, 0x18, 0x08, 0x0C, 0x04,
+    0x0A, 0x20, 0x10, 0x18, 0x08, 0x0C, 0x0C, 0x08, 0x18, 0x10, 0x30, 0x05, 0x09, 0x0C, 0x18, 0x38,
+    0x30, 0x70, 0x30, 0x18, 0x1C, 0x0C, 0x05, 0x09, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0x38,
+    0x30, 0x03, 0x0B, 0x0C, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x30, 0x38, 0x18, 0x1C, 0x0C, 0x03, 0x0B,
+    0x20, 0x30, 0x38, 0x18, 0x1C, 0x0C, 0x0C, 0x1C, 0x18, 0x38, 0x30, 0x04, 0x0B, 0x08, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x04, 0x0B, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x10, 0x04, 0x0B, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x18, 0x18, 0x18,
+    0x18, 0x1C, 0x04, 0x0B, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x07,
+    0x04, 0x0C, 0x7E, 0x0E, 0x0C, 0x06, 0x06, 0x40, 0x20, 0x10, 0x0A, 0x06, 0x0E, 0x07, 0x03, 0x04,
+    0x7E, 0x04, 0x05, 0x07, 0x02, 0x0E, 0x0E, 0x1A, 0x30, 0x60, 0x40, 0x07, 0x03, 0x10, 0x7E, 0x18,
+    0x06, 0x05, 0x0C, 0x06, 0x7E, 0x06, 0x0C, 0x07, 0x03, 0x06, 0x06, 0x04, 0x07, 0x03, 0x06, 0xFE,
+    0x06, 0x07, 0x03, 0x04, 0x7E, 0x2E, 0x07, 0x03, 0x7C, 0x7E, 0x3C, 0x07, 0x03, 0x04, 0xFE, 0x7C,
+    0x07, 0x03, 0x20, 0x3E, 0x30, 0x07, 0x03, 0x38, 0x0C, 0x20, 0x06, 0x05, 0x60, 0x3C, 0x3E, 0x30,
+    0x40, 0x07, 0x03, 0xFE, 0xFE, 0x7C, 0x07, 0x03, 0x7E, 0xFE, 0x84, 0x06, 0x04, 0x08, 0x38, 0x3C,
+    0x38, 0x07, 0x03, 0xFC, 0xFE, 0xFC, 0x06, 0x05, 0x08, 0x04, 0x02, 0x04, 0x08, 0x07, 0x04, 0x08,
+    0x40, 0x40, 0x08, 0x07, 0x05, 0x04, 0x00, 0xF3, 0xFC, 0x08, 0x07, 0x03, 0x18, 0x7E, 0x02, 0x06,
+    0x06, 0x18, 0x04, 0x02, 0x76, 0x7C, 0x08, 0x06, 0x06, 0x08, 0x7C, 0x06, 0x02, 0x04, 0x18, 0x06,
+    0x05, 0x0C, 0x02, 0x02, 0xFE, 0x0C, 0x06, 0x05, 0x04, 0xFE, 0x02, 0x02, 0x0C, 0x05, 0x07, 0x10,
+    0x7C, 0x06, 0x02, 0x06, 0x7C, 0x38, 0x08, 0x03, 0x60, 0x76, 0x60, 0x06, 0x06, 0x30, 0x78, 0x38,
+    0x00, 0x06, 0x06, 0x08, 0x02, 0x76, 0x70, 0x06, 0x06, 0x06, 0x06, 0x10, 0x38, 0x30, 0x20, 0x05,
+    0x07, 0x20, 0x70, 0x78, 0x38, 0x00, 0x02, 0x02, 0x08, 0x02, 0xF2, 0x72, 0x06, 0x06, 0x02, 0x00,
+    0x38, 0x78, 0x70, 0x20, 0x07, 0x04, 0x0C, 0xF6, 0x66, 0x0C, 0x08, 0x02, 0xFE, 0x76, 0x07, 0x03,
+    0xF2, 0x7E, 0xF2, 0x07, 0x04, 0xF4, 0x7E, 0x7E, 0x70, 0x07, 0x04, 0x04, 0x7A, 0x02, 0x0C,
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef _normalize_h_
+#define _normalize_h_
+
+// Generated by tools/gen_normalize.py - do not edit.
+
+#define normalize_compose_count 407
+#define normalize_fold_count 47
+
+static const uint32_t PROGMEM normalize_compose_keys[] = {
+    0x02080, 0x02081, 0x02082, 0x02083, 0x02084, 0x02086, 0x02087, 0x02088,
+    0x0208A, 0x0208C, 0x0208F, 0x02091, 0x020A8, 0x020C0, 0x020C1, 0x02181,
+    0x02182, 0x02187, 0x0218C, 0x021A7, 0x021C1, 0x0220C, 0x02280, 0x02281,
+    0x02282, 0x02284, 0x02286, 0x02287, 0x02288, 0x0228C, 0x0228F, 0x02291,
+    0x022A7, 0x022A8, 0x022C0, 0x022C1, 0x02381, 0x02382, 0x02386, 0x02387,
+    0x0238C, 0x023A7, 0x023C1, 0x02402, 0x0240C, 0x02480, 0x02481, 0x02482,
+    0x02483, 0x02484, 0x02486, 0x02487, 0x02488, 0x0248C, 0x0248F, 0x02491,
+    0x024A8, 0x024C0, 0x024C1, 0x02502, 0x0258C, 0x025A7, 0x02601, 0x0260C,
+    0x02627, 0x02641, 0x02700, 0x02701, 0x02703, 0x0270C, 0x02727, 0x02740,
+    0x02741, 0x02780, 0x02781, 0x02782, 0x02783, 0x02784, 0x02786, 0x02787,
+    0x02788, 0x0278B, 0x0278C, 0x0278F, 0x02791, 0x0279B, 0x027A8, 0x027C0,
+    0x027C1, 0x02901, 0x0290C, 0x0290F, 0x02911, 0x02927, 0x02941, 0x02981,
+    0x02982, 0x0298C, 0x029A6, 0x029A7, 0x029C1, 0x02A0C, 0x02A26, 0x02A27,
+    0x02A80, 0x02A81, 0x02A82, 0x02A83, 0x02A84, 0x02A86, 0x02A88, 0x02A8A,
+    0x02A8B, 0x02A8C, 0x02A8F, 0x02A91, 0x02A9B, 0x02AA8, 0x02AC0, 0x02AC1,
+    0x02AC4, 0x02B82, 0x02C81, 0x02C82, 0x02C84, 0x02C88, 0x02CC1, 0x02D01,
+    0x02D07, 0x02D0C, 0x02D41, 0x03080, 0x03081, 0x03082, 0x03083, 0x03084,
+    0x03086, 0x03087, 0x03088, 0x0308A, 0x0308C, 0x0308F, 0x03091, 0x030A8,
+    0x030C0, 0x030C1, 0x03181, 0x03182, 0x03187, 0x0318C, 0x031A7, 0x031C1,
+    0x0320C, 0x03280, 0x03281, 0x03282, 0x03284, 0x03286, 0x03287, 0x03288,
+    0x0328C, 0x0328F, 0x03291, 0x032A7, 0x032A8, 0x032C0, 0x032C1, 0x03381,
+    0x03382, 0x03386, 0x03387, 0x0338C, 0x033A7, 0x033C1, 0x03402, 0x0340C,
+    0x03480, 0x03481, 0x03482, 0x03483, 0x03484, 0x03486, 0x03488, 0x0348C,
+    0x0348F, 0x03491, 0x034A8, 0x034C0, 0x034C1, 0x03502, 0x0350C, 0x0358C,
+    0x035A7, 0x03601, 0x0360C, 0x03627, 0x03641, 0x03700, 0x03701, 0x03703,
+    0x0370C, 0x03727, 0x03740, 0x03741, 0x03780, 0x03781, 0x03782, 0x03783,
+    0x03784, 0x03786, 0x03787, 0x03788, 0x0378B, 0x0378C, 0x0378F, 0x03791,
+    0x0379B, 0x037A8, 0x037C0, 0x037C1, 0x03901, 0x0390C, 0x0390F, 0x03911,
+    0x03927, 0x03941, 0x03981, 0x03982, 0x0398C, 0x039A6, 0x039A7, 0x039C1,
+    0x03A0C, 0x03A26, 0x03A27, 0x03A80, 0x03A81, 0x03A82, 0x03A83, 0x03A84,
+    0x03A86, 0x03A88, 0x03A8A, 0x03A8B, 0x03A8C, 0x03A8F, 0x03A91, 0x03A9B,
+    0x03AA8, 0x03AC0, 0x03AC1, 0x03AC4, 0x03B82, 0x03C81, 0x03C82, 0x03C84,
+    0x03C88, 0x03CC1, 0x03D01, 0x03D07, 0x03D0C, 0x03D41, 0x05401, 0x05441,
+    0x06204, 0x06281, 0x062C1, 0x06301, 0x06304, 0x06341, 0x06A84, 0x06B04,
+    0x06C01, 0x06C41, 0x06E00, 0x06E01, 0x06E04, 0x06E0C, 0x06E40, 0x06E41,
+    0x07204, 0x07281, 0x072C1, 0x07301, 0x07304, 0x07341, 0x07A84, 0x07B04,
+    0x07C01, 0x07C41, 0x07E00, 0x07E01, 0x07E04, 0x07E0C, 0x07E40, 0x07E41,
+    0x0A628, 0x0A6A8, 0x0DB8C, 0x0F504, 0x0F584, 0x11304, 0x11384, 0x11704,
+    0x11784, 0x1490C, 0x1C881, 0x1C8C1, 0x1CA81, 0x1CAC1, 0x1CB81, 0x1CBC1,
+    0x1CC81, 0x1CC88, 0x1CCC1, 0x1CF81, 0x1CFC1, 0x1D281, 0x1D288, 0x1D2C1,
+    0x1D481, 0x1D4C1, 0x1D881, 0x1D8C1, 0x1DA81, 0x1DAC1, 0x1DB81, 0x1DBC1,
+    0x1DC81, 0x1DC88, 0x1DCC1, 0x1DCC4, 0x1DF81, 0x1DFC1, 0x1E281, 0x1E288,
+    0x1E2C1, 0x1E2C4, 0x1E481, 0x1E4C1, 0x1E501, 0x1E541, 0x1E581, 0x1E5C1,
+    0x1E901, 0x1E908, 0x1E941, 0x20308, 0x20806, 0x20808, 0x20981, 0x209C1,
+    0x20A80, 0x20A86, 0x20A88, 0x20AC0, 0x20B06, 0x20B08, 0x20B88, 0x20C00,
+    0x20C04, 0x20C06, 0x20C08, 0x20C40, 0x20D01, 0x20D41, 0x20F08, 0x21184,
+    0x21186, 0x21188, 0x2118B, 0x21388, 0x21588, 0x21688, 0x21806, 0x21808,
+    0x21981, 0x219C1, 0x21A80, 0x21A86, 0x21A88, 0x21AC0, 0x21B06, 0x21B08,
+    0x21B88, 0x21C00, 0x21C04, 0x21C06, 0x21C08, 0x21C40, 0x21D01, 0x21D41,
+    0x21F08, 0x22184, 0x22186, 0x22188, 0x2218B, 0x22388, 0x22588, 0x22688,
+    0x22B08, 0x23A0F, 0x23A8F, 0x26C08, 0x26C88, 0x27408, 0x27488,
+};
+
+static const uint16_t PROGMEM normalize_compose_values[] = {
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x0100, 0x0102, 0x0226, 0x00C4, 0x00C5, 0x01CD, 0x0200, 0x0202,
+    0x0104, 0x00C0, 0x00C1, 0x0106, 0x0108, 0x010A, 0x010C, 0x00C7, 0x0106, 0x010E, 0x00C8, 0x00C9,
+    0x00CA, 0x0112, 0x0114, 0x0116, 0x00CB, 0x011A, 0x0204, 0x0206, 0x0228, 0x0118, 0x00C8, 0x00C9,
+    0x01F4, 0x011C, 0x011E, 0x0120, 0x01E6, 0x0122, 0x01F4, 0x0124, 0x021E, 0x00CC, 0x00CD, 0x00CE,
+    0x0128, 0x012A, 0x012C, 0x0130, 0x00CF, 0x01CF, 0x0208, 0x020A, 0x012E, 0x00CC, 0x00CD, 0x0134,
+    0x01E8, 0x0136, 0x0139, 0x013D, 0x013B, 0x0139, 0x01F8, 0x0143, 0x00D1, 0x0147, 0x0145, 0x01F8,
+    0x0143, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x014C, 0x014E, 0x022E, 0x00D6, 0x0150, 0x01D1, 0x020C,
+    0x020E, 0x01A0, 0x01EA, 0x00D2, 0x00D3, 0x0154, 0x0158, 0x0210, 0x0212, 0x0156, 0x0154, 0x015A,
+    0x015C, 0x0160, 0x0218, 0x015E, 0x015A, 0x0164, 0x021A, 0x0162, 0x00D9, 0x00DA, 0x00DB, 0x0168,
+    0x016A, 0x016C, 0x00DC, 0x016E, 0x0170, 0x01D3, 0x0214, 0x0216, 0x01AF, 0x0172, 0x00D9, 0x00DA,
+    0x01D7, 0x0174, 0x00DD, 0x0176, 0x0232, 0x0178, 0x00DD, 0x0179, 0x017B, 0x017D, 0x0179, 0x00E0,
+    0x00E1, 0x00E2, 0x00E3, 0x0101, 0x0103, 0x0227, 0x00E4, 0x00E5, 0x01CE, 0x0201, 0x0203, 0x0105,
+    0x00E0, 0x00E1, 0x0107, 0x0109, 0x010B, 0x010D, 0x00E7, 0x0107, 0x010F, 0x00E8, 0x00E9, 0x00EA,
+    0x0113, 0x0115, 0x0117, 0x00EB, 0x011B, 0x0205, 0x0207, 0x0229, 0x0119, 0x00E8, 0x00E9, 0x01F5,
+    0x011D, 0x011F, 0x0121, 0x01E7, 0x0123, 0x01F5, 0x0125, 0x021F, 0x00EC, 0x00ED, 0x00EE, 0x0129,
+    0x012B, 0x012D, 0x00EF, 0x01D0, 0x0209, 0x020B, 0x012F, 0x00EC, 0x00ED, 0x0135, 0x01F0, 0x01E9,
+    0x0137, 0x013A, 0x013E, 0x013C, 0x013A, 0x01F9, 0x0144, 0x00F1, 0x0148, 0x0146, 0x01F9, 0x0144,
+    0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x014D, 0x014F, 0x022F, 0x00F6, 0x0151, 0x01D2, 0x020D, 0x020F,
+    0x01A1, 0x01EB, 0x00F2, 0x00F3, 0x0155, 0x0159, 0x0211, 0x0213, 0x0157, 0x0155, 0x015B, 0x015D,
+    0x0161, 0x0219, 0x015F, 0x015B, 0x0165, 0x021B, 0x0163, 0x00F9, 0x00FA, 0x00FB, 0x0169, 0x016B,
+    0x016D, 0x00FC, 0x016F, 0x0171, 0x01D4, 0x0215, 0x0217, 0x01B0, 0x0173, 0x00F9, 0x00FA, 0x01D8,
+    0x0175, 0x00FD, 0x0177, 0x0233, 0x00FF, 0x00FD, 0x017A, 0x017C, 0x017E, 0x017A, 0x0385, 0x0385,
+    0x01DE, 0x01FA, 0x01FA, 0x01FC, 0x01E2, 0x01FC, 0x022C, 0x022A, 0x01FE, 0x01FE, 0x01DB, 0x01D7,
+    0x01D5, 0x01D9, 0x01DB, 0x01D7, 0x01DF, 0x01FB, 0x01FB, 0x01FD, 0x01E3, 0x01FD, 0x022D, 0x022B,
+    0x01FF, 0x01FF, 0x01DC, 0x01D8, 0x01D6, 0x01DA, 0x01DC, 0x01D8, 0x01EC, 0x01ED, 0x01EE, 0x01EC,
+    0x01ED, 0x01E0, 0x01E1, 0x0230, 0x0231, 0x01EF, 0x0386, 0x0386, 0x0388, 0x0388, 0x0389, 0x0389,
+    0x038A, 0x03AA, 0x038A, 0x038C, 0x038C, 0x038E, 0x03AB, 0x038E, 0x038F, 0x038F, 0x03AC, 0x03AC,
+    0x03AD, 0x03AD, 0x03AE, 0x03AE, 0x03AF, 0x03CA, 0x03AF, 0x0390, 0x03CC, 0x03CC, 0x03CD, 0x03CB,
+    0x03CD, 0x03B0, 0x03CE, 0x03CE, 0x0390, 0x0390, 0x03B0, 0x03B0, 0x03D3, 0x03D4, 0x03D3, 0x0407,
+    0x04D0, 0x04D2, 0x0403, 0x0403, 0x0400, 0x04D6, 0x0401, 0x0400, 0x04C1, 0x04DC, 0x04DE, 0x040D,
+    0x04E2, 0x0419, 0x04E4, 0x040D, 0x040C, 0x040C, 0x04E6, 0x04EE, 0x040E, 0x04F0, 0x04F2, 0x04F4,
+    0x04F8, 0x04EC, 0x04D1, 0x04D3, 0x0453, 0x0453, 0x0450, 0x04D7, 0x0451, 0x0450, 0x04C2, 0x04DD,
+    0x04DF, 0x045D, 0x04E3, 0x0439, 0x04E5, 0x045D, 0x045C, 0x045C, 0x04E7, 0x04EF, 0x045E, 0x04F1,
+    0x04F3, 0x04F5, 0x04F9, 0x04ED, 0x0457, 0x0476, 0x0477, 0x04DA, 0x04DB, 0x04EA, 0x04EB,
+};
+
+static const uint16_t PROGMEM normalize_fold_codepoints[] = {
+    0x00A0, 0x00AD, 0x2002, 0x2003, 0x2004, 0x2005, 0x2006, 0x2007, 0x2008, 0x2009, 0x200A, 0x200B,
+    0x200C, 0x200D, 0x200E, 0x200F, 0x2010, 0x2011, 0x2012, 0x2013, 0x2014, 0x2015, 0x2018, 0x2019,
+    0x201A, 0x201B, 0x201C, 0x201D, 0x201E, 0x201F, 0x2022, 0x2024, 0x2026, 0x202F, 0x2032, 0x2033,
+    0x2039, 0x203A, 0x2044, 0x205F, 0x2060, 0x20AC, 0x2122, 0x2212, 0xFE0E, 0xFE0F, 0xFEFF,
+};
+
+static const uint8_t PROGMEM normalize_fold_offsets[] = {
+    0, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 10,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 29, 30, 31, 32, 33, 34, 35, 36, 36, 39, 41, 42, 42, 42, 42,
+};
+
+static const char PROGMEM normalize_fold_pool[] = "          ------''''\"\"\"\"*.... '\"<>/ EURTM-";
+
+#endif
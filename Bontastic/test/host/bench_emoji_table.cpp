@@ -0,0 +1,66 @@
+// Emoji shortcode lookup: the binary search over the generated table
+// against a linear scan of the same table, which is how the old table of
+// {codepoint, shortcode} pairs was searched.
+#include "host_test.h"
+#include "src/printer/EmojiTable.h"
+#include "src/printer/TextTranscoder.h"
+#include <vector>
+
+static uint32_t emojiAt(uint16_t i)
+{
+    return i < emojiBmpCount ? emojiCodepoints[i] : 0x10000 | emojiCodepoints[i];
+}
+
+static int linearFind(uint32_t cp)
+{
+    for (uint16_t i = 0; i < emojiCount; i++)
+    {
+        if (emojiAt(i) == cp)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int main()
+{
+    // Every codepoint up to plane 1 gives the same answer both ways.
+    for (uint32_t cp = 0; cp < 0x20000; cp++)
+    {
+        const char *name = nullptr;
+        size_t len = 0;
+        bool found = emojiShortcode(cp, name, len);
+        int i = linearFind(cp);
+        CHECK(found == (i >= 0));
+        if (found && i >= 0)
+        {
+            // The table is static, so each translation unit has its own copy.
+            CHECK(len == (size_t)(emojiShortcodeOffsets[i + 1] - emojiShortcodeOffsets[i]));
+            CHECK(!memcmp(name, emojiShortcodePool + emojiShortcodeOffsets[i], len));
+        }
+    }
+
+    // Message-like input: mostly letters, some emoji.
+    std::vector<uint32_t> input;
+    for (uint16_t i = 0; i < emojiCount; i++)
+    {
+        input.push_back(emojiAt(i));
+        for (uint32_t letter = 0; letter < 4; letter++)
+        {
+            input.push_back(0x430 + (i + letter) % 32);
+        }
+    }
+    volatile size_t sink = 0;
+    const size_t calls = input.size() * 20;
+    double linearNs = hostTimeNs(calls, [&](size_t i) { sink += linearFind(input[i % input.size()]) + 1; });
+    double binaryNs = hostTimeNs(calls, [&](size_t i) {
+        const char *name;
+        size_t len;
+        sink += emojiShortcode(input[i % input.size()], name, len);
+    });
+    printf("emoji_table: %u emoji, %zu table bytes, linear %.1f ns, binary %.1f ns per lookup\n",
+           (unsigned)emojiCount, sizeof(emojiCodepoints) + sizeof(emojiShortcodeOffsets) + sizeof(emojiShortcodePool),
+           linearNs, binaryNs);
+    return hostTestResult("bench_emoji_table");
+}
@@ -0,0 +1,159 @@
+// FromRadio scanning: scanFromRadio reads the same fields pb_decode does
+// from typical records, never points past the end of truncated input, and
+// time per record against a full pb_decode into meshtastic_FromRadio.
+#include "host_test.h"
+#include "src/mesh/FromRadioScan.h"
+#include "src/nanopb/pb_decode.h"
+#include "src/nanopb/pb_encode.h"
+#include "src/protobufs/mesh.pb.h"
+#include <vector>
+
+struct Sample
+{
+    const char *name;
+    std::vector<uint8_t> bytes;
+};
+
+static std::vector<uint8_t> encode(const meshtastic_FromRadio &record)
+{
+    std::vector<uint8_t> bytes(meshtastic_FromRadio_size);
+    pb_ostream_t stream = pb_ostream_from_buffer(bytes.data(), bytes.size());
+    CHECK(pb_encode(&stream, meshtastic_FromRadio_fields, &record));
+    bytes.resize(stream.bytes_written);
+    return bytes;
+}
+
+static std::vector<Sample> samples()
+{
+    std::vector<Sample> out;
+
+    meshtastic_FromRadio text = meshtastic_FromRadio_init_zero;
+    text.id = 7;
+    text.which_payload_variant = meshtastic_FromRadio_packet_tag;
+    meshtastic_MeshPacket &p = text.packet;
+    p.from = 0x1234ABCD;
+    p.to = 0xFFFFFFFF;
+    p.channel = 2;
+    p.id = 0xDEADBEEF;
+    p.rx_time = 1700000000;
+    p.rx_snr = 6.5;
+    p.rx_rssi = -80;
+    p.hop_limit = 3;
+    p.hop_start = 3;
+    p.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p.decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+    p.decoded.reply_id = 42;
+    const char *message = "Hello from the mesh, anyone near the north gate?";
+    p.decoded.payload.size = strlen(message);
+    memcpy(p.decoded.payload.bytes, message, p.decoded.payload.size);
+    out.push_back({"text", encode(text)});
+    p.decoded.payload.size = 200;
+    memset(p.decoded.payload.bytes, 'x', 200);
+    out.push_back({"text-200", encode(text)});
+
+    meshtastic_FromRadio node = meshtastic_FromRadio_init_zero;
+    node.which_payload_variant = meshtastic_FromRadio_node_info_tag;
+    node.node_info.num = 0x1234;
+    node.node_info.has_user = true;
+    strcpy(node.node_info.user.long_name, "Some Node Long Name");
+    strcpy(node.node_info.user.short_name, "SNLN");
+    node.node_info.has_position = true;
+    node.node_info.position.latitude_i = 473000000;
+    node.node_info.last_heard = 1700000000;
+    node.node_info.has_device_metrics = true;
+    node.node_info.device_metrics.battery_level = 90;
+    out.push_back({"node_info", encode(node)});
+
+    meshtastic_FromRadio channel = meshtastic_FromRadio_init_zero;
+    channel.which_payload_variant = meshtastic_FromRadio_channel_tag;
+    channel.channel.index = 1;
+    channel.channel.has_settings = true;
+    strcpy(channel.channel.settings.name, "bontastic");
+    channel.channel.settings.psk.size = 16;
+    channel.channel.role = meshtastic_Channel_Role_SECONDARY;
+    out.push_back({"channel", encode(channel)});
+    return out;
+}
+
+static bool sameFields(const meshtastic_FromRadio &record, const FromRadioView &view)
+{
+    switch (record.which_payload_variant)
+    {
+    case meshtastic_FromRadio_packet_tag:
+    {
+        const meshtastic_MeshPacket &p = record.packet;
+        return view.kind == FromRadioKind::Packet && view.decoded && view.from == p.from && view.to == p.to &&
+               view.id == p.id && view.channel == p.channel && view.rxTime == p.rx_time &&
+               view.portnum == (uint32_t)p.decoded.portnum && view.replyId == p.decoded.reply_id &&
+               view.payloadLen == p.decoded.payload.size &&
+               !memcmp(view.payload, p.decoded.payload.bytes, view.payloadLen);
+    }
+    case meshtastic_FromRadio_node_info_tag:
+    {
+        const uint8_t *longName;
+        const uint8_t *shortName;
+        size_t longLen;
+        size_t shortLen;
+        const meshtastic_User &user = record.node_info.user;
+        return view.kind == FromRadioKind::NodeInfo && view.value == record.node_info.num &&
+               scanUserNames(view.payload, view.payloadLen, longName, longLen, shortName, shortLen) &&
+               longLen == strlen(user.long_name) && !memcmp(longName, user.long_name, longLen) &&
+               shortLen == strlen(user.short_name) && !memcmp(shortName, user.short_name, shortLen);
+    }
+    case meshtastic_FromRadio_channel_tag:
+        return view.kind == FromRadioKind::Channel && view.value == (uint32_t)record.channel.index &&
+               view.payloadLen == strlen(record.channel.settings.name) &&
+               !memcmp(view.payload, record.channel.settings.name, view.payloadLen);
+    }
+    return false;
+}
+
+int main()
+{
+    static meshtastic_FromRadio record;
+    std::vector<Sample> all = samples();
+    for (const Sample &s : all)
+    {
+        record = meshtastic_FromRadio_init_zero;
+        pb_istream_t stream = pb_istream_from_buffer(s.bytes.data(), s.bytes.size());
+        CHECK(pb_decode(&stream, meshtastic_FromRadio_fields, &record));
+        FromRadioView view;
+        CHECK(scanFromRadio(s.bytes.data(), s.bytes.size(), view));
+        if (!sameFields(record, view))
+        {
+            fprintf(stderr, "%s: scanned fields differ from pb_decode\n", s.name);
+            CHECK(sameFields(record, view));
+        }
+
+        // Truncated records either fail or keep the payload inside the input.
+        for (size_t len = 0; len < s.bytes.size(); len++)
+        {
+            std::vector<uint8_t> cut(s.bytes.begin(), s.bytes.begin() + len);
+            FromRadioView partial;
+            if (scanFromRadio(cut.data(), cut.size(), partial) && partial.payload)
+            {
+                CHECK(partial.payload >= cut.data() && partial.payload + partial.payloadLen <= cut.data() + cut.size());
+            }
+        }
+    }
+
+    volatile uint32_t sink = 0;
+    const size_t calls = 200000;
+    for (const Sample &s : all)
+    {
+        double decodeNs = hostTimeNs(calls, [&](size_t) {
+            record = meshtastic_FromRadio_init_zero;
+            pb_istream_t stream = pb_istream_from_buffer(s.bytes.data(), s.bytes.size());
+            sink += pb_decode(&stream, meshtastic_FromRadio_fields, &record) + record.packet.from;
+        });
+        double scanNs = hostTimeNs(calls, [&](size_t) {
+            FromRadioView view;
+            sink += scanFromRadio(s.bytes.data(), s.bytes.size(), view) + view.from;
+        });
+        printf("fromradio_scan: %-9s %3zu bytes, pb_decode %5.0f ns, scan %4.0f ns\n", s.name, s.bytes.size(),
+               decodeNs, scanNs);
+    }
+    printf("fromradio_scan: meshtastic_FromRadio %zu bytes, FromRadioView %zu bytes\n", sizeof(meshtastic_FromRadio),
+           sizeof(FromRadioView));
+    return hostTestResult("bench_fromradio_scan");
+}
@@ -0,0 +1,61 @@
+// GB2312 lookup: gb2312Code against the C library's iconv over the whole
+// BMP, and lookup time for Han and for other codepoints.
+#include "host_test.h"
+#include "src/printer/Gb2312.h"
+#include <iconv.h>
+
+static uint16_t iconvCode(iconv_t cd, uint32_t cp)
+{
+    char in[4] = {(char)cp, (char)(cp >> 8), (char)(cp >> 16), 0};
+    unsigned char out[8];
+    char *inp = in;
+    char *outp = reinterpret_cast<char *>(out);
+    size_t inLeft = sizeof(in);
+    size_t outLeft = sizeof(out);
+    iconv(cd, nullptr, nullptr, nullptr, nullptr);
+    if (iconv(cd, &inp, &inLeft, &outp, &outLeft) == (size_t)-1 || sizeof(out) - outLeft != 2)
+    {
+        return 0;
+    }
+    return out[0] << 8 | out[1];
+}
+
+int main()
+{
+    iconv_t cd = iconv_open("GB2312", "UTF-32LE");
+    CHECK(cd != (iconv_t)-1);
+    if (cd == (iconv_t)-1)
+    {
+        return hostTestResult("bench_gb2312");
+    }
+    size_t mapped = 0;
+    size_t mismatches = 0;
+    for (uint32_t cp = 0x80; cp < 0x10000; cp++)
+    {
+        if (cp >= 0xD800 && cp < 0xE000)
+        {
+            continue;
+        }
+        uint16_t expected = iconvCode(cd, cp);
+        uint16_t got = gb2312Code(cp);
+        mapped += got != 0;
+        if (got != expected && mismatches++ < 5)
+        {
+            fprintf(stderr, "U+%04X: gb2312Code %04X, iconv %04X\n", cp, got, expected);
+        }
+    }
+    iconv_close(cd);
+    CHECK(mismatches == 0);
+
+    volatile uint32_t sink = 0;
+    uint32_t seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return seed >> 8;
+    };
+    const size_t calls = 20000000;
+    double hanNs = hostTimeNs(calls, [&](size_t) { sink += gb2312Code(0x4E00 + next() % 0x5200); });
+    double otherNs = hostTimeNs(calls, [&](size_t) { sink += gb2312Code(0x2000 + next() % 0x2000); });
+    printf("gb2312: %zu codepoints mapped, han %.1f ns, other %.1f ns per lookup\n", mapped, hanNs, otherNs);
+    return hostTestResult("bench_gb2312");
+}
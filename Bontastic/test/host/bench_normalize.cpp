@@ -0,0 +1,83 @@
+// Normalization: decomposed input (a letter followed by combining marks)
+// prints the same bytes as its precomposed form, and throughput over a
+// corpus of typical messages on code page 23 (Windows-1252).
+#include "host_test.h"
+#include "src/printer/CodePages.h"
+#include "src/printer/TextTranscoder.h"
+#include <string>
+
+struct StringPrint : Print
+{
+    std::string bytes;
+    size_t write(uint8_t c) override
+    {
+        bytes += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t *data, size_t len) override
+    {
+        bytes.append(reinterpret_cast<const char *>(data), len);
+        return len;
+    }
+};
+
+static std::string transcode(const char *text)
+{
+    StringPrint out;
+    TextTranscoder transcoder(out);
+    transcoder.write(reinterpret_cast<const uint8_t *>(text), strlen(text));
+    transcoder.finish();
+    return out.bytes;
+}
+
+// {decomposed, precomposed}
+static const char *const pairs[][2] = {
+    {"Cafe\xCC\x81", "Caf\xC3\xA9"},
+    {"Re\xCC\x81sume\xCC\x81", "R\xC3\xA9sum\xC3\xA9"},
+    {"Nin\xCC\x83o", "Ni\xC3\xB1o"},
+    {"U\xCC\x88" "ber", "\xC3\x9C" "ber"},
+    {"A\xCC\x8A" "ngstro\xCC\x88m", "\xC3\x85ngstr\xC3\xB6m"},
+    {"c\xCC\xA7" "a va", "\xC3\xA7" "a va"},
+};
+
+static const char *const corpus[] = {
+    "On my way, ETA 15 min",
+    "Cafe\xCC\x81 at the corner? Re\xCC\x81sume\xCC\x81 later",
+    "It\xE2\x80\x99s \xE2\x80\x9C" "fine\xE2\x80\x9D \xE2\x80\x94 see you\xE2\x80\xA6",
+    "Battery 87%, SNR 6.5 dB, hops 3",
+    "Gr\xC3\xBC\xC3\x9F" "e aus M\xC3\xBCnchen!",
+    "Nin\xCC\x83o espa\xC3\xB1ol\xC2\xA0" "man\xCC\x83" "ana",
+    "Node !a1b2c3d4 online at 12:04",
+    "Thumbs up \xF0\x9F\x91\x8D\xEF\xB8\x8F",
+};
+
+int main()
+{
+    setActiveCodePage(23);
+    for (const auto &pair : pairs)
+    {
+        std::string decomposed = transcode(pair[0]);
+        if (decomposed != transcode(pair[1]))
+        {
+            fprintf(stderr, "\"%s\" prints differently from \"%s\"\n", pair[0], pair[1]);
+        }
+        CHECK(decomposed == transcode(pair[1]));
+    }
+
+    size_t corpusBytes = 0;
+    for (const char *message : corpus)
+    {
+        corpusBytes += strlen(message);
+    }
+    StringPrint out;
+    out.bytes.reserve(1 << 12);
+    const size_t count = sizeof(corpus) / sizeof(corpus[0]);
+    double ns = hostTimeNs(200000 * count, [&](size_t i) {
+        out.bytes.clear();
+        TextTranscoder transcoder(out);
+        transcoder.write(reinterpret_cast<const uint8_t *>(corpus[i % count]), strlen(corpus[i % count]));
+        transcoder.finish();
+    });
+    printf("normalize: %.1f MB/s, %.0f ns per message\n", corpusBytes / (double)count * 1000 / ns, ns);
+    return hostTestResult("bench_normalize");
+}
@@ -0,0 +1,126 @@
+// Streaming UTF-8 transcoding: output does not depend on how the input is
+// split across write() calls, no message allocates, and throughput per
+// message.
+#include "host_test.h"
+#include "src/printer/TextTranscoder.h"
+#include <new>
+#include <stdlib.h>
+#include <string>
+
+static size_t allocations;
+
+void *operator new(size_t size)
+{
+    allocations++;
+    void *p = malloc(size ? size : 1);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+struct StringPrint : Print
+{
+    std::string bytes;
+    size_t write(uint8_t c) override
+    {
+        bytes += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t *data, size_t len) override
+    {
+        bytes.append(reinterpret_cast<const char *>(data), len);
+        return len;
+    }
+};
+
+struct NullPrint : Print
+{
+    size_t count = 0;
+    size_t write(uint8_t) override
+    {
+        count++;
+        return 1;
+    }
+    size_t write(const uint8_t *, size_t len) override
+    {
+        count += len;
+        return len;
+    }
+};
+
+static const char *const samples[] = {
+    "Hello world, how are you doing today?",
+    "Gr\xC3\xBC\xC3\x9F" "e aus K\xC3\xB6ln \xF0\x9F\x98\x80 and \xF0\x9F\x8E\x89\xF0\x9F\x8E\x89 party",
+    "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\xBC\xD0\xB8\xD1\x80",
+    "Cafe\xCC\x81 \xE2\x80\x9Cquoted\xE2\x80\x9D",
+    "x\xC0\xAFy",
+    "a\xE0\x80\x80z",
+    "\xED\xA0\x80",
+    "\xF4\x90\x80\x80",
+    "trunc\xE2\x82",
+    "\xF0\x9F\x98",
+    "ok\x80\xBF!",
+};
+
+static std::string transcode(const std::string &in, size_t chunk)
+{
+    StringPrint out;
+    TextTranscoder text(out);
+    for (size_t i = 0; i < in.size(); i += chunk)
+    {
+        text.write(reinterpret_cast<const uint8_t *>(in.data()) + i, std::min(chunk, in.size() - i));
+    }
+    text.finish();
+    return out.bytes;
+}
+
+int main()
+{
+    for (const char *sample : samples)
+    {
+        std::string in(sample);
+        std::string whole = transcode(in, in.size() ? in.size() : 1);
+        for (size_t chunk = 1; chunk < 6; chunk++)
+        {
+            if (transcode(in, chunk) != whole)
+            {
+                fprintf(stderr, "chunk %zu changes the output of \"%s\"\n", chunk, sample);
+                CHECK(transcode(in, chunk) == whole);
+            }
+        }
+    }
+
+    NullPrint sink;
+    const size_t calls = 200000;
+    for (const char *sample : samples)
+    {
+        size_t len = strlen(sample);
+        if (len < 16)
+        {
+            continue;
+        }
+        size_t before = allocations;
+        double ns = hostTimeNs(calls, [&](size_t) {
+            TextTranscoder text(sink);
+            text.write(reinterpret_cast<const uint8_t *>(sample), len);
+            text.finish();
+        });
+        double perMessage = (double)(allocations - before) / calls;
+        CHECK(perMessage == 0);
+        printf("utf8_stream: %3zu bytes, %6.0f ns, %.1f MB/s, %.1f allocations per message\n", len, ns,
+               len * 1000.0 / ns, perMessage);
+    }
+    return hostTestResult("bench_utf8_stream");
+}
@@ -0,0 +1,264 @@
+// Host side of the stubs: clock, serial ports, FreeRTOS tasks on threads,
+// and silent stand-ins for the BLE log and stats characteristics.
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "src/printer/DeviceStats.h"
+#include "src/printer/MeshtasticBLELogger.h"
+#include "host_test.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdarg.h>
+#include <sys/ioctl.h>
+#include <thread>
+#include <unistd.h>
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+
+static const auto startTime = std::chrono::steady_clock::now();
+static std::atomic<int64_t> skippedUs;
+
+int64_t esp_timer_get_time()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime)
+               .count() +
+           skippedUs.load();
+}
+
+void hostSkipMs(uint32_t ms)
+{
+    skippedUs += (int64_t)ms * 1000;
+}
+
+uint32_t millis()
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+uint32_t micros()
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void pinMode(int, int)
+{
+}
+
+int digitalRead(int)
+{
+    return LOW;
+}
+
+size_t Print::printFormatted(const char *format, ...)
+{
+    char text[48];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    return len > 0 ? write(reinterpret_cast<const uint8_t *>(text), strlen(text)) : 0;
+}
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length)
+{
+    size_t n = 0;
+    while (n < length)
+    {
+        int c = read();
+        if (c < 0)
+        {
+            break;
+        }
+        buffer[n++] = (uint8_t)c;
+    }
+    return n;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    if (fd < 0)
+    {
+        written.append(reinterpret_cast<const char *>(buffer), size);
+        return size;
+    }
+    ssize_t n = ::write(fd, buffer, size);
+    return n > 0 ? (size_t)n : 0;
+}
+
+int HardwareSerial::available()
+{
+    int n = 0;
+    return fd >= 0 && ioctl(fd, FIONREAD, &n) == 0 ? n : 0;
+}
+
+int HardwareSerial::read()
+{
+    uint8_t c;
+    return readBytes(&c, 1) == 1 ? c : -1;
+}
+
+size_t HardwareSerial::readBytes(uint8_t *buffer, size_t length)
+{
+    if (fd < 0)
+    {
+        return 0;
+    }
+    ssize_t n = ::read(fd, buffer, length);
+    return n > 0 ? (size_t)n : 0;
+}
+
+// A task is a detached thread with a notification count.
+struct HostTask
+{
+    std::mutex lock;
+    std::condition_variable wake;
+    uint32_t notified = 0;
+};
+
+static thread_local HostTask *currentTask;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *, uint32_t, void *param, UBaseType_t,
+                                   TaskHandle_t *handle, BaseType_t)
+{
+    HostTask *task = new HostTask;
+    *handle = task;
+    std::thread([code, param, task] {
+        currentTask = task;
+        code(param);
+    }).detach();
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    HostTask *task = currentTask;
+    std::unique_lock<std::mutex> guard(task->lock);
+    auto ready = [task] { return task->notified != 0; };
+    if (ticks == portMAX_DELAY)
+    {
+        task->wake.wait(guard, ready);
+    }
+    else
+    {
+        task->wake.wait_for(guard, std::chrono::milliseconds(ticks), ready);
+    }
+    uint32_t count = task->notified;
+    task->notified = clearOnExit ? 0 : (count ? count - 1 : 0);
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        task->notified++;
+    }
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t)
+{
+    return 0;
+}
+
+// Binary semaphores and mutexes are both a count of one.
+struct HostSemaphore
+{
+    std::mutex lock;
+    std::condition_variable wake;
+    bool available;
+};
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    return new HostSemaphore{{}, {}, false};
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new HostSemaphore{{}, {}, true};
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> guard(semaphore->lock);
+    auto ready = [semaphore] { return semaphore->available; };
+    if (ticks == portMAX_DELAY)
+    {
+        semaphore->wake.wait(guard, ready);
+    }
+    else if (!semaphore->wake.wait_for(guard, std::chrono::milliseconds(ticks), ready))
+    {
+        return pdFALSE;
+    }
+    semaphore->available = false;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    {
+        std::lock_guard<std::mutex> guard(semaphore->lock);
+        semaphore->available = true;
+    }
+    semaphore->wake.notify_one();
+    return pdTRUE;
+}
+
+// Log lines go to stderr when HOST_LOG is set.
+void bleLog(const char *msg)
+{
+    if (getenv("HOST_LOG"))
+    {
+        fprintf(stderr, "log: %s\n", msg);
+    }
+}
+
+void bleLogf(const char *fmt, ...)
+{
+    char msg[160];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, args);
+    va_end(args);
+    bleLog(msg);
+}
+
+void statsRegisterProvider(StatsProvider)
+{
+}
+
+void statsAppend(std::string &, const char *, uint32_t)
+{
+}
+
+void statsAppend(std::string &, const char *, const char *)
+{
+}
+
+void statsBootMark(const char *)
+{
+}
+
+void statsRefresh(bool)
+{
+}
+
+int hostTestFailures;
@@ -0,0 +1,54 @@
+#pragma once
+
+// Minimal checks for the host tests: failures are printed and counted, and
+// main() returns hostTestResult().
+
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+extern int hostTestFailures;
+
+#define CHECK(cond)                                                                                                   \
+    do                                                                                                                \
+    {                                                                                                                 \
+        if (!(cond))                                                                                                  \
+        {                                                                                                             \
+            hostTestFailures++;                                                                                       \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);                                  \
+        }                                                                                                             \
+    } while (0)
+
+inline int hostTestResult(const char *name)
+{
+    printf("%s: %s\n", name, hostTestFailures ? "FAIL" : "ok");
+    return hostTestFailures ? 1 : 0;
+}
+
+// Moves millis() and esp_timer_get_time() forward, for code that waits on
+// timeouts of several seconds.
+void hostSkipMs(uint32_t ms);
+
+// FNV-1a, to compare byte streams against a golden file.
+inline uint32_t hostHash(const void *data, size_t len)
+{
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+    {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Wall time per call of fn, in nanoseconds, over `calls` calls.
+template <typename Fn> double hostTimeNs(size_t calls, Fn fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < calls; i++)
+    {
+        fn(i);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+}
@@ -0,0 +1,32 @@
+// Stand-in for PrinterControl's settings, which live in flash on the
+// device. Tests change hostSettings and call applyPrinterSettings().
+#include "printer_settings.h"
+#include "src/printer/Bontastic_Thermal.h"
+
+extern Bontastic_Thermal printer;
+
+PrinterSettings hostSettings = {11, 120, 40, 10, 2, 30, 0, 0, 0, 0, 0, 2, 23, "Bontastic", "123456", 1, 2, 22};
+
+const PrinterSettings &getPrinterSettings()
+{
+    return hostSettings;
+}
+
+bool printerPaperOut()
+{
+    return false;
+}
+
+void applyPrinterSettings()
+{
+    printer.setCodePage(hostSettings.codePage);
+    printer.justify('L');
+    if (hostSettings.decorations & 0x10)
+    {
+        printer.upsideDownOn();
+    }
+    else
+    {
+        printer.upsideDownOff();
+    }
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "src/printer/PrinterControl.h"
+
+extern PrinterSettings hostSettings;
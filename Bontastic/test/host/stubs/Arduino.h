@@ -0,0 +1,120 @@
+#pragma once
+
+// Just enough of the Arduino core to build the sketch's sources on a host.
+// The serial ports record what is written to them, or talk to a file
+// descriptor such as a pseudo-terminal once one is attached.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+
+#define PROGMEM
+#define F(x) x
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define SERIAL_8N1 0
+#define constrain(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+
+typedef const char __FlashStringHelper;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void pinMode(int pin, int mode);
+int digitalRead(int pin);
+
+inline size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+    if (size)
+    {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = 0;
+    }
+    return len;
+}
+
+class String
+{
+public:
+    String(const char *s = "") : _s(s) {}
+    const char *c_str() const { return _s.c_str(); }
+    size_t length() const { return _s.size(); }
+
+private:
+    std::string _s;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            write(buffer[i]);
+        }
+        return size;
+    }
+    size_t write(const char *s) { return write(reinterpret_cast<const uint8_t *>(s), strlen(s)); }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long v) { return printFormatted("%ld", v); }
+    size_t print(unsigned long v) { return printFormatted("%lu", v); }
+    size_t print(int v) { return print((long)v); }
+    size_t print(unsigned v) { return print((unsigned long)v); }
+    size_t print(double v, int digits = 2) { return printFormatted("%.*f", digits, v); }
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(T v) { return print(v) + println(); }
+
+private:
+    size_t printFormatted(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    virtual size_t readBytes(uint8_t *buffer, size_t length);
+    size_t write(uint8_t) override { return 1; }
+    using Print::write;
+};
+
+class HardwareSerial : public Stream
+{
+public:
+    // Everything written while no descriptor is attached.
+    std::string written;
+    // Attached descriptor (e.g. the slave side of a pty), or -1.
+    int fd = -1;
+
+    void begin(unsigned long baud, int config = 0, int rxPin = -1, int txPin = -1) {}
+    void end() {}
+    void setRxBufferSize(size_t) {}
+    void setTxBufferSize(size_t) {}
+    void flush() {}
+    int availableForWrite() { return 4096; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int available() override;
+    int read() override;
+    size_t readBytes(uint8_t *buffer, size_t length) override;
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
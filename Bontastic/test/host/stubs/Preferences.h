@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Nothing is persisted on the host; every read returns its default.
+class Preferences
+{
+public:
+    bool begin(const char *, bool = false) { return true; }
+    void end() {}
+    bool clear() { return true; }
+    bool remove(const char *) { return true; }
+    bool isKey(const char *) { return false; }
+    String getString(const char *, const char *fallback) { return String(fallback); }
+    size_t putString(const char *, const char *) { return 0; }
+    uint8_t getUChar(const char *, uint8_t fallback = 0) { return fallback; }
+    size_t putUChar(const char *, uint8_t) { return 0; }
+    uint32_t getUInt(const char *, uint32_t fallback = 0) { return fallback; }
+    size_t putUInt(const char *, uint32_t) { return 0; }
+    size_t getBytesLength(const char *) { return 0; }
+    size_t getBytes(const char *, void *, size_t) { return 0; }
+    size_t putBytes(const char *, const void *, size_t) { return 0; }
+};
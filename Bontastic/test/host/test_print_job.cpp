@@ -0,0 +1,167 @@
+// Print jobs: the bytes a message job sends are checked against
+// golden/print_job.txt, and reprints and emoji sprite slots are checked
+// across jobs. Run with --update to rewrite the golden file after an
+// intended output change.
+#include "host_test.h"
+#include "printer_settings.h"
+#include "src/printer/EmojiSprites.h"
+#include "src/printer/PrintHelpers.h"
+#include "src/printer/PrintJob.h"
+#include <string>
+#include <vector>
+
+static const char *goldenPath = "golden/print_job.txt";
+
+static const char *const messages[] = {
+    "Hello mesh",
+    "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBA\xD0\xB0\xD0\xBA \xD0\xB4\xD0\xB5\xD0\xBB\xD0\xB0?",
+    "Caf\xC3\xA9 \xE2\x80\x9Cquoted\xE2\x80\x9D \xF0\x9F\x98\x80 and \xE4\xB8\xAD\xE6\x96\x87 text",
+    "Interrobang \xE2\x80\xBD next to \xE4\xB8\xAD\xE6\x96\x87 on one line",
+    "A long line that will certainly need wrapping because it is longer than thirty-two columns",
+};
+
+struct Case
+{
+    std::string name;
+    uint32_t size;
+    uint32_t hash;
+};
+
+static size_t countSpriteDefinitions(const std::string &bytes)
+{
+    size_t n = 0;
+    for (size_t i = 0; i + 2 < bytes.size(); i++)
+    {
+        n += bytes[i] == 0x1B && bytes[i + 1] == '&' && bytes[i + 2] == 3;
+    }
+    return n;
+}
+
+static std::string printMessage(const char *text)
+{
+    Serial.written.clear();
+    printTextMessage(reinterpret_cast<const uint8_t *>(text), strlen(text), "Alice", 1700000000);
+    return Serial.written;
+}
+
+// Every message in both orientations, each from fresh sprite slots so the
+// cases do not depend on each other.
+static std::vector<Case> renderCases()
+{
+    std::vector<Case> cases;
+    for (uint8_t decorations : {0x00, 0x10})
+    {
+        hostSettings.decorations = decorations;
+        applyPrinterSettings();
+        for (size_t i = 0; i < sizeof(messages) / sizeof(messages[0]); i++)
+        {
+            emojiSlotsReset();
+            std::string sent = printMessage(messages[i]);
+            // The job goes out exactly as rendered.
+            const PrintJob &job = lastPrintJob();
+            CHECK(sent.size() == job.size() && !memcmp(sent.data(), job.data(), job.size()));
+
+            char name[32];
+            snprintf(name, sizeof(name), "%s-%zu", decorations ? "upside-down" : "upright", i);
+            cases.push_back({name, (uint32_t)sent.size(), hostHash(sent.data(), sent.size())});
+        }
+    }
+    hostSettings.decorations = 0;
+    applyPrinterSettings();
+    return cases;
+}
+
+static void checkGolden(const std::vector<Case> &cases, bool update)
+{
+    if (update)
+    {
+        FILE *f = fopen(goldenPath, "w");
+        CHECK(f);
+        if (f)
+        {
+            fprintf(f, "# case size fnv1a\n");
+            for (const Case &c : cases)
+            {
+                fprintf(f, "%s %u %08x\n", c.name.c_str(), c.size, c.hash);
+            }
+            fclose(f);
+        }
+        return;
+    }
+    FILE *f = fopen(goldenPath, "r");
+    CHECK(f);
+    if (!f)
+    {
+        return;
+    }
+    char line[96];
+    size_t matched = 0;
+    while (fgets(line, sizeof(line), f))
+    {
+        char name[32];
+        unsigned size;
+        unsigned hash;
+        if (line[0] == '#' || sscanf(line, "%31s %u %x", name, &size, &hash) != 3)
+        {
+            continue;
+        }
+        for (const Case &c : cases)
+        {
+            if (c.name == name)
+            {
+                if (c.size != size || c.hash != hash)
+                {
+                    fprintf(stderr, "%s: %u bytes %08x, golden %u bytes %08x\n", name, c.size, c.hash, size, hash);
+                }
+                CHECK(c.size == size && c.hash == hash);
+                matched++;
+            }
+        }
+    }
+    fclose(f);
+    CHECK(matched == cases.size());
+}
+
+// A sprite stays in its slot across jobs, and a reprint puts back the
+// slots its job was rendered against.
+static void checkSpriteSlots()
+{
+    const char *smile = "smile \xF0\x9F\x98\x80";
+    const char *heart = "heart \xE2\x9D\xA4";
+    emojiSlotsReset();
+
+    std::string first = printMessage(smile);
+    CHECK(countSpriteDefinitions(first) == 1);
+    std::string second = printMessage(smile);
+    CHECK(countSpriteDefinitions(second) == 0);
+    CHECK(second.size() < first.size());
+
+    std::string heartJob = printMessage(heart);
+    Serial.written.clear();
+    CHECK(reprintLastJob());
+    // Nothing has used the slots since the heart job, so the reprint is the
+    // job alone.
+    CHECK(Serial.written == heartJob);
+
+    // After a reset, reprinting the smile job first defines the two sprites
+    // the job was rendered against, then sends the job unchanged.
+    std::string smileJob = printMessage(smile);
+    CHECK(countSpriteDefinitions(smileJob) == 0);
+    emojiSlotsReset();
+    Serial.written.clear();
+    CHECK(reprintLastJob());
+    size_t restoreBytes = Serial.written.size() - smileJob.size();
+    CHECK(Serial.written.size() > smileJob.size());
+    CHECK(countSpriteDefinitions(Serial.written.substr(0, restoreBytes)) == 2);
+    CHECK(Serial.written.compare(restoreBytes, smileJob.size(), smileJob) == 0);
+}
+
+int main(int argc, char **argv)
+{
+    bool update = argc > 1 && !strcmp(argv[1], "--update");
+    updatePrinterPins(hostSettings.printerRxPin, hostSettings.printerTxPin);
+
+    checkGolden(renderCases(), update);
+    checkSpriteSlots();
+    return hostTestResult("print_job");
+}
@@ -0,0 +1,197 @@
+// SerialLink against a stand-in radio on a pseudo-terminal. The radio
+// reads the wake bytes and a framed ToRadio, then streams framed FromRadio
+// records mixed with debug log lines, stray start bytes and a start pair
+// with a bad length, in uneven writes so frames split across reads.
+#include "host_test.h"
+#include "src/mesh/FromRadioScan.h"
+#include "src/mesh/MeshIngest.h"
+#include "src/mesh/SerialLink.h"
+#include "src/nanopb/pb_decode.h"
+#include "src/nanopb/pb_encode.h"
+#include "src/protobufs/mesh.pb.h"
+#include <mutex>
+#include <pty.h>
+#include <termios.h>
+#include <unistd.h>
+#include <vector>
+
+static const int packetCount = 2000;
+static const size_t wakeBytes = 32;
+
+static std::mutex receivedLock;
+static std::vector<uint32_t> receivedIds;
+static int rebootedCount;
+static int scanFailures;
+
+// Takes the place of the ingest queue.
+void meshIngestRecord(uint8_t radio, const uint8_t *data, size_t len, uint32_t)
+{
+    FromRadioView view;
+    std::lock_guard<std::mutex> guard(receivedLock);
+    CHECK(radio == 0);
+    if (!scanFromRadio(data, len, view))
+    {
+        scanFailures++;
+        return;
+    }
+    if (view.kind == FromRadioKind::Packet)
+    {
+        receivedIds.push_back(view.id);
+    }
+    else if (view.kind == FromRadioKind::Rebooted)
+    {
+        rebootedCount++;
+    }
+}
+
+static void appendFrame(std::vector<uint8_t> &stream, const uint8_t *data, size_t len)
+{
+    const uint8_t header[] = {meshFrameStart1, meshFrameStart2, (uint8_t)(len >> 8), (uint8_t)len};
+    stream.insert(stream.end(), header, header + sizeof(header));
+    stream.insert(stream.end(), data, data + len);
+}
+
+static size_t encodeTextPacket(uint32_t id, size_t payloadLen, uint8_t *out, size_t size)
+{
+    meshtastic_FromRadio record = meshtastic_FromRadio_init_zero;
+    record.which_payload_variant = meshtastic_FromRadio_packet_tag;
+    meshtastic_MeshPacket &p = record.packet;
+    p.from = 0x1234;
+    p.to = 0xFFFFFFFF;
+    p.id = id;
+    p.which_payload_variant = meshtastic_MeshPacket_decoded_tag;
+    p.decoded.portnum = meshtastic_PortNum_TEXT_MESSAGE_APP;
+    p.decoded.payload.size = payloadLen;
+    memset(p.decoded.payload.bytes, 'x', payloadLen);
+    pb_ostream_t stream = pb_ostream_from_buffer(out, size);
+    CHECK(pb_encode(&stream, meshtastic_FromRadio_fields, &record));
+    return stream.bytes_written;
+}
+
+static void readExactly(int fd, uint8_t *buffer, size_t len)
+{
+    size_t got = 0;
+    while (got < len)
+    {
+        ssize_t n = read(fd, buffer + got, len - got);
+        if (n > 0)
+        {
+            got += n;
+        }
+    }
+}
+
+// Device to radio: wake bytes, then one framed want_config request.
+static void checkSend(int radio)
+{
+    meshtastic_ToRadio request = meshtastic_ToRadio_init_zero;
+    request.which_payload_variant = meshtastic_ToRadio_want_config_id_tag;
+    request.want_config_id = 69420;
+    uint8_t encoded[16];
+    pb_ostream_t ostream = pb_ostream_from_buffer(encoded, sizeof(encoded));
+    CHECK(pb_encode(&ostream, meshtastic_ToRadio_fields, &request));
+    CHECK(serialLinkSend(encoded, ostream.bytes_written));
+
+    uint8_t got[wakeBytes + 4 + sizeof(encoded)];
+    readExactly(radio, got, wakeBytes + 4 + ostream.bytes_written);
+    for (size_t i = 0; i < wakeBytes; i++)
+    {
+        CHECK(got[i] == meshFrameStart2);
+    }
+    const uint8_t *header = got + wakeBytes;
+    CHECK(header[0] == meshFrameStart1 && header[1] == meshFrameStart2);
+    size_t len = header[2] << 8 | header[3];
+    CHECK(len == ostream.bytes_written);
+
+    meshtastic_ToRadio back = meshtastic_ToRadio_init_zero;
+    pb_istream_t istream = pb_istream_from_buffer(header + 4, len);
+    CHECK(pb_decode(&istream, meshtastic_ToRadio_fields, &back));
+    CHECK(back.want_config_id == 69420);
+}
+
+// Radio to device: every packet arrives once and in order, and the noise
+// between frames is skipped.
+static void checkReceive(int radio)
+{
+    std::vector<uint8_t> stream;
+    uint8_t record[meshFrameMaxBytes];
+    const char *logLine = "DEBUG | 12:00:01 [Router] Received text msg from=0x1234\r\n";
+    const uint8_t badLength[] = {meshFrameStart1, meshFrameStart2, 0x7F, 0xFF};
+    for (int id = 1; id <= packetCount; id++)
+    {
+        if (id % 50 == 0)
+        {
+            stream.insert(stream.end(), logLine, logLine + strlen(logLine));
+        }
+        if (id % 333 == 0)
+        {
+            stream.insert(stream.end(), badLength, badLength + sizeof(badLength));
+        }
+        if (id % 97 == 0)
+        {
+            stream.push_back(meshFrameStart1);
+        }
+        appendFrame(stream, record, encodeTextPacket(id, 1 + (id * 37) % 233, record, sizeof(record)));
+    }
+    const uint8_t rebooted[] = {0x40, 0x01}; // FromRadio.rebooted = true
+    appendFrame(stream, rebooted, sizeof(rebooted));
+
+    for (size_t offset = 0; offset < stream.size();)
+    {
+        size_t n = std::min<size_t>(stream.size() - offset, 1 + offset % 301);
+        ssize_t written = write(radio, stream.data() + offset, n);
+        if (written > 0)
+        {
+            offset += written;
+        }
+    }
+
+    // The reader sees the reboot record last.
+    for (int waited = 0; waited < 5000; waited++)
+    {
+        {
+            std::lock_guard<std::mutex> guard(receivedLock);
+            if (rebootedCount)
+            {
+                break;
+            }
+        }
+        delay(1);
+    }
+
+    std::lock_guard<std::mutex> guard(receivedLock);
+    CHECK(rebootedCount == 1);
+    CHECK(scanFailures == 0);
+    CHECK(receivedIds.size() == (size_t)packetCount);
+    for (size_t i = 0; i < receivedIds.size(); i++)
+    {
+        if (receivedIds[i] != i + 1)
+        {
+            CHECK(receivedIds[i] == i + 1);
+            break;
+        }
+    }
+}
+
+int main()
+{
+    int radio;
+    int device;
+    CHECK(openpty(&radio, &device, nullptr, nullptr, nullptr) == 0);
+    for (int fd : {radio, device})
+    {
+        termios raw;
+        tcgetattr(fd, &raw);
+        cfmakeraw(&raw);
+        tcsetattr(fd, TCSANOW, &raw);
+    }
+    Serial2.fd = device;
+
+    CHECK(serialLinkBegin());
+    checkSend(radio);
+    checkReceive(radio);
+    int result = hostTestResult("serial_link");
+    // The reader task never returns.
+    fflush(stdout);
+    _exit(result);
+}
@@ -0,0 +1,172 @@
+// Store & Forward catch-up through packet dedup: messages heard live while
+// the paper was out come back from the router with their original sender
+// and id, and must print on catch-up rather than be dropped as duplicates.
+// The link, printer and node names are stand-ins; packets pass through
+// packetDedupSeen()/packetDedupRecord() the way ingest hands them on.
+#include "host_test.h"
+#include "src/mesh/MeshIngest.h"
+#include "src/mesh/MeshLink.h"
+#include "src/mesh/NodeDb.h"
+#include "src/mesh/PacketDedup.h"
+#include "src/mesh/StoreForward.h"
+#include "src/nanopb/pb_encode.h"
+#include "src/printer/PrintHelpers.h"
+#include "src/protobufs/portnums.pb.h"
+#include "src/protobufs/storeforward.pb.h"
+#include <string>
+#include <vector>
+
+static const uint32_t routerNode = 0xAA;
+static const uint32_t senderNode = 0x1234;
+
+static bool paperOut;
+static std::vector<std::string> printed;
+static int historyRequests;
+
+bool meshLinkUp()
+{
+    return true;
+}
+
+bool meshLinkSendData(uint32_t, uint8_t, uint16_t port, const uint8_t *, size_t)
+{
+    historyRequests += port == meshtastic_PortNum_STORE_FORWARD_APP;
+    return true;
+}
+
+bool meshIngestPending()
+{
+    return false;
+}
+
+bool printerPaperOut()
+{
+    return paperOut;
+}
+
+const char *nodeDbName(uint32_t)
+{
+    return nullptr;
+}
+
+void printInfo(const char *, const char *)
+{
+}
+
+void printTextMessage(const uint8_t *data, size_t size, const char *, uint32_t)
+{
+    printed.emplace_back(reinterpret_cast<const char *>(data), size);
+}
+
+void printTextDigest(const TextMessage *messages, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        printed.emplace_back(reinterpret_cast<const char *>(messages[i].data), messages[i].size);
+    }
+}
+
+// Ingest and the sketch's handlers, reduced to what matters here. Returns
+// false when dedup drops the packet.
+static bool deliver(uint16_t port, uint32_t from, uint32_t id, uint32_t rxTime, const uint8_t *payload, size_t size)
+{
+    if (packetDedupSeen(port, from, id))
+    {
+        return false;
+    }
+    packetDedupRecord(port, from, id);
+
+    MeshEvent e = {};
+    e.kind = MeshEventKind::Packet;
+    e.port = port;
+    e.from = from;
+    e.id = id;
+    e.rxTime = rxTime;
+    e.size = (uint16_t)size;
+    memcpy(e.payload, payload, size);
+    storeForwardClock(rxTime);
+    if (port == meshtastic_PortNum_STORE_FORWARD_APP)
+    {
+        storeForwardPacket(e);
+    }
+    else if (!paperOut)
+    {
+        printTextMessage(payload, size, "", rxTime);
+        storeForwardPrinted(rxTime);
+    }
+    return true;
+}
+
+static bool deliverText(uint32_t id, uint32_t rxTime, const char *text)
+{
+    return deliver(meshtastic_PortNum_TEXT_MESSAGE_APP, senderNode, id, rxTime,
+                   reinterpret_cast<const uint8_t *>(text), strlen(text));
+}
+
+static bool deliverRouter(uint32_t from, uint32_t id, uint32_t rxTime, meshtastic_StoreAndForward &sf)
+{
+    uint8_t payload[meshtastic_StoreAndForward_size];
+    pb_ostream_t stream = pb_ostream_from_buffer(payload, sizeof(payload));
+    CHECK(pb_encode(&stream, meshtastic_StoreAndForward_fields, &sf));
+    return deliver(meshtastic_PortNum_STORE_FORWARD_APP, from, id, rxTime, payload, stream.bytes_written);
+}
+
+static bool deliverReplay(uint32_t id, uint32_t rxTime, const char *text)
+{
+    meshtastic_StoreAndForward sf = meshtastic_StoreAndForward_init_zero;
+    sf.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_TEXT_BROADCAST;
+    sf.which_variant = meshtastic_StoreAndForward_text_tag;
+    sf.variant.text.size = strlen(text);
+    memcpy(sf.variant.text.bytes, text, sf.variant.text.size);
+    return deliverRouter(senderNode, id, rxTime, sf);
+}
+
+int main()
+{
+    packetDedupSetup();
+    storeForwardSetup();
+    storeForwardLoop();
+
+    meshtastic_StoreAndForward heartbeat = meshtastic_StoreAndForward_init_zero;
+    heartbeat.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_HEARTBEAT;
+    CHECK(deliverRouter(routerNode, 1, 0, heartbeat));
+    CHECK(deliverText(100, 1000, "before"));
+
+    // Heard live while the paper is out: nothing prints.
+    paperOut = true;
+    storeForwardLoop();
+    CHECK(deliverText(200, 1100, "missed one"));
+    CHECK(deliverText(201, 1200, "missed two"));
+    CHECK(printed.size() == 1);
+
+    // Paper back: the history since "before" is requested.
+    paperOut = false;
+    storeForwardLoop();
+    CHECK(historyRequests == 1);
+
+    meshtastic_StoreAndForward history = meshtastic_StoreAndForward_init_zero;
+    history.rr = meshtastic_StoreAndForward_RequestResponse_ROUTER_HISTORY;
+    history.which_variant = meshtastic_StoreAndForward_history_tag;
+    history.variant.history.history_messages = 3;
+    CHECK(deliverRouter(routerNode, 2, 0, history));
+    // The router resends with the original sender and id.
+    CHECK(deliverReplay(100, 1000, "before"));
+    CHECK(deliverReplay(200, 1100, "missed one"));
+    CHECK(deliverReplay(201, 1200, "missed two"));
+    // A live packet heard again is still a duplicate.
+    CHECK(!deliverText(200, 1100, "missed one"));
+
+    for (int i = 0; i < 4; i++)
+    {
+        hostSkipMs(3000);
+        storeForwardLoop();
+    }
+    CHECK(printed.size() == 3);
+    if (printed.size() == 3)
+    {
+        CHECK(printed[0] == "before");
+        CHECK(printed[1] == "missed one");
+        CHECK(printed[2] == "missed two");
+    }
+    return hostTestResult("store_forward");
+}
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Generate src/printer/assets/codepages.h, reverse tables for ESC t pages.
+
+For every printer code page that Python has a codec for, the upper half
+(0x80-0xFF) is decoded and stored as codepoint -> byte pairs sorted by
+codepoint, so the firmware can binary search a page for a character. The
+lower half is ASCII on all of these pages and is not stored.
+
+Page numbers follow the printer's ESC t table (see codePageOptions in
+web/index.html).
+
+    python3 tools/gen_code_pages.py
+"""
+
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TARGET = os.path.join(HERE, "..", "src", "printer", "assets", "codepages.h")
+
+PAGES = [
+    (0, "cp437"),
+    (2, "cp850"),
+    (3, "cp860"),
+    (4, "cp863"),
+    (5, "cp865"),
+    (6, "cp1251"),
+    (7, "cp866"),
+    (15, "cp862"),
+    (16, "cp1252"),
+    (17, "cp1253"),
+    (18, "cp852"),
+    (19, "cp858"),
+    (22, "cp864"),
+    (23, "latin_1"),
+    (24, "cp737"),
+    (25, "cp1257"),
+    (27, "cp720"),
+    (28, "cp855"),
+    (29, "cp857"),
+    (30, "cp1250"),
+    (31, "cp775"),
+    (32, "cp1254"),
+    (33, "cp1255"),
+    (34, "cp1256"),
+    (35, "cp1258"),
+    (36, "iso8859_2"),
+    (37, "iso8859_3"),
+    (38, "iso8859_4"),
+    (39, "iso8859_5"),
+    (40, "iso8859_6"),
+    (41, "iso8859_7"),
+    (42, "iso8859_8"),
+    (43, "iso8859_9"),
+    (44, "iso8859_15"),
+    (46, "cp856"),
+    (47, "cp874"),
+]
+
+
+def reverse_table(codec):
+    pairs = {}
+    for b in range(0x80, 0x100):
+        try:
+            ch = bytes([b]).decode(codec)
+        except UnicodeDecodeError:
+            continue
+        cp = ord(ch)
+        # C1 controls are not printable glyphs, and keep the first byte when
+        # a page maps one character twice.
+        if 0x80 <= cp < 0xA0 or cp > 0xFFFF or cp in pairs:
+            continue
+        pairs[cp] = b
+    return sorted(pairs.items())
+
+
+def main():
+    pages = []
+    cps = []
+    values = []
+    for number, codec in PAGES:
+        table = reverse_table(codec)
+        pages.append((number, len(cps), len(table), codec))
+        cps += [cp for cp, _ in table]
+        values += [b for _, b in table]
+
+    out = [
+        "#ifndef _codepages_h_",
+        "#define _codepages_h_",
+        "",
+        "// Generated by tools/gen_code_pages.py - do not edit.",
+        "",
+        f"#define codepages_count {len(pages)}",
+        "",
+        "struct CodePageTable",
+        "{",
+        "    uint8_t page;",
+        "    uint16_t first;",
+        "    uint8_t count;",
+        "};",
+        "",
+        "static const CodePageTable PROGMEM codepages_tables[] = {",
+    ]
+    for number, first, count, codec in pages:
+        out.append(f"    {{{number}, {first}, {count}}}, // {codec}")
+    out += ["};", "", "static const uint16_t PROGMEM codepages_codepoints[] = {"]
+    for i in range(0, len(cps), 12):
+        out.append("    " + ", ".join(f"0x{cp:04X}" for cp in cps[i:i + 12]) + ",")
+    out += ["};", "", "static const uint8_t PROGMEM codepages_bytes[] = {"]
+    for i in range(0, len(values), 16):
+        out.append("    " + ", ".join(f"0x{b:02X}" for b in values[i:i + 16]) + ",")
+    out += ["};", "", "#endif", ""]
+
+    with open(TARGET, "w", encoding="ascii", newline="\n") as f:
+        f.write("\n".join(out))
+    total = len(pages) * 4 + len(cps) * 3
+    print(f"{len(pages)} pages, {len(cps)} entries, {total} bytes -> {os.path.relpath(TARGET)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Generate src/printer/assets/emojisprites.h from emoji_sprites.txt.
+
+Sprites are packed in the printer's user-defined character format for font A
+(ESC & with y = 3): 12 columns, each 3 bytes from top to bottom, MSB first.
+Aliases share one atlas entry.
+
+    python3 tools/gen_emoji_sprites.py
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "emoji_sprites.txt")
+SHORTCODES = os.path.join(HERE, "emoji_shortcodes.txt")
+TARGET = os.path.join(HERE, "..", "src", "printer", "assets", "emojisprites.h")
+
+WIDTH = 12
+ART_ROWS = 12
+CELL_ROWS = 24
+TOP = (CELL_ROWS - ART_ROWS) // 2
+
+
+def load_shortcodes():
+    known = set()
+    with open(SHORTCODES, encoding="utf-8") as f:
+        for raw in f:
+            line = raw.split("#", 1)[0].strip()
+            if line:
+                known.add(int(line.split()[0], 16))
+    return known
+
+
+def load_sprites(path):
+    sprites = []
+    aliases = []
+    with open(path, encoding="utf-8") as f:
+        lines = [l.rstrip("\n") for l in f]
+    i = 0
+    while i < len(lines):
+        line = lines[i].strip()
+        i += 1
+        if not line or line.startswith("#"):
+            continue
+        parts = line.split()
+        cp = int(parts[0], 16)
+        if len(parts) == 4 and parts[2] == "=":
+            aliases.append((cp, int(parts[3], 16)))
+            continue
+        art = lines[i:i + ART_ROWS]
+        i += ART_ROWS
+        if len(art) != ART_ROWS or any(len(r) != WIDTH for r in art):
+            sys.exit(f"sprite U+{cp:X} is not {WIDTH}x{ART_ROWS}")
+        sprites.append((cp, art))
+    return sprites, aliases
+
+
+def pack(art):
+    rows = ["." * WIDTH] * TOP + art + ["." * WIDTH] * (CELL_ROWS - TOP - ART_ROWS)
+    out = []
+    for x in range(WIDTH):
+        for band in range(CELL_ROWS // 8):
+            v = 0
+            for bit in range(8):
+                if rows[band * 8 + bit][x] == "#":
+                    v |= 0x80 >> bit
+            out.append(v)
+    return out
+
+
+def main():
+    known = load_shortcodes()
+    sprites, aliases = load_sprites(SOURCE)
+    index = {cp: n for n, (cp, _) in enumerate(sprites)}
+    entries = [(cp, n) for cp, n in index.items()]
+    for cp, target in aliases:
+        entries.append((cp, index[target]))
+    entries.sort()
+    for cp, _ in entries:
+        if cp not in known:
+            sys.exit(f"U+{cp:X} has a sprite but no shortcode")
+
+    out = [
+        "#ifndef _emojisprites_h_",
+        "#define _emojisprites_h_",
+        "",
+        "// Generated by tools/gen_emoji_sprites.py from tools/emoji_sprites.txt - do not edit.",
+        "",
+        f"#define emojisprites_count {len(entries)}",
+        f"#define emojisprites_width {WIDTH}",
+        f"#define emojisprites_bytes {WIDTH * CELL_ROWS // 8}",
+        "",
+        "static const uint32_t PROGMEM emojisprites_codepoints[] = {",
+    ]
+    for i in range(0, len(entries), 8):
+        out.append("    " + ", ".join(f"0x{cp:05X}" for cp, _ in entries[i:i + 8]) + ",")
+    out += ["};", "", "static const uint8_t PROGMEM emojisprites_index[] = {"]
+    for i in range(0, len(entries), 16):
+        out.append("    " + ", ".join(str(n) for _, n in entries[i:i + 16]) + ",")
+    out += ["};", "", "static const uint8_t PROGMEM emojisprites_data[] = {"]
+    for cp, art in sprites:
+        data = pack(art)
+        out.append(f"    // U+{cp:X}")
+        for i in range(0, len(data), 12):
+            out.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 12]) + ",")
+    out += ["};", "", "#endif", ""]
+
+    with open(TARGET, "w", encoding="ascii", newline="\n") as f:
+        f.write("\n".join(out))
+    print(f"{len(entries)} emoji, {len(sprites)} sprites -> {os.path.relpath(TARGET)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Generate src/printer/EmojiTable.h from emoji_shortcodes.txt.
+
+The table is emitted as two sorted 16-bit codepoint arrays (BMP and plane 1)
+plus one shortcode pool indexed by 16-bit offsets, so lookups are a binary
+search and no per-entry string pointers end up in flash.
+
+Run from the sketch folder after editing the source list:
+
+    python3 tools/gen_emoji_table.py
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "emoji_shortcodes.txt")
+TARGET = os.path.join(HERE, "..", "src", "printer", "EmojiTable.h")
+
+
+def load(path):
+    entries = {}
+    with open(path, encoding="utf-8") as f:
+        for lineno, raw in enumerate(f, 1):
+            line = raw.split("#", 1)[0].strip()
+            if not line:
+                continue
+            cp_text, name = line.split()
+            cp = int(cp_text, 16)
+            if cp > 0x1FFFF:
+                sys.exit(f"{path}:{lineno}: U+{cp:X} is outside planes 0/1")
+            if cp in entries:
+                continue
+            entries[cp] = name
+    return sorted(entries.items())
+
+
+def emit_array(out, ctype, name, values, per_line=12, fmt="0x{:04X}"):
+    out.append(f"static const {ctype} {name}[] PROGMEM = {{")
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join(fmt.format(v) for v in values[i:i + per_line])
+        out.append(f"    {chunk},")
+    out.append("};")
+    out.append("")
+
+
+def main():
+    entries = load(SOURCE)
+    bmp = [(cp, name) for cp, name in entries if cp <= 0xFFFF]
+    smp = [(cp, name) for cp, name in entries if cp > 0xFFFF]
+
+    pool = ""
+    offsets = []
+    for _, name in bmp + smp:
+        offsets.append(len(pool))
+        pool += name
+    offsets.append(len(pool))
+    if len(pool) > 0xFFFF:
+        sys.exit("shortcode pool exceeds 16-bit offsets")
+
+    out = [
+        "#pragma once",
+        "#include <Arduino.h>",
+        "#include <stdint.h>",
+        "",
+        "// Generated by tools/gen_emoji_table.py from tools/emoji_shortcodes.txt - do not edit.",
+        "//",
+        "// Codepoints are sorted and split by plane so each fits in 16 bits. Entry i",
+        "// owns emojiShortcodePool[emojiShortcodeOffsets[i] .. emojiShortcodeOffsets[i + 1]),",
+        "// stored without the surrounding colons.",
+        "",
+        f"static const uint16_t emojiCount = {len(entries)};",
+        f"static const uint16_t emojiBmpCount = {len(bmp)};",
+        "",
+    ]
+    emit_array(out, "uint16_t", "emojiCodepoints", [cp & 0xFFFF for cp, _ in bmp + smp])
+    emit_array(out, "uint16_t", "emojiShortcodeOffsets", offsets, fmt="{}")
+
+    out.append("static const char emojiShortcodePool[] PROGMEM =")
+    line = ""
+    for _, name in bmp + smp:
+        if len(line) + len(name) > 100:
+            out.append(f'    "{line}"')
+            line = ""
+        line += name
+    out.append(f'    "{line}";')
+    out.append("")
+
+    with open(TARGET, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+    print(f"{len(entries)} emoji, pool {len(pool)} bytes -> {os.path.relpath(TARGET)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Generate src/printer/assets/gb2312.h, the Unicode -> GB2312 mapping.
+
+Hanzi in U+4E00-U+9FFF are stored as a presence bitmap with a running count
+per 32-bit word, so a lookup is one bit test and one popcount to find the
+GB2312 code in the value array. Everything else (punctuation, kana, Greek,
+Cyrillic, full-width forms) maps in runs where both codepoint and GB code
+step by one, stored as sorted ranges.
+
+    python3 tools/gen_gb2312.py
+"""
+
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TARGET = os.path.join(HERE, "..", "src", "printer", "assets", "gb2312.h")
+
+HAN_FIRST = 0x4E00
+HAN_LAST = 0x9FFF
+
+
+def gb_code(cp):
+    try:
+        b = chr(cp).encode("gb2312")
+    except UnicodeEncodeError:
+        return None
+    return (b[0] << 8) | b[1] if len(b) == 2 else None
+
+
+def main():
+    words = (HAN_LAST - HAN_FIRST + 1 + 31) // 32
+    bitmap = [0] * words
+    values = []
+    ranks = []
+    for w in range(words):
+        ranks.append(len(values))
+        for bit in range(32):
+            code = gb_code(HAN_FIRST + w * 32 + bit)
+            if code is not None:
+                bitmap[w] |= 1 << bit
+                values.append(code)
+
+    runs = []
+    for cp in range(0x80, 0x10000):
+        if HAN_FIRST <= cp <= HAN_LAST:
+            continue
+        code = gb_code(cp)
+        if code is None:
+            continue
+        last = runs[-1] if runs else None
+        if last and last[0] + last[1] == cp and last[2] + last[1] == code and last[1] < 255:
+            last[1] += 1
+        else:
+            runs.append([cp, 1, code])
+
+    out = [
+        "#ifndef _gb2312_h_",
+        "#define _gb2312_h_",
+        "",
+        "// Generated by tools/gen_gb2312.py - do not edit.",
+        "",
+        f"#define gb2312_han_first 0x{HAN_FIRST:04X}",
+        f"#define gb2312_han_words {words}",
+        f"#define gb2312_run_count {len(runs)}",
+        "",
+        "static const uint32_t PROGMEM gb2312_han_bitmap[] = {",
+    ]
+    for i in range(0, words, 8):
+        out.append("    " + ", ".join(f"0x{v:08X}" for v in bitmap[i:i + 8]) + ",")
+    out += ["};", "", "static const uint16_t PROGMEM gb2312_han_rank[] = {"]
+    for i in range(0, words, 12):
+        out.append("    " + ", ".join(str(v) for v in ranks[i:i + 12]) + ",")
+    out += ["};", "", "static const uint16_t PROGMEM gb2312_han_codes[] = {"]
+    for i in range(0, len(values), 12):
+        out.append("    " + ", ".join(f"0x{v:04X}" for v in values[i:i + 12]) + ",")
+    out += ["};", "", "static const uint16_t PROGMEM gb2312_run_first[] = {"]
+    for i in range(0, len(runs), 12):
+        out.append("    " + ", ".join(f"0x{r[0]:04X}" for r in runs[i:i + 12]) + ",")
+    out += ["};", "", "static const uint8_t PROGMEM gb2312_run_length[] = {"]
+    for i in range(0, len(runs), 16):
+        out.append("    " + ", ".join(str(r[1]) for r in runs[i:i + 16]) + ",")
+    out += ["};", "", "static const uint16_t PROGMEM gb2312_run_code[] = {"]
+    for i in range(0, len(runs), 12):
+        out.append("    " + ", ".join(f"0x{r[2]:04X}" for r in runs[i:i + 12]) + ",")
+    out += ["};", "", "#endif", ""]
+
+    with open(TARGET, "w", encoding="ascii", newline="\n") as f:
+        f.write("\n".join(out))
+    total = words * 6 + len(values) * 2 + len(runs) * 5
+    count = len(values) + sum(r[1] for r in runs)
+    print(f"{count} characters, {total} bytes -> {os.path.relpath(TARGET)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Generate src/printer/assets/glyphfont.h, the raster fallback font.
+
+The source is either a GNU Unifont .hex file (8x16 and 16x16 glyphs) or any
+TrueType font, which is rendered into an 8x16 cell with Pillow. Only BMP
+codepoints from the ranges below that the source actually covers are kept.
+
+Each glyph is stored as a header byte (bit 7: 16 px wide, bits 0-3: first
+non-blank row), a row count byte, and only the rows between the first and
+last inked row. Glyphs are indexed by a sorted uint16_t codepoint array.
+
+    python3 tools/gen_glyph_font.py [font.ttf | unifont.hex]
+
+Defaults to DejaVu Sans Mono.
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TARGET = os.path.join(HERE, "..", "src", "printer", "assets", "glyphfont.h")
+DEFAULT_FONT = "/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf"
+
+RANGES = [
+    (0x0020, 0x007E),  # ASCII, so raster lines can hold mixed runs
+    (0x00A0, 0x00FF),  # Latin-1
+    (0x0100, 0x024F),  # Latin Extended-A/B
+    (0x0370, 0x03FF),  # Greek
+    (0x0400, 0x04FF),  # Cyrillic
+    (0x0590, 0x05FF),  # Hebrew
+    (0x2010, 0x205E),  # General punctuation
+    (0x20A0, 0x20BF),  # Currency
+    (0x2100, 0x214F),  # Letterlike
+    (0x2190, 0x21FF),  # Arrows
+    (0x2200, 0x22FF),  # Math operators
+    (0x2500, 0x259F),  # Box drawing, blocks
+    (0x25A0, 0x25FF),  # Geometric shapes
+    (0x2600, 0x26FF),  # Misc symbols
+    (0x2700, 0x27BF),  # Dingbats
+]
+
+ROWS = 16
+
+
+def wanted(cp):
+    return any(lo <= cp <= hi for lo, hi in RANGES)
+
+
+def load_hex(path):
+    glyphs = {}
+    with open(path, encoding="ascii") as f:
+        for line in f:
+            cp_text, bits = line.strip().split(":")
+            cp = int(cp_text, 16)
+            if not wanted(cp):
+                continue
+            wide = len(bits) == 64
+            step = 4 if wide else 2
+            rows = [int(bits[i:i + step], 16) for i in range(0, len(bits), step)]
+            glyphs[cp] = (wide, rows)
+    return glyphs
+
+
+def load_ttf_pillow(path):
+    from PIL import Image, ImageDraw, ImageFont
+
+    font = ImageFont.truetype(path, 13)
+    # Pillow silently renders .notdef for unmapped codepoints; U+FFFF is a
+    # noncharacter, so its mask is the .notdef box to compare against.
+    notdef = font.getmask("\uffff")
+    notdef = (notdef.size, bytes(notdef))
+    glyphs = {}
+    for lo, hi in RANGES:
+        for cp in range(lo, hi + 1):
+            ch = chr(cp)
+            mask = font.getmask(ch)
+            if (mask.size, bytes(mask)) == notdef:
+                continue
+            im = Image.new("L", (8, ROWS), 0)
+            ImageDraw.Draw(im).text((0, 0), ch, font=font, fill=255)
+            rows = []
+            for y in range(ROWS):
+                v = 0
+                for x in range(8):
+                    if im.getpixel((x, y)) > 110:
+                        v |= 0x80 >> x
+                rows.append(v)
+            glyphs[cp] = (False, rows)
+    return glyphs
+
+
+def encode(wide, rows):
+    first = 0
+    while first < ROWS and rows[first] == 0:
+        first += 1
+    last = ROWS
+    while last > first and rows[last - 1] == 0:
+        last -= 1
+    if first == ROWS:
+        first = 0
+        last = 0
+    out = [(0x80 if wide else 0) | first, last - first]
+    for r in rows[first:last]:
+        if wide:
+            out += [r >> 8, r & 0xFF]
+        else:
+            out.append(r)
+    return out
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_FONT
+    glyphs = load_hex(src) if src.endswith(".hex") else load_ttf_pillow(src)
+    cps = sorted(cp for cp in glyphs if cp <= 0xFFFF)
+
+    data = []
+    offsets = []
+    for cp in cps:
+        offsets.append(len(data))
+        data += encode(*glyphs[cp])
+    offsets.append(len(data))
+    offset_type = "uint16_t" if len(data) <= 0xFFFF else "uint32_t"
+
+    out = [
+        "#ifndef _glyphfont_h_",
+        "#define _glyphfont_h_",
+        "",
+        f"// Generated by tools/gen_glyph_font.py from {os.path.basename(src)} - do not edit.",
+        "",
+        f"#define glyphfont_count {len(cps)}",
+        f"#define glyphfont_height {ROWS}",
+        "",
+        f"typedef {offset_type} glyphfont_offset_t;",
+        "",
+        "static const uint16_t PROGMEM glyphfont_codepoints[] = {",
+    ]
+    for i in range(0, len(cps), 12):
+        out.append("    " + ", ".join(f"0x{cp:04X}" for cp in cps[i:i + 12]) + ",")
+    out += ["};", "", "static const glyphfont_offset_t PROGMEM glyphfont_offsets[] = {"]
+    for i in range(0, len(offsets), 12):
+        out.append("    " + ", ".join(str(o) for o in offsets[i:i + 12]) + ",")
+    out += ["};", "", "static const uint8_t PROGMEM glyphfont_data[] = {"]
+    for i in range(0, len(data), 16):
+        out.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    out += ["};", "", "#endif", ""]
+
+    with open(TARGET, "w", encoding="ascii", newline="\n") as f:
+        f.write("\n".join(out))
+    total = len(cps) * 2 + len(offsets) * (2 if offset_type == "uint16_t" else 4) + len(data)
+    print(f"{len(cps)} glyphs, {len(data)} data bytes, {total} bytes total -> {os.path.relpath(TARGET)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Generate src/printer/assets/normalize.h, the composition and fold tables.
+
+Compositions are the canonical (NFC) pairs of a base letter and a combining
+mark from U+0300-U+036F whose result is at most U+04FF, i.e. Latin, Greek
+and Cyrillic letters the code pages or the raster font can print. Keys are
+(base << 7) | (mark - 0x300), sorted.
+
+Folds replace typographic punctuation and invisible characters with ASCII
+when the active code page lacks them. An empty replacement drops the
+character.
+
+    python3 tools/gen_normalize.py
+"""
+
+import os
+import unicodedata
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TARGET = os.path.join(HERE, "..", "src", "printer", "assets", "normalize.h")
+
+FOLDS = {
+    0x00A0: " ",    # no-break space
+    0x00AD: "",     # soft hyphen
+    0x2002: " ", 0x2003: " ", 0x2004: " ", 0x2005: " ", 0x2006: " ",
+    0x2007: " ", 0x2008: " ", 0x2009: " ", 0x200A: " ",
+    0x200B: "", 0x200C: "", 0x200D: "", 0x200E: "", 0x200F: "",
+    0x2010: "-", 0x2011: "-", 0x2012: "-", 0x2013: "-", 0x2014: "-", 0x2015: "-",
+    0x2018: "'", 0x2019: "'", 0x201A: "'", 0x201B: "'",
+    0x201C: '"', 0x201D: '"', 0x201E: '"', 0x201F: '"',
+    0x2022: "*",
+    0x2024: ".",
+    0x2026: "...",
+    0x202F: " ",
+    0x2032: "'", 0x2033: '"',
+    0x2039: "<", 0x203A: ">",
+    0x2044: "/",
+    0x205F: " ",
+    0x2060: "",
+    0x20AC: "EUR",
+    0x2122: "TM",
+    0x2212: "-",
+    0xFE0E: "", 0xFE0F: "",
+    0xFEFF: "",
+}
+
+
+def compositions():
+    pairs = []
+    for base in range(0x20, 0x500):
+        for mark in range(0x300, 0x370):
+            c = unicodedata.normalize("NFC", chr(base) + chr(mark))
+            if len(c) == 1 and ord(c) <= 0x4FF:
+                pairs.append(((base << 7) | (mark - 0x300), ord(c)))
+    return sorted(pairs)
+
+
+def main():
+    pairs = compositions()
+    folds = sorted(FOLDS.items())
+    pool = ""
+    offsets = []
+    for _, text in folds:
+        offsets.append(len(pool))
+        pool += text
+    offsets.append(len(pool))
+
+    out = [
+        "#ifndef _normalize_h_",
+        "#define _normalize_h_",
+        "",
+        "// Generated by tools/gen_normalize.py - do not edit.",
+        "",
+        f"#define normalize_compose_count {len(pairs)}",
+        f"#define normalize_fold_count {len(folds)}",
+        "",
+        "static const uint32_t PROGMEM normalize_compose_keys[] = {",
+    ]
+    for i in range(0, len(pairs), 8):
+        out.append("    " + ", ".join(f"0x{k:05X}" for k, _ in pairs[i:i + 8]) + ",")
+    out += ["};", "", "static const uint16_t PROGMEM normalize_compose_values[] = {"]
+    for i in range(0, len(pairs), 12):
+        out.append("    " + ", ".join(f"0x{v:04X}" for _, v in pairs[i:i + 12]) + ",")
+    out += ["};", "", "static const uint16_t PROGMEM normalize_fold_codepoints[] = {"]
+    for i in range(0, len(folds), 12):
+        out.append("    " + ", ".join(f"0x{cp:04X}" for cp, _ in folds[i:i + 12]) + ",")
+    out += ["};", "", "static const uint8_t PROGMEM normalize_fold_offsets[] = {"]
+    for i in range(0, len(offsets), 16):
+        out.append("    " + ", ".join(str(o) for o in offsets[i:i + 16]) + ",")
+    escaped = pool.replace("\\", "\\\\").replace('"', '\\"')
+    out += ["};", "", f'static const char PROGMEM normalize_fold_pool[] = "{escaped}";', "", "#endif", ""]
+
+    with open(TARGET, "w", encoding="ascii", newline="\n") as f:
+        f.write("\n".join(out))
+    total = len(pairs) * 6 + len(folds) * 2 + len(offsets) + len(pool) + 1
+    print(f"{len(pairs)} compositions, {len(folds)} folds, {total} bytes -> {os.path.relpath(TARGET)}")
+
+
+if __name__ == "__main__":
+    main()